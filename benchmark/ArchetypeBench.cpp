@@ -0,0 +1,251 @@
+#include "Benchmark.h"
+
+#include <Reflection.h>
+
+#include <memory>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+	struct BenchPosition
+	{
+		GENERATE_POD(BenchPosition);
+
+		public :
+			PROPERTY(m_x);
+			float m_x = 0.0f;
+
+			PROPERTY(m_y);
+			float m_y = 0.0f;
+
+			PROPERTY(m_z);
+			float m_z = 0.0f;
+	};
+
+	struct BenchVelocity
+	{
+		GENERATE_POD(BenchVelocity);
+
+		public :
+			PROPERTY(m_x);
+			float m_x = 0.0f;
+
+			PROPERTY(m_y);
+			float m_y = 0.0f;
+
+			PROPERTY(m_z);
+			float m_z = 0.0f;
+	};
+
+	struct BenchHealth
+	{
+		GENERATE_POD(BenchHealth);
+
+		public :
+			PROPERTY(m_value);
+			int m_value = 100;
+	};
+
+	/**
+	 * @brief	The ad-hoc storage the archetypes replace : one hash map of components per typeid.
+	 */
+	class TypeidStore
+	{
+		public :
+			struct IPool
+			{
+				virtual ~IPool() = default;
+			};
+
+			template<typename T>
+			struct Pool : IPool
+			{
+				std::unordered_map<uint32_t, T> components;
+			};
+
+			template<typename T>
+			Pool<T>& GetPool()
+			{
+				std::unique_ptr<IPool>& pool = m_pools[std::type_index(typeid(T))];
+				if (nullptr == pool)
+				{
+					pool = std::make_unique<Pool<T>>();
+				}
+
+				return static_cast<Pool<T>&>(*pool);
+			}
+
+			template<typename T>
+			T* Get(uint32_t entity)
+			{
+				auto& components = GetPool<T>().components;
+				const auto found = components.find(entity);
+
+				return (found != components.end()) ? &found->second : nullptr;
+			}
+
+		private :
+			std::unordered_map<std::type_index, std::unique_ptr<IPool>> m_pools;
+	};
+}
+
+namespace Bench
+{
+	void Archetype()
+	{
+		constexpr size_t Count = 1 << 18;
+		constexpr size_t Repetitions = 20;
+		constexpr float DeltaTime = 1.0f / 60.0f;
+
+		std::printf("[ Archetype ] %zu entities with a position and a velocity, half of them with a health\n", Count);
+
+		Reflection::ArchetypeStore store;
+		std::vector<Reflection::Entity> entities;
+		entities.reserve(Count);
+
+		TypeidStore typeidStore;
+
+		Measure("Create typeid maps", 1, Count, [&]()
+		{
+			typeidStore = TypeidStore();
+
+			for (uint32_t index = 0; index < Count; ++index)
+			{
+				typeidStore.GetPool<BenchPosition>().components.emplace(index, BenchPosition());
+				typeidStore.GetPool<BenchVelocity>().components.emplace(index, BenchVelocity{ 1.0f, 0.0f, 0.0f });
+
+				if (0 == index % 2)
+				{
+					typeidStore.GetPool<BenchHealth>().components.emplace(index, BenchHealth());
+				}
+			}
+		});
+
+		Measure("Create archetypes", 1, Count, [&]()
+		{
+			for (const Reflection::Entity entity : entities)
+			{
+				store.DestroyEntity(entity);
+			}
+
+			entities.clear();
+
+			for (size_t index = 0; index < Count; ++index)
+			{
+				const Reflection::Entity entity = store.CreateEntity();
+				store.AddComponent<BenchPosition>(entity);
+				store.AddComponent<BenchVelocity>(entity, BenchVelocity{ 1.0f, 0.0f, 0.0f });
+
+				if (0 == index % 2)
+				{
+					store.AddComponent<BenchHealth>(entity);
+				}
+
+				entities.push_back(entity);
+			}
+		});
+
+		const double typeidIterate = Measure("Integrate typeid maps", Repetitions, Count, [&]()
+		{
+			auto& positions = typeidStore.GetPool<BenchPosition>().components;
+
+			for (const auto& [entity, velocity] : typeidStore.GetPool<BenchVelocity>().components)
+			{
+				const auto found = positions.find(entity);
+				if (found != positions.end())
+				{
+					found->second.m_x += velocity.m_x * DeltaTime;
+					found->second.m_y += velocity.m_y * DeltaTime;
+					found->second.m_z += velocity.m_z * DeltaTime;
+				}
+			}
+		});
+
+		Reflection::ArchetypeQuery moving;
+		const double archetypeIterate = Measure("Integrate archetype ForEach", Repetitions, Count, [&]()
+		{
+			store.ForEach<BenchPosition, const BenchVelocity>(moving, [DeltaTime](Reflection::Entity, BenchPosition& position, const BenchVelocity& velocity)
+			{
+				position.m_x += velocity.m_x * DeltaTime;
+				position.m_y += velocity.m_y * DeltaTime;
+				position.m_z += velocity.m_z * DeltaTime;
+			});
+		});
+
+		Overhead(archetypeIterate, typeidIterate);
+
+		Reflection::ArchetypeQuery healthless;
+		healthless.Without<BenchHealth>();
+
+		Measure("Integrate archetype without health", Repetitions, Count / 2, [&]()
+		{
+			store.ForEach<BenchPosition, const BenchVelocity>(healthless, [DeltaTime](Reflection::Entity, BenchPosition& position, const BenchVelocity& velocity)
+			{
+				position.m_x += velocity.m_x * DeltaTime;
+			});
+		});
+
+		Random random(11);
+		std::vector<uint32_t> lookups(Count);
+		for (uint32_t& lookup : lookups)
+		{
+			lookup = static_cast<uint32_t>(random.Range(Count));
+		}
+
+		const double typeidGet = Measure("Get component typeid maps", Repetitions, Count, [&]()
+		{
+			float sum = 0.0f;
+			for (const uint32_t lookup : lookups)
+			{
+				sum += typeidStore.Get<BenchPosition>(lookup)->m_x;
+			}
+
+			DoNotOptimize(sum);
+		});
+
+		const double archetypeGet = Measure("Get component archetypes", Repetitions, Count, [&]()
+		{
+			float sum = 0.0f;
+			for (const uint32_t lookup : lookups)
+			{
+				sum += store.GetComponent<BenchPosition>(entities[lookup])->m_x;
+			}
+
+			DoNotOptimize(sum);
+		});
+
+		Overhead(archetypeGet, typeidGet);
+
+		// Toggling a component moves the entity between two archetypes.
+		const double typeidToggle = Measure("Add / remove typeid maps", 5, Count, [&]()
+		{
+			auto& healths = typeidStore.GetPool<BenchHealth>().components;
+
+			for (uint32_t index = 0; index < Count; ++index)
+			{
+				if (0 == healths.erase(index))
+				{
+					healths.emplace(index, BenchHealth());
+				}
+			}
+		});
+
+		const double archetypeToggle = Measure("Add / remove archetypes", 5, Count, [&]()
+		{
+			for (const Reflection::Entity entity : entities)
+			{
+				if (!store.RemoveComponent<BenchHealth>(entity))
+				{
+					store.AddComponent<BenchHealth>(entity);
+				}
+			}
+		});
+
+		Overhead(archetypeToggle, typeidToggle);
+
+		std::printf("  %-36s %zu archetypes\n", "archetypes", store.GetArchetypeCount());
+		std::printf("\n");
+	}
+}
\ No newline at end of file
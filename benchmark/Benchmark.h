@@ -0,0 +1,139 @@
+#ifndef __REFLECTION_BENCHMARK_H__
+#define __REFLECTION_BENCHMARK_H__
+
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Bench
+{
+	/**
+	 * @brief	One timed measurement, kept for the JSON report.
+	 */
+	struct Result
+	{
+		std::string suite;
+		std::string name;
+		size_t repetitions;
+		size_t items;
+		double nsPerRun;
+		double nsPerItem;
+	};
+
+	/**
+	 * @brief	Gets the measurements taken so far, in order.
+	 */
+	inline std::vector<Result>& GetResults()
+	{
+		static std::vector<Result> results;
+		return results;
+	}
+
+	/**
+	 * @brief	Gets the name of the running suite, recorded with every measurement.
+	 */
+	inline std::string& GetSuite()
+	{
+		static std::string suite;
+		return suite;
+	}
+
+	/**
+	 * @brief	Prevents the compiler from discarding a value computed by a benchmark.
+	 */
+	template<typename T>
+	inline void DoNotOptimize(const T& value)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : : "r,m"(value) : "memory");
+#else
+		static volatile const void* sink;
+		sink = &value;
+#endif
+	}
+
+	/**
+	 * @brief	Measures the average time of a function over a number of repetitions.
+	 * @details	The function is run once to warm up the caches and the lazily built layouts, then timed.
+	 * @param	name        The name printed with the result.
+	 * @param	repetitions The number of timed runs.
+	 * @param	items       The number of items processed per run, used to report the time per item.
+	 * @param	func        The function to measure.
+	 * @return	double The average time of a run in nanoseconds.
+	 */
+	template<typename Func>
+	double Measure(const std::string& name, size_t repetitions, size_t items, Func&& func)
+	{
+		func();
+
+		const auto start = std::chrono::steady_clock::now();
+
+		for (size_t repetition = 0; repetition < repetitions; ++repetition)
+		{
+			func();
+		}
+
+		const auto end = std::chrono::steady_clock::now();
+
+		const double total = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+		const double perRun = total / static_cast<double>(repetitions);
+		const double perItem = perRun / static_cast<double>(items);
+
+		std::printf("  %-36s %12.1f us/run %10.2f ns/item\n", name.c_str(), perRun / 1000.0, perItem);
+
+		GetResults().push_back({ GetSuite(), name, repetitions, items, perRun, perItem });
+
+		return perRun;
+	}
+
+	/**
+	 * @brief	Small deterministic random generator, so every run changes the same fields.
+	 */
+	class Random
+	{
+		public :
+			explicit Random(uint64_t seed) : m_state(seed) {}
+
+			uint64_t Next()
+			{
+				m_state ^= m_state << 13;
+				m_state ^= m_state >> 7;
+				m_state ^= m_state << 17;
+
+				return m_state;
+			}
+
+			size_t Range(size_t count)
+			{
+				return static_cast<size_t>(Next() % count);
+			}
+
+		private :
+			uint64_t m_state;
+	};
+
+	/**
+	 * @brief	Prints how many times slower a reflected operation is than the hand-written equivalent.
+	 */
+	inline void Overhead(double reflected, double direct)
+	{
+		std::printf("  %-36s %12.2fx\n", "  overhead vs direct", (0.0 < direct) ? reflected / direct : 0.0);
+	}
+
+	void Core();
+	void Diff();
+	void Json();
+	void Binary();
+	void Path();
+	void Job();
+	void Cast();
+	void Visit();
+	void Graph();
+	void Reload();
+	void SoA();
+	void Archetype();
+};
+
+#endif // __REFLECTION_BENCHMARK_H__
\ No newline at end of file
@@ -0,0 +1,204 @@
+#include "Benchmark.h"
+
+#include <Reflection.h>
+
+#include <string>
+#include <vector>
+
+namespace
+{
+	class SaveV1
+	{
+		GENERATE(SaveV1);
+
+		public :
+			virtual ~SaveV1() = default;
+
+		public :
+			PROPERTY(m_id);
+			uint64_t m_id = 0;
+
+			PROPERTY(m_health);
+			int32_t m_health = 100;
+
+			PROPERTY(m_mana);
+			int32_t m_mana = 50;
+
+			PROPERTY(m_x);
+			float m_x = 0.0f;
+
+			PROPERTY(m_y);
+			float m_y = 0.0f;
+
+			PROPERTY(m_z);
+			float m_z = 0.0f;
+
+			PROPERTY(m_name);
+			std::string m_name;
+
+			PROPERTY(m_inventory);
+			std::vector<int32_t> m_inventory;
+	};
+
+	/**
+	 * @brief	The next version of SaveV1: members reordered, m_health widened, m_level added and m_mana removed.
+	 */
+	class SaveV2
+	{
+		GENERATE(SaveV2);
+
+		public :
+			virtual ~SaveV2() = default;
+
+		public :
+			PROPERTY(m_name);
+			std::string m_name;
+
+			PROPERTY(m_id);
+			uint64_t m_id = 0;
+
+			PROPERTY(m_level);
+			int32_t m_level = 1;
+
+			PROPERTY(m_x);
+			float m_x = 0.0f;
+
+			PROPERTY(m_y);
+			float m_y = 0.0f;
+
+			PROPERTY(m_z);
+			float m_z = 0.0f;
+
+			PROPERTY(m_health);
+			int64_t m_health = 100;
+
+			PROPERTY(m_inventory);
+			std::vector<int32_t> m_inventory;
+	};
+
+	struct Particle
+	{
+		GENERATE_POD(Particle);
+
+		public :
+			PROPERTY(m_x);
+			float m_x = 0.0f;
+
+			PROPERTY(m_y);
+			float m_y = 0.0f;
+
+			PROPERTY(m_z);
+			float m_z = 0.0f;
+
+			PROPERTY(m_life);
+			float m_life = 1.0f;
+
+			PROPERTY(m_color);
+			uint32_t m_color = 0;
+
+			PROPERTY(m_flags);
+			uint32_t m_flags = 0;
+	};
+
+	template<typename T, typename Func>
+	double MeasureLoad(const std::string& name, size_t repetitions, const std::vector<char>& buffer, std::vector<T>& objects, Func&& check)
+	{
+		bool succeeded = true;
+
+		const double time = Bench::Measure(name, repetitions, objects.size(), [&]()
+		{
+			Reflection::BinaryReader reader(buffer.data(), buffer.size());
+
+			for (T& object : objects)
+			{
+				succeeded = reader.Read(object) && succeeded;
+			}
+
+			Bench::DoNotOptimize(objects);
+		});
+
+		std::printf("  %-36s %s\n", "  loaded correctly", (succeeded && check()) ? "yes" : "no");
+
+		return time;
+	}
+}
+
+namespace Bench
+{
+	void Binary()
+	{
+		constexpr size_t ObjectCount = 100000;
+		constexpr size_t Repetitions = 10;
+
+		Random random(0xB17Aull);
+
+		std::vector<SaveV1> saves(ObjectCount);
+		for (size_t index = 0; index < ObjectCount; ++index)
+		{
+			SaveV1& save = saves[index];
+			save.m_id = index;
+			save.m_health = static_cast<int32_t>(random.Range(1000));
+			save.m_x = static_cast<float>(random.Range(1000));
+			save.m_name = "Save_" + std::to_string(index);
+			save.m_inventory.assign(random.Range(8) + 1, static_cast<int32_t>(index));
+		}
+
+		std::vector<Particle> particles(ObjectCount);
+		for (size_t index = 0; index < ObjectCount; ++index)
+		{
+			particles[index].m_x = static_cast<float>(index);
+			particles[index].m_color = static_cast<uint32_t>(random.Next());
+		}
+
+		Reflection::BinaryWriter writer;
+
+		Measure("BinaryWriter::Write", Repetitions, ObjectCount, [&]()
+		{
+			writer.Clear();
+
+			for (const SaveV1& save : saves)
+			{
+				writer.Write(save);
+			}
+		});
+
+		const std::vector<char> saveBuffer = writer.GetBuffer();
+
+		writer.Clear();
+		for (const Particle& particle : particles)
+		{
+			writer.Write(particle);
+		}
+
+		const std::vector<char> particleBuffer = writer.GetBuffer();
+
+		std::printf("[ Binary ] %zu objects, %.1f MB saves, %.1f MB particles\n", ObjectCount,
+			static_cast<double>(saveBuffer.size()) / (1024.0 * 1024.0), static_cast<double>(particleBuffer.size()) / (1024.0 * 1024.0));
+
+		const Reflection::TypeInfo* saveType = SaveV1::GetStaticTypeInfo();
+
+		std::vector<SaveV1> sameLayout(ObjectCount);
+		MeasureLoad("Load, same layout (block copy)", Repetitions, saveBuffer, sameLayout, [&]()
+		{
+			return saveType->Equals(&sameLayout[ObjectCount / 2], &saves[ObjectCount / 2]);
+		});
+
+		std::vector<SaveV2> newLayout(ObjectCount);
+		MeasureLoad("Load, new layout (remap)", Repetitions, saveBuffer, newLayout, [&]()
+		{
+			const SaveV2& loaded = newLayout[ObjectCount / 2];
+			const SaveV1& saved = saves[ObjectCount / 2];
+
+			return (loaded.m_id == saved.m_id) && (loaded.m_health == saved.m_health) && (loaded.m_name == saved.m_name)
+				&& (loaded.m_inventory == saved.m_inventory) && (1 == loaded.m_level);
+		});
+
+		std::vector<Particle> flatLayout(ObjectCount);
+		MeasureLoad("Load, flat POD (single memcpy)", Repetitions, particleBuffer, flatLayout, [&]()
+		{
+			return Particle::GetStaticTypeInfo()->Equals(&flatLayout[ObjectCount / 2], &particles[ObjectCount / 2]);
+		});
+
+		std::printf("\n");
+	}
+}
\ No newline at end of file
@@ -0,0 +1,161 @@
+#include "Benchmark.h"
+
+#include <Reflection.h>
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	class CastNode
+	{
+		GENERATE(CastNode);
+
+		public :
+			virtual ~CastNode() = default;
+	};
+
+	class CastDamageable
+	{
+		GENERATE(CastDamageable);
+
+		public :
+			virtual ~CastDamageable() = default;
+
+		public :
+			PROPERTY(m_health);
+			int m_health = 100;
+	};
+
+	class CastActor : public CastNode
+	{
+		GENERATE(CastActor);
+	};
+
+	class CastPawn : public CastActor
+	{
+		GENERATE(CastPawn);
+	};
+
+	class CastLight : public CastNode
+	{
+		GENERATE(CastLight);
+	};
+
+	class CastTurret : public CastActor, public CastDamageable
+	{
+		GENERATE(CastTurret, CastActor, CastDamageable);
+	};
+
+	class CastCrate : public CastNode, public CastDamageable
+	{
+		GENERATE(CastCrate, CastNode, CastDamageable);
+	};
+
+	/**
+	 * @brief	Runs func(thread) on threadCount threads and waits for them.
+	 */
+	template<typename Func>
+	void RunThreads(size_t threadCount, Func&& func)
+	{
+		std::vector<std::thread> threads;
+		threads.reserve(threadCount);
+
+		for (size_t thread = 0; thread < threadCount; ++thread)
+		{
+			threads.emplace_back([&func, thread]() { func(thread); });
+		}
+
+		for (std::thread& thread : threads)
+		{
+			thread.join();
+		}
+	}
+}
+
+namespace Bench
+{
+	void Cast()
+	{
+		constexpr size_t ObjectCount = 4096;
+		constexpr size_t Passes = 64;
+		constexpr size_t Repetitions = 5;
+
+		std::vector<CastActor> actors(ObjectCount / 4);
+		std::vector<CastPawn> pawns(ObjectCount / 4);
+		std::vector<CastTurret> turrets(ObjectCount / 4);
+		std::vector<CastCrate> crates(ObjectCount / 8);
+		std::vector<CastLight> lights(ObjectCount / 8);
+
+		// Interleaved, so consecutive casts hit different dynamic types.
+		std::vector<CastNode*> objects;
+		objects.reserve(ObjectCount);
+
+		for (size_t index = 0; index < ObjectCount / 8; ++index)
+		{
+			objects.push_back(&actors[index * 2]);
+			objects.push_back(&pawns[index * 2]);
+			objects.push_back(&turrets[index * 2]);
+			objects.push_back(&crates[index]);
+			objects.push_back(&actors[index * 2 + 1]);
+			objects.push_back(&pawns[index * 2 + 1]);
+			objects.push_back(&turrets[index * 2 + 1]);
+			objects.push_back(&lights[index]);
+		}
+
+		const size_t hardware = std::max<size_t>(1, std::thread::hardware_concurrency());
+		const size_t threadCounts[] = { 1, 2, 4, 8 };
+
+		std::printf("[ Cast ] %zu objects of 5 types, 3 targets, %zu passes per thread, %zu hardware threads\n", ObjectCount, Passes, hardware);
+
+		for (const size_t threadCount : threadCounts)
+		{
+			const size_t items = threadCount * Passes * ObjectCount * 3;
+
+			const double cast = Measure("Cast x " + std::to_string(threadCount) + " threads", Repetitions, items, [&]()
+			{
+				RunThreads(threadCount, [&](size_t)
+				{
+					size_t count = 0;
+					for (size_t pass = 0; pass < Passes; ++pass)
+					{
+						for (CastNode* object : objects)
+						{
+							count += (nullptr != Reflection::Cast<CastActor*>(object)) ? 1 : 0;
+							count += (nullptr != Reflection::Cast<CastPawn*>(object)) ? 1 : 0;
+							count += (nullptr != Reflection::Cast<CastDamageable*>(object)) ? 1 : 0;
+						}
+					}
+
+					DoNotOptimize(count);
+				});
+			});
+
+			const double dynamicCast = Measure("dynamic_cast x " + std::to_string(threadCount) + " threads", Repetitions, items, [&]()
+			{
+				RunThreads(threadCount, [&](size_t)
+				{
+					size_t count = 0;
+					for (size_t pass = 0; pass < Passes; ++pass)
+					{
+						for (CastNode* object : objects)
+						{
+							count += (nullptr != dynamic_cast<CastActor*>(object)) ? 1 : 0;
+							count += (nullptr != dynamic_cast<CastPawn*>(object)) ? 1 : 0;
+							count += (nullptr != dynamic_cast<CastDamageable*>(object)) ? 1 : 0;
+						}
+					}
+
+					DoNotOptimize(count);
+				});
+			});
+
+			Overhead(cast, dynamicCast);
+		}
+
+		std::printf("  %-36s %12zu\n", "cast cache entries", Reflection::CastCache::GetHandle().GetSize());
+		std::printf("\n");
+	}
+}
\ No newline at end of file
@@ -0,0 +1,434 @@
+#include "Benchmark.h"
+
+#include <Reflection.h>
+
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+	class CoreObject
+	{
+		GENERATE(CoreObject);
+
+		public :
+			virtual ~CoreObject() = default;
+
+		public :
+			METHOD(Add);
+			int Add(int lhs, int rhs)
+			{
+				return m_value + lhs + rhs;
+			}
+
+		public :
+			PROPERTY(m_value);
+			int m_value = 0;
+
+			PROPERTY(m_scale);
+			float m_scale = 1.0f;
+
+			PROPERTY(m_name);
+			std::string m_name;
+
+			PROPERTY(m_values);
+			std::vector<int> m_values;
+
+			PROPERTY(m_table);
+			std::map<int, int> m_table;
+	};
+
+	class Deep0
+	{
+		GENERATE(Deep0);
+
+		public :
+			virtual ~Deep0() = default;
+	};
+
+	class Deep1 : public Deep0 { GENERATE(Deep1); };
+	class Deep2 : public Deep1 { GENERATE(Deep2); };
+	class Deep3 : public Deep2 { GENERATE(Deep3); };
+	class Deep4 : public Deep3 { GENERATE(Deep4); };
+	class Deep5 : public Deep4 { GENERATE(Deep5); };
+	class Deep6 : public Deep5 { GENERATE(Deep6); };
+	class Deep7 : public Deep6 { GENERATE(Deep7); };
+
+	constexpr size_t ObjectCount = 1024;
+	constexpr size_t Passes = 256;
+	constexpr size_t Repetitions = 20;
+
+	void PropertyAccess(std::vector<CoreObject>& objects)
+	{
+		const Reflection::TypeInfo* type = CoreObject::GetStaticTypeInfo();
+		const Reflection::PropertyInfo* property = type->GetProperty(std::string(type->GetTypeName()) + "::m_value");
+
+		std::printf("[ Core : Property Get / Set ] %zu objects x %zu passes\n", ObjectCount, Passes);
+
+		const double get = Bench::Measure("PropertyInfo::Get<int>", Repetitions, ObjectCount * Passes, [&]()
+		{
+			int sum = 0;
+			for (size_t pass = 0; pass < Passes; ++pass)
+			{
+				for (CoreObject& object : objects)
+				{
+					sum += *property->Get<int>(object);
+				}
+			}
+
+			Bench::DoNotOptimize(sum);
+		});
+
+		Bench::Measure("PropertyInfo::GetRaw", Repetitions, ObjectCount * Passes, [&]()
+		{
+			int sum = 0;
+			for (size_t pass = 0; pass < Passes; ++pass)
+			{
+				for (CoreObject& object : objects)
+				{
+					sum += *static_cast<const int*>(property->GetRaw(&object));
+				}
+			}
+
+			Bench::DoNotOptimize(sum);
+		});
+
+		const double directGet = Bench::Measure("Direct read", Repetitions, ObjectCount * Passes, [&]()
+		{
+			int sum = 0;
+			for (size_t pass = 0; pass < Passes; ++pass)
+			{
+				for (CoreObject& object : objects)
+				{
+					Bench::DoNotOptimize(object);
+					sum += object.m_value;
+				}
+			}
+
+			Bench::DoNotOptimize(sum);
+		});
+
+		Bench::Overhead(get, directGet);
+
+		const double set = Bench::Measure("PropertyInfo::Set<int>", Repetitions, ObjectCount * Passes, [&]()
+		{
+			for (size_t pass = 0; pass < Passes; ++pass)
+			{
+				const int value = static_cast<int>(pass);
+				for (CoreObject& object : objects)
+				{
+					property->Set(object, value);
+				}
+			}
+
+			Bench::DoNotOptimize(objects);
+		});
+
+		Bench::Measure("PropertyInfo::SetRaw", Repetitions, ObjectCount * Passes, [&]()
+		{
+			for (size_t pass = 0; pass < Passes; ++pass)
+			{
+				const int value = static_cast<int>(pass);
+				for (CoreObject& object : objects)
+				{
+					property->SetRaw(&object, &value);
+				}
+			}
+
+			Bench::DoNotOptimize(objects);
+		});
+
+		const double directSet = Bench::Measure("Direct write", Repetitions, ObjectCount * Passes, [&]()
+		{
+			for (size_t pass = 0; pass < Passes; ++pass)
+			{
+				const int value = static_cast<int>(pass);
+				for (CoreObject& object : objects)
+				{
+					Bench::DoNotOptimize(object);
+					object.m_value = value;
+				}
+			}
+
+			Bench::DoNotOptimize(objects);
+		});
+
+		Bench::Overhead(set, directSet);
+		std::printf("\n");
+	}
+
+	void MethodInvoke(std::vector<CoreObject>& objects)
+	{
+		const Reflection::TypeInfo* type = CoreObject::GetStaticTypeInfo();
+		const Reflection::MethodInfo* method = type->GetMethod(std::string(type->GetTypeName()) + "::Add");
+
+		std::printf("[ Core : Invoke ] %zu objects x %zu passes\n", ObjectCount, Passes);
+
+		const double invoke = Bench::Measure("MethodInfo::Invoke<int>", Repetitions, ObjectCount * Passes, [&]()
+		{
+			int sum = 0;
+			for (size_t pass = 0; pass < Passes; ++pass)
+			{
+				for (CoreObject& object : objects)
+				{
+					sum += method->Invoke<int>(object, 1, 2);
+				}
+			}
+
+			Bench::DoNotOptimize(sum);
+		});
+
+		const double direct = Bench::Measure("Direct call", Repetitions, ObjectCount * Passes, [&]()
+		{
+			int sum = 0;
+			for (size_t pass = 0; pass < Passes; ++pass)
+			{
+				for (CoreObject& object : objects)
+				{
+					Bench::DoNotOptimize(object);
+					sum += object.Add(1, 2);
+				}
+			}
+
+			Bench::DoNotOptimize(sum);
+		});
+
+		Bench::Overhead(invoke, direct);
+		std::printf("\n");
+	}
+
+	void CastAndIsChild()
+	{
+		std::vector<Deep7> deepObjects(ObjectCount / 2);
+		std::vector<Deep3> shallowObjects(ObjectCount / 2);
+
+		// Half of the casts succeed at the bottom of the hierarchy, half fail after walking it.
+		std::vector<Deep0*> objects;
+		for (size_t index = 0; index < ObjectCount / 2; ++index)
+		{
+			objects.push_back(&deepObjects[index]);
+			objects.push_back(&shallowObjects[index]);
+		}
+
+		std::printf("[ Core : Cast / IsChild ] depth 7 hierarchy, %zu objects x %zu passes\n", ObjectCount, Passes);
+
+		const double cast = Bench::Measure("Cast<Deep7*>", Repetitions, ObjectCount * Passes, [&]()
+		{
+			size_t count = 0;
+			for (size_t pass = 0; pass < Passes; ++pass)
+			{
+				for (Deep0* object : objects)
+				{
+					count += (nullptr != Reflection::Cast<Deep7*>(object)) ? 1 : 0;
+				}
+			}
+
+			Bench::DoNotOptimize(count);
+		});
+
+		const double dynamicCast = Bench::Measure("dynamic_cast<Deep7*>", Repetitions, ObjectCount * Passes, [&]()
+		{
+			size_t count = 0;
+			for (size_t pass = 0; pass < Passes; ++pass)
+			{
+				for (Deep0* object : objects)
+				{
+					count += (nullptr != dynamic_cast<Deep7*>(object)) ? 1 : 0;
+				}
+			}
+
+			Bench::DoNotOptimize(count);
+		});
+
+		Bench::Overhead(cast, dynamicCast);
+
+		const Reflection::TypeInfo* parentType = Deep1::GetStaticTypeInfo();
+
+		const double isChild = Bench::Measure("IsChild(Deep1, runtime type)", Repetitions, ObjectCount * Passes, [&]()
+		{
+			size_t count = 0;
+			for (size_t pass = 0; pass < Passes; ++pass)
+			{
+				for (Deep0* object : objects)
+				{
+					count += Reflection::IsChild(parentType, object->GetTypeInfo()) ? 1 : 0;
+				}
+			}
+
+			Bench::DoNotOptimize(count);
+		});
+
+		const double dynamicIsChild = Bench::Measure("dynamic_cast<Deep1*> != nullptr", Repetitions, ObjectCount * Passes, [&]()
+		{
+			size_t count = 0;
+			for (size_t pass = 0; pass < Passes; ++pass)
+			{
+				for (Deep0* object : objects)
+				{
+					count += (nullptr != dynamic_cast<Deep1*>(object)) ? 1 : 0;
+				}
+			}
+
+			Bench::DoNotOptimize(count);
+		});
+
+		Bench::Overhead(isChild, dynamicIsChild);
+		std::printf("\n");
+	}
+
+	void ContainerIteration()
+	{
+		constexpr size_t ElementCount = 1 << 20;
+		constexpr size_t EntryCount = 1 << 16;
+
+		CoreObject object;
+		object.m_values.resize(ElementCount);
+		for (size_t index = 0; index < ElementCount; ++index)
+		{
+			object.m_values[index] = static_cast<int>(index);
+		}
+
+		for (size_t index = 0; index < EntryCount; ++index)
+		{
+			object.m_table.emplace(static_cast<int>(index), static_cast<int>(index));
+		}
+
+		const Reflection::TypeInfo* type = CoreObject::GetStaticTypeInfo();
+		const auto* arrayInfo = Reflection::Cast<const Reflection::ArrayPropertyInfo*>(type->GetProperty(std::string(type->GetTypeName()) + "::m_values"));
+		const auto* mapInfo = Reflection::Cast<const Reflection::MapPropertyInfo*>(type->GetProperty(std::string(type->GetTypeName()) + "::m_table"));
+
+		std::printf("[ Core : Container iteration ] vector<int> x %zu, map<int, int> x %zu\n", ElementCount, EntryCount);
+
+		const double arrayIteration = Bench::Measure("ArrayPropertyInfo::Iterator", Repetitions, ElementCount, [&]()
+		{
+			int64_t sum = 0;
+			for (auto itr = arrayInfo->begin(&object.m_values), end = arrayInfo->end(&object.m_values); itr != end; ++itr)
+			{
+				sum += *static_cast<const int*>(itr.get());
+			}
+
+			Bench::DoNotOptimize(sum);
+		});
+
+		const double arrayDirect = Bench::Measure("Range-for over std::vector", Repetitions, ElementCount, [&]()
+		{
+			int64_t sum = 0;
+			for (const int value : object.m_values)
+			{
+				Bench::DoNotOptimize(value);
+				sum += value;
+			}
+
+			Bench::DoNotOptimize(sum);
+		});
+
+		Bench::Overhead(arrayIteration, arrayDirect);
+
+		const double mapIteration = Bench::Measure("MapPropertyInfo::Iterator", Repetitions, EntryCount, [&]()
+		{
+			int64_t sum = 0;
+			for (auto itr = mapInfo->begin(&object.m_table), end = mapInfo->end(&object.m_table); itr != end; ++itr)
+			{
+				sum += *static_cast<const int*>(mapInfo->GetRawMapped(itr.get()));
+			}
+
+			Bench::DoNotOptimize(sum);
+		});
+
+		const double mapDirect = Bench::Measure("Range-for over std::map", Repetitions, EntryCount, [&]()
+		{
+			int64_t sum = 0;
+			for (const auto& entry : object.m_table)
+			{
+				Bench::DoNotOptimize(entry);
+				sum += entry.second;
+			}
+
+			Bench::DoNotOptimize(sum);
+		});
+
+		Bench::Overhead(mapIteration, mapDirect);
+		std::printf("\n");
+	}
+
+	void NameLookup()
+	{
+		const Reflection::TypeInfo* type = CoreObject::GetStaticTypeInfo();
+
+		std::vector<std::string> names;
+		std::unordered_map<std::string, size_t> offsets;
+
+		for (const Reflection::PropertyInfo* property : type->GetPropertyList())
+		{
+			names.emplace_back(property->GetPropertyName());
+			offsets.emplace(property->GetPropertyName(), property->GetPropertyOffset());
+		}
+
+		const std::string methodName = std::string(type->GetTypeName()) + "::Add";
+
+		std::printf("[ Core : Name lookup ] %zu property names x %zu passes\n", names.size(), Passes * 16);
+
+		const double lookup = Bench::Measure("TypeInfo::GetProperty", Repetitions, names.size() * Passes * 16, [&]()
+		{
+			size_t sum = 0;
+			for (size_t pass = 0; pass < Passes * 16; ++pass)
+			{
+				for (const std::string& name : names)
+				{
+					sum += type->GetProperty(name)->GetPropertyOffset();
+				}
+			}
+
+			Bench::DoNotOptimize(sum);
+		});
+
+		const double direct = Bench::Measure("Hand-written unordered_map", Repetitions, names.size() * Passes * 16, [&]()
+		{
+			size_t sum = 0;
+			for (size_t pass = 0; pass < Passes * 16; ++pass)
+			{
+				for (const std::string& name : names)
+				{
+					sum += offsets.find(name)->second;
+				}
+			}
+
+			Bench::DoNotOptimize(sum);
+		});
+
+		Bench::Overhead(lookup, direct);
+
+		Bench::Measure("TypeInfo::GetMethod", Repetitions, Passes * 16, [&]()
+		{
+			size_t count = 0;
+			for (size_t pass = 0; pass < Passes * 16; ++pass)
+			{
+				count += (nullptr != type->GetMethod(methodName)) ? 1 : 0;
+			}
+
+			Bench::DoNotOptimize(count);
+		});
+
+		std::printf("\n");
+	}
+}
+
+namespace Bench
+{
+	void Core()
+	{
+		std::vector<CoreObject> objects(ObjectCount);
+		for (size_t index = 0; index < ObjectCount; ++index)
+		{
+			objects[index].m_value = static_cast<int>(index);
+		}
+
+		PropertyAccess(objects);
+		MethodInvoke(objects);
+		CastAndIsChild();
+		ContainerIteration();
+		NameLookup();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,201 @@
+#include "Benchmark.h"
+
+#include <Reflection.h>
+
+#include <string>
+#include <vector>
+
+namespace
+{
+	class Entity
+	{
+		GENERATE(Entity);
+
+		public :
+			virtual ~Entity() = default;
+
+		public :
+			PROPERTY(m_id);
+			uint64_t m_id = 0;
+
+			PROPERTY(m_owner);
+			uint64_t m_owner = 0;
+
+			PROPERTY(m_health);
+			int32_t m_health = 100;
+
+			PROPERTY(m_mana);
+			int32_t m_mana = 50;
+
+			PROPERTY(m_level);
+			int32_t m_level = 1;
+
+			PROPERTY(m_experience);
+			int32_t m_experience = 0;
+
+			PROPERTY(m_team);
+			int32_t m_team = 0;
+
+			PROPERTY(m_state);
+			int32_t m_state = 0;
+
+			PROPERTY(m_flags);
+			int32_t m_flags = 0;
+
+			PROPERTY(m_target);
+			int32_t m_target = -1;
+
+			PROPERTY(m_x);
+			float m_x = 0.0f;
+
+			PROPERTY(m_y);
+			float m_y = 0.0f;
+
+			PROPERTY(m_z);
+			float m_z = 0.0f;
+
+			PROPERTY(m_yaw);
+			float m_yaw = 0.0f;
+
+			PROPERTY(m_speed);
+			float m_speed = 1.0f;
+
+			PROPERTY(m_scale);
+			float m_scale = 1.0f;
+
+			PROPERTY(m_name);
+			std::string m_name;
+
+			PROPERTY(m_inventory);
+			std::vector<int32_t> m_inventory;
+	};
+
+	/**
+	 * @brief	Changes the property at the given ordinal, using the compile-time property list.
+	 */
+	void Mutate(Entity& entity, size_t ordinal)
+	{
+		size_t index = 0;
+
+		Reflection::ForEachProperty(entity, [&](const auto&, auto& value)
+		{
+			using Value = Reflection::Utils::RemoveConst_t<Reflection::Utils::RemoveReference_t<decltype(value)>>;
+
+			if (index++ != ordinal)
+			{
+				return;
+			}
+
+			if constexpr (std::is_arithmetic<Value>::value)
+			{
+				value = static_cast<Value>(value + 1);
+			}
+			else if constexpr (Reflection::Utils::IsSame<Value, std::string>::value)
+			{
+				value.push_back('!');
+			}
+			else
+			{
+				value[value.size() / 2] += 1;
+			}
+		});
+	}
+}
+
+namespace Bench
+{
+	void Diff()
+	{
+		constexpr size_t ObjectCount = 10000;
+		constexpr size_t Repetitions = 50;
+
+		const Reflection::TypeInfo* typeInfo = Entity::GetStaticTypeInfo();
+		const size_t propertyCount = typeInfo->GetPropertyList().size();
+		const size_t changeCount = ObjectCount * propertyCount / 100;
+
+		std::vector<Entity> previous(ObjectCount);
+		for (size_t index = 0; index < ObjectCount; ++index)
+		{
+			Entity& entity = previous[index];
+			entity.m_id = index;
+			entity.m_name = "Entity_" + std::to_string(index);
+			entity.m_inventory.assign(8, static_cast<int32_t>(index));
+		}
+
+		std::vector<Entity> current = previous;
+
+		Random random(0x5EEDull);
+		for (size_t change = 0; change < changeCount; ++change)
+		{
+			Mutate(current[random.Range(ObjectCount)], random.Range(propertyCount));
+		}
+
+		std::printf("[ Diff ] %zu objects, %zu properties, %zu changes (1%%)\n", ObjectCount, propertyCount, changeCount);
+
+		Reflection::PropertyDiff diff;
+		size_t changedProperties = 0;
+
+		Measure("TypeInfo::Diff", Repetitions, ObjectCount, [&]()
+		{
+			changedProperties = 0;
+
+			for (size_t index = 0; index < ObjectCount; ++index)
+			{
+				if (typeInfo->Diff(&previous[index], &current[index], diff))
+				{
+					changedProperties += diff.GetMask().Count();
+				}
+			}
+
+			DoNotOptimize(changedProperties);
+		});
+
+		Measure("TypeInfo::Equals (baseline)", Repetitions, ObjectCount, [&]()
+		{
+			size_t changedObjects = 0;
+
+			for (size_t index = 0; index < ObjectCount; ++index)
+			{
+				changedObjects += typeInfo->Equals(&previous[index], &current[index]) ? 0 : 1;
+			}
+
+			DoNotOptimize(changedObjects);
+		});
+
+		std::vector<Reflection::PropertyDiff> diffs(ObjectCount);
+		for (size_t index = 0; index < ObjectCount; ++index)
+		{
+			typeInfo->Diff(&previous[index], &current[index], diffs[index]);
+		}
+
+		std::vector<Entity> replica = previous;
+
+		Measure("TypeInfo::ApplyDiff", Repetitions, ObjectCount, [&]()
+		{
+			for (size_t index = 0; index < ObjectCount; ++index)
+			{
+				typeInfo->ApplyDiff(&replica[index], diffs[index]);
+			}
+
+			DoNotOptimize(replica);
+		});
+
+		size_t mismatches = 0;
+		for (size_t index = 0; index < ObjectCount; ++index)
+		{
+			mismatches += typeInfo->Equals(&replica[index], &current[index]) ? 0 : 1;
+		}
+
+		Measure("Copy assignment (baseline)", Repetitions, ObjectCount, [&]()
+		{
+			for (size_t index = 0; index < ObjectCount; ++index)
+			{
+				replica[index] = current[index];
+			}
+
+			DoNotOptimize(replica);
+		});
+
+		std::printf("  changed properties found : %zu / replica mismatches : %zu\n\n", changedProperties, mismatches);
+	}
+}
\ No newline at end of file
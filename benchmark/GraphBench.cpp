@@ -0,0 +1,162 @@
+#include "Benchmark.h"
+
+#include <Reflection.h>
+
+#include <atomic>
+#include <unordered_set>
+#include <vector>
+
+namespace
+{
+	class GraphNode
+	{
+		GENERATE(GraphNode);
+
+		public :
+			PROPERTY(m_children);
+			std::vector<GraphNode*> m_children;
+
+			PROPERTY(m_link);
+			GraphNode* m_link = nullptr;
+
+			PROPERTY(m_weight);
+			int m_weight = 1;
+	};
+}
+
+namespace Bench
+{
+	void Graph()
+	{
+		constexpr size_t NodeCount = 1 << 20;
+		constexpr size_t Repetitions = 5;
+
+		// A random tree with a random cross link per node, the last 1/16 of the nodes left unreachable.
+		std::vector<GraphNode> nodes(NodeCount);
+		const size_t reachableCount = NodeCount - NodeCount / 16;
+
+		Random random(7);
+		for (size_t index = 1; index < reachableCount; ++index)
+		{
+			nodes[random.Range(index)].m_children.push_back(&nodes[index]);
+			nodes[index].m_link = &nodes[random.Range(reachableCount)];
+		}
+
+		GraphNode* root = &nodes.front();
+
+		std::printf("[ Graph ] %zu nodes, %zu reachable, %zu workers\n", NodeCount, reachableCount, Reflection::JobSystem::GetHandle().GetWorkerCount());
+
+		size_t directCount = 0;
+		const double direct = Measure("DFS unordered_set", Repetitions, NodeCount, [&]()
+		{
+			std::unordered_set<const GraphNode*> visited;
+			std::vector<GraphNode*> worklist{ root };
+			visited.insert(root);
+
+			while (!worklist.empty())
+			{
+				GraphNode* node = worklist.back();
+				worklist.pop_back();
+
+				for (GraphNode* child : node->m_children)
+				{
+					if (visited.insert(child).second)
+					{
+						worklist.push_back(child);
+					}
+				}
+
+				if ((nullptr != node->m_link) && visited.insert(node->m_link).second)
+				{
+					worklist.push_back(node->m_link);
+				}
+			}
+
+			directCount = visited.size();
+			DoNotOptimize(directCount);
+		});
+
+		Measure("DFS PointerSet", Repetitions, NodeCount, [&]()
+		{
+			Reflection::PointerSet visited;
+			std::vector<GraphNode*> worklist{ root };
+			visited.Insert(root);
+
+			while (!worklist.empty())
+			{
+				GraphNode* node = worklist.back();
+				worklist.pop_back();
+
+				for (GraphNode* child : node->m_children)
+				{
+					if (visited.Insert(child))
+					{
+						worklist.push_back(child);
+					}
+				}
+
+				if ((nullptr != node->m_link) && visited.Insert(node->m_link))
+				{
+					worklist.push_back(node->m_link);
+				}
+			}
+
+			DoNotOptimize(visited.GetSize());
+		});
+
+		size_t sequentialCount = 0;
+		const double sequential = Measure("VisitReferences Sequential", Repetitions, NodeCount, [&]()
+		{
+			int weight = 0;
+			sequentialCount = Reflection::VisitReferences(root, [&weight](const Reflection::TypeInfo*, void* object)
+			{
+				weight += static_cast<GraphNode*>(object)->m_weight;
+			});
+
+			DoNotOptimize(weight);
+		});
+
+		Overhead(sequential, direct);
+
+		size_t parallelCount = 0;
+		const double parallel = Measure("VisitReferences Parallel", Repetitions, NodeCount, [&]()
+		{
+			std::atomic<int> weight{ 0 };
+			parallelCount = Reflection::VisitReferences(root, [&weight](const Reflection::TypeInfo*, void* object)
+			{
+				weight.fetch_add(static_cast<GraphNode*>(object)->m_weight, std::memory_order_relaxed);
+			}, Reflection::TraversalMode::Parallel);
+
+			DoNotOptimize(weight);
+		});
+
+		std::printf("  %-36s %12.2fx\n", "  speedup vs Sequential", (0.0 < parallel) ? sequential / parallel : 0.0);
+		std::printf("  %-36s %s\n", "same reachable set", ((directCount == reachableCount) && (sequentialCount == reachableCount) && (parallelCount == reachableCount)) ? "yes" : "no");
+
+		std::vector<char> buffer;
+		Measure("GraphWriter", Repetitions, NodeCount, [&]()
+		{
+			Reflection::GraphWriter writer;
+			writer.Write(*root);
+
+			buffer = writer.GetBuffer();
+			DoNotOptimize(buffer.data());
+		});
+
+		size_t loadedCount = 0;
+		Reflection::Arena arena(1 << 20);
+		Measure("GraphReader (batched allocation)", Repetitions, NodeCount, [&]()
+		{
+			arena.Reset();
+
+			Reflection::GraphReader reader(buffer.data(), buffer.size());
+			reader.Read(arena);
+
+			loadedCount = reader.GetObjectCount();
+			DoNotOptimize(reader.GetRoot<GraphNode>());
+		});
+
+		std::printf("  %-36s %zu bytes, %zu objects\n", "archive", buffer.size(), loadedCount);
+		std::printf("\n");
+	}
+}
\ No newline at end of file
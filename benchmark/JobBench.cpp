@@ -0,0 +1,110 @@
+#include "Benchmark.h"
+
+#include <Reflection.h>
+
+#include <vector>
+
+namespace
+{
+	class JobAsset
+	{
+		GENERATE(JobAsset);
+
+		public :
+			virtual ~JobAsset() = default;
+
+		public :
+			METHOD(Rebuild, ThreadSafe);
+			void Rebuild(int passes)
+			{
+				for (int pass = 0; pass < passes; ++pass)
+				{
+					m_checksum = m_checksum * 6364136223846793005ull + static_cast<uint64_t>(pass);
+				}
+			}
+
+			METHOD(RebuildSerial);
+			void RebuildSerial(int passes)
+			{
+				Rebuild(passes);
+			}
+
+		public :
+			PROPERTY(m_checksum);
+			uint64_t m_checksum = 1;
+	};
+}
+
+namespace Bench
+{
+	void Job()
+	{
+		constexpr size_t AssetCount = 20000;
+		constexpr size_t Repetitions = 10;
+		constexpr int Passes = 2000;
+
+		std::vector<JobAsset> assets(AssetCount);
+		std::vector<JobAsset*> pointers;
+		pointers.reserve(AssetCount);
+
+		for (JobAsset& asset : assets)
+		{
+			pointers.push_back(&asset);
+		}
+
+		const Reflection::TypeInfo* assetType = JobAsset::GetStaticTypeInfo();
+		const Reflection::MethodInfo* rebuild = assetType->GetMethod(std::string(assetType->GetTypeName()) + "::Rebuild");
+		const Reflection::MethodInfo* rebuildSerial = assetType->GetMethod(std::string(assetType->GetTypeName()) + "::RebuildSerial");
+
+		if ((nullptr == rebuild) || (nullptr == rebuildSerial))
+		{
+			return;
+		}
+
+		std::printf("[ Job ] %zu assets, %d passes per call, %zu workers\n", AssetCount, Passes, Reflection::JobSystem::GetHandle().GetWorkerCount());
+
+		const double serial = Measure("Invoke loop", Repetitions, AssetCount, [&]()
+		{
+			for (JobAsset* asset : pointers)
+			{
+				rebuild->Invoke<void>(*asset, Passes);
+			}
+
+			DoNotOptimize(assets.back().m_checksum);
+		});
+
+		Measure("ParallelInvoke not ThreadSafe", Repetitions, AssetCount, [&]()
+		{
+			rebuildSerial->ParallelInvoke<void>(pointers.data(), pointers.size(), Passes);
+			DoNotOptimize(assets.back().m_checksum);
+		});
+
+		const double parallel = Measure("ParallelInvoke ThreadSafe", Repetitions, AssetCount, [&]()
+		{
+			rebuild->ParallelInvoke<void>(pointers.data(), pointers.size(), Passes);
+			DoNotOptimize(assets.back().m_checksum);
+		});
+
+		std::printf("  %-36s %12.2fx\n", "  speedup vs Invoke loop", (0.0 < parallel) ? serial / parallel : 0.0);
+
+		std::vector<Reflection::MethodFuture<void>> futures;
+		futures.reserve(AssetCount);
+
+		Measure("InvokeAsync per asset", Repetitions, AssetCount, [&]()
+		{
+			futures.clear();
+
+			for (JobAsset& asset : assets)
+			{
+				futures.push_back(rebuild->InvokeAsync<void>(asset, Passes));
+			}
+
+			for (const Reflection::MethodFuture<void>& future : futures)
+			{
+				future.Wait();
+			}
+		});
+
+		std::printf("\n");
+	}
+}
\ No newline at end of file
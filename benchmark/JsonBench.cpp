@@ -0,0 +1,151 @@
+#include "Benchmark.h"
+
+#include <Reflection.h>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+	class Record
+	{
+		GENERATE(Record);
+
+		public :
+			PROPERTY(m_id);
+			uint64_t m_id = 0;
+
+			PROPERTY(m_alive);
+			bool m_alive = true;
+
+			PROPERTY(m_health);
+			int32_t m_health = 100;
+
+			PROPERTY(m_x);
+			float m_x = 0.0f;
+
+			PROPERTY(m_y);
+			float m_y = 0.0f;
+
+			PROPERTY(m_z);
+			float m_z = 0.0f;
+
+			PROPERTY(m_score);
+			double m_score = 0.0;
+
+			PROPERTY(m_kind);
+			std::string_view m_kind;
+
+			PROPERTY(m_name);
+			std::string m_name;
+
+			PROPERTY(m_tags);
+			std::vector<int32_t> m_tags;
+	};
+
+	class Document
+	{
+		GENERATE(Document);
+
+		public :
+			PROPERTY(m_records);
+			std::vector<Record> m_records;
+	};
+
+	void PrintThroughput(const char* name, size_t bytes, double nanoseconds)
+	{
+		const double megabytes = static_cast<double>(bytes) / (1024.0 * 1024.0);
+		const double seconds = nanoseconds / 1000000000.0;
+
+		std::printf("  %-36s %12.1f MB/s\n", name, megabytes / seconds);
+	}
+}
+
+namespace Bench
+{
+	void Json()
+	{
+		constexpr size_t TargetBytes = 100 * 1024 * 1024;
+		constexpr size_t Repetitions = 3;
+		constexpr std::string_view Kinds[] = { "player", "monster", "projectile", "pickup" };
+
+		Random random(0x15011ull);
+
+		Record sample;
+		sample.m_name = "Record_000000";
+		sample.m_kind = Kinds[0];
+		sample.m_tags.assign(8, 1000);
+
+		char sampleBuffer[4096];
+		Reflection::JsonWriter sampleWriter(sampleBuffer, sizeof(sampleBuffer));
+		sampleWriter.Write(sample);
+
+		const size_t recordCount = TargetBytes / sampleWriter.GetWrittenBytes();
+
+		Document document;
+		document.m_records.resize(recordCount);
+		for (size_t index = 0; index < recordCount; ++index)
+		{
+			Record& record = document.m_records[index];
+			record.m_id = index;
+			record.m_alive = 0 != (index & 1);
+			record.m_health = static_cast<int32_t>(random.Range(1000));
+			record.m_x = static_cast<float>(random.Range(100000)) * 0.01f;
+			record.m_y = static_cast<float>(random.Range(100000)) * 0.01f;
+			record.m_z = static_cast<float>(random.Range(100000)) * 0.01f;
+			record.m_score = static_cast<double>(random.Next() % 1000000) / 7.0;
+			record.m_kind = Kinds[random.Range(4)];
+			record.m_name = "Record_" + std::to_string(index);
+			record.m_tags.resize(random.Range(8) + 1);
+
+			for (int32_t& tag : record.m_tags)
+			{
+				tag = static_cast<int32_t>(random.Range(100000));
+			}
+		}
+
+		std::string json;
+		json.reserve(TargetBytes + TargetBytes / 4);
+
+		std::vector<char> buffer(64 * 1024);
+
+		auto write = [&]()
+		{
+			json.clear();
+
+			Reflection::JsonWriter writer(buffer.data(), buffer.size(), [&](const char* data, size_t size)
+			{
+				json.append(data, size);
+				return true;
+			});
+
+			writer.Write(document);
+			writer.Flush();
+		};
+
+		write();
+
+		std::printf("[ Json ] %zu records, %.1f MB document\n", recordCount, static_cast<double>(json.size()) / (1024.0 * 1024.0));
+
+		const double writeTime = Measure("JsonWriter::Write", Repetitions, recordCount, write);
+		PrintThroughput("JsonWriter::Write throughput", json.size(), writeTime);
+
+		Document parsed;
+		bool succeeded = true;
+
+		const double readTime = Measure("JsonReader::Read", Repetitions, recordCount, [&]()
+		{
+			Reflection::JsonReader reader(json);
+			succeeded = reader.Read(parsed) && succeeded;
+
+			DoNotOptimize(parsed);
+		});
+		PrintThroughput("JsonReader::Read throughput", json.size(), readTime);
+
+		const Reflection::TypeInfo* typeInfo = Document::GetStaticTypeInfo();
+
+		std::printf("  parse succeeded : %s / round trip equal : %s\n\n", succeeded ? "yes" : "no",
+			typeInfo->Equals(&document, &parsed) ? "yes" : "no");
+	}
+}
\ No newline at end of file
@@ -0,0 +1,141 @@
+#include "Benchmark.h"
+
+#include <Reflection.h>
+
+#include <string>
+#include <vector>
+
+namespace
+{
+	class PathVector
+	{
+		GENERATE(PathVector);
+
+		public :
+			virtual ~PathVector() = default;
+
+		public :
+			PROPERTY(x);
+			float x = 0.0f;
+
+			PROPERTY(y);
+			float y = 0.0f;
+
+			PROPERTY(z);
+			float z = 0.0f;
+	};
+
+	class PathTransform
+	{
+		GENERATE(PathTransform);
+
+		public :
+			virtual ~PathTransform() = default;
+
+		public :
+			PROPERTY(m_position);
+			PathVector m_position;
+
+			PROPERTY(m_scale);
+			PathVector m_scale;
+	};
+
+	class PathEntity
+	{
+		GENERATE(PathEntity);
+
+		public :
+			virtual ~PathEntity() = default;
+
+		public :
+			PROPERTY(m_transform);
+			PathTransform m_transform;
+
+			PROPERTY(m_parent);
+			PathEntity* m_parent = nullptr;
+	};
+}
+
+namespace Bench
+{
+	void Path()
+	{
+		constexpr size_t EntityCount = 100000;
+		constexpr size_t Repetitions = 20;
+
+		std::vector<PathEntity> parents(EntityCount);
+		std::vector<PathEntity> entities(EntityCount);
+
+		for (size_t index = 0; index < EntityCount; ++index)
+		{
+			parents[index].m_transform.m_position.y = static_cast<float>(index);
+			entities[index].m_parent = &parents[index];
+		}
+
+		const Reflection::TypeInfo* entityType = PathEntity::GetStaticTypeInfo();
+
+		std::printf("[ PropertyPath ] %zu entities, \"m_parent->m_transform.m_position.y\"\n", EntityCount);
+
+		const Reflection::TypeInfo* transformType = PathTransform::GetStaticTypeInfo();
+		const Reflection::TypeInfo* vectorType = PathVector::GetStaticTypeInfo();
+
+		const std::string parentName = std::string(entityType->GetTypeName()) + "::m_parent";
+		const std::string transformName = std::string(entityType->GetTypeName()) + "::m_transform";
+		const std::string positionName = std::string(transformType->GetTypeName()) + "::m_position";
+		const std::string yName = std::string(vectorType->GetTypeName()) + "::y";
+
+		float lookupSum = 0.0f;
+		Measure("GetProperty per level", Repetitions, EntityCount, [&]()
+		{
+			lookupSum = 0.0f;
+
+			for (PathEntity& entity : entities)
+			{
+				const Reflection::PropertyInfo* parent = entityType->GetProperty(parentName);
+				PathEntity* parentEntity = parent->Get<PathEntity*>(entity);
+
+				const Reflection::PropertyInfo* transform = entityType->GetProperty(transformName);
+				PathTransform* parentTransform = transform->Get<PathTransform>(*parentEntity);
+
+				const Reflection::PropertyInfo* position = transformType->GetProperty(positionName);
+				PathVector* parentPosition = position->Get<PathVector>(*parentTransform);
+
+				const Reflection::PropertyInfo* y = vectorType->GetProperty(yName);
+				lookupSum += *y->Get<float>(*parentPosition);
+			}
+
+			DoNotOptimize(lookupSum);
+		});
+
+		const Reflection::PropertyPath path = Reflection::PropertyPath::Compile(entityType, "m_parent->m_transform.m_position.y");
+
+		float pathSum = 0.0f;
+		Measure("PropertyPath::Get", Repetitions, EntityCount, [&]()
+		{
+			pathSum = 0.0f;
+
+			for (PathEntity& entity : entities)
+			{
+				pathSum += *path.Get<float>(entity);
+			}
+
+			DoNotOptimize(pathSum);
+		});
+
+		float directSum = 0.0f;
+		Measure("Direct member access", Repetitions, EntityCount, [&]()
+		{
+			directSum = 0.0f;
+
+			for (PathEntity& entity : entities)
+			{
+				directSum += entity.m_parent->m_transform.m_position.y;
+			}
+
+			DoNotOptimize(directSum);
+		});
+
+		std::printf("  %-36s %s\n", "same result", ((lookupSum == pathSum) && (pathSum == directSum)) ? "yes" : "no");
+		std::printf("\n");
+	}
+}
\ No newline at end of file
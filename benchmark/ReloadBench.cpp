@@ -0,0 +1,189 @@
+#include "Benchmark.h"
+
+#include <Reflection.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+namespace
+{
+#if defined(REFLECTION_PLUGIN_PATH)
+	void* OpenPlugin(const char* path)
+	{
+#if defined(_WIN32)
+		return static_cast<void*>(LoadLibraryA(path));
+#else
+		return dlopen(path, RTLD_NOW | RTLD_LOCAL);
+#endif
+	}
+
+	void ClosePlugin(void* handle)
+	{
+#if defined(_WIN32)
+		FreeLibrary(static_cast<HMODULE>(handle));
+#else
+		dlclose(handle);
+#endif
+	}
+
+	bool IsPluginLoaded(const char* path)
+	{
+#if defined(_WIN32)
+		return nullptr != GetModuleHandleA(path);
+#else
+		void* handle = dlopen(path, RTLD_NOW | RTLD_NOLOAD);
+		if (nullptr != handle)
+		{
+			dlclose(handle);
+		}
+
+		return nullptr != handle;
+#endif
+	}
+
+	/**
+	 * @brief	Reads the metadata of a plugin type the way an editor or a serializer would.
+	 */
+	size_t TouchType(const Reflection::TypeInfo* type)
+	{
+		size_t sum = type->GetTypeName().size() + type->GetTypeSize();
+
+		for (const Reflection::PropertyInfo* property : type->GetPropertyList())
+		{
+			sum += property->GetPropertyName().size() + property->GetPropertyOffset();
+		}
+
+		for (const auto& [name, method] : type->GetMethods())
+		{
+			sum += name.size();
+		}
+
+		return sum;
+	}
+#endif
+}
+
+namespace Bench
+{
+	void Reload()
+	{
+#if defined(REFLECTION_PLUGIN_PATH)
+		constexpr size_t Iterations = 200;
+		constexpr size_t ReaderCount = 3;
+
+		const char* path = REFLECTION_PLUGIN_PATH;
+
+		Reflection::TypeManager& typeManager = Reflection::TypeManager::GetHandle();
+		const Reflection::TypeManager::ModuleId module = typeManager.CreateModule("ReloadPlugin");
+
+		std::printf("[ Reload ] %zu load / unregister / unload cycles, %zu readers\n", Iterations, ReaderCount);
+
+		std::atomic<bool> isRunning{ true };
+		std::atomic<size_t> hits{ 0 };
+		std::atomic<size_t> misses{ 0 };
+
+		std::vector<std::thread> readers;
+		for (size_t index = 0; index < ReaderCount; ++index)
+		{
+			readers.emplace_back([&]()
+			{
+				size_t localHits = 0;
+				size_t localMisses = 0;
+				size_t sum = 0;
+
+				while (isRunning.load(std::memory_order_relaxed))
+				{
+					Reflection::TypeManager::ReadGuard guard;
+
+					for (const char* name : { "ReloadWidget", "ReloadButton" })
+					{
+						if (const Reflection::TypeInfo* type = typeManager.FindType(name))
+						{
+							sum += TouchType(type);
+							++localHits;
+						}
+						else
+						{
+							++localMisses;
+						}
+					}
+				}
+
+				DoNotOptimize(sum);
+				hits.fetch_add(localHits, std::memory_order_relaxed);
+				misses.fetch_add(localMisses, std::memory_order_relaxed);
+			});
+		}
+
+		size_t failures = 0;
+		size_t stillLoaded = 0;
+		size_t removed = 0;
+
+		const uint64_t firstGeneration = typeManager.GetGeneration();
+
+		double loadTime = 0.0;
+		double unloadTime = 0.0;
+
+		for (size_t iteration = 0; iteration < Iterations; ++iteration)
+		{
+			void* handle = nullptr;
+
+			const auto loadStart = std::chrono::steady_clock::now();
+			{
+				Reflection::TypeManager::ModuleScope scope(module);
+				handle = OpenPlugin(path);
+			}
+			loadTime += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - loadStart).count();
+
+			if (nullptr == handle)
+			{
+				++failures;
+				break;
+			}
+
+			failures += (nullptr == typeManager.FindType("ReloadButton")) ? 1 : 0;
+
+			// Leaves the readers a window in which the plugin types are visible.
+			std::this_thread::sleep_for(std::chrono::microseconds(500));
+
+			const auto unloadStart = std::chrono::steady_clock::now();
+			removed += typeManager.UnregistModule(module);
+			ClosePlugin(handle);
+			unloadTime += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - unloadStart).count();
+
+			failures += (nullptr != typeManager.FindType("ReloadButton")) ? 1 : 0;
+			stillLoaded += IsPluginLoaded(path) ? 1 : 0;
+		}
+
+		isRunning.store(false, std::memory_order_relaxed);
+		for (std::thread& reader : readers)
+		{
+			reader.join();
+		}
+
+		const double perLoad = loadTime / static_cast<double>(Iterations);
+		const double perUnload = unloadTime / static_cast<double>(Iterations);
+
+		GetResults().push_back({ GetSuite(), "Load and register", Iterations, 1, perLoad * 1000.0, perLoad * 1000.0 });
+		GetResults().push_back({ GetSuite(), "Unregister and unload", Iterations, 1, perUnload * 1000.0, perUnload * 1000.0 });
+
+		std::printf("  %-36s %12.1f us/cycle\n", "Load and register", perLoad);
+		std::printf("  %-36s %12.1f us/cycle\n", "Unregister and unload", perUnload);
+		std::printf("  %-36s %zu types, %llu generations\n", "unregistered", removed, static_cast<unsigned long long>(typeManager.GetGeneration() - firstGeneration));
+		std::printf("  %-36s %zu found, %zu missing\n", "reader lookups", hits.load(), misses.load());
+		std::printf("  %-36s %s\n", "library unloaded", (0 == stillLoaded) ? "yes" : "no");
+		std::printf("  %-36s %s\n", "registry consistent", (0 == failures) ? "yes" : "no");
+		std::printf("\n");
+#else
+		std::printf("[ Reload ] skipped : the reflection library is not shared\n\n");
+#endif
+	}
+}
\ No newline at end of file
@@ -0,0 +1,203 @@
+#include "Benchmark.h"
+
+#include <Reflection.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+	struct SoAParticle
+	{
+		GENERATE_POD(SoAParticle);
+
+		public :
+			PROPERTY(m_x);
+			float m_x = 0.0f;
+
+			PROPERTY(m_y);
+			float m_y = 0.0f;
+
+			PROPERTY(m_z);
+			float m_z = 0.0f;
+
+			PROPERTY(m_vx);
+			float m_vx = 0.0f;
+
+			PROPERTY(m_vy);
+			float m_vy = 0.0f;
+
+			PROPERTY(m_vz);
+			float m_vz = 0.0f;
+
+			PROPERTY(m_ax);
+			float m_ax = 0.0f;
+
+			PROPERTY(m_ay);
+			float m_ay = 0.0f;
+
+			PROPERTY(m_az);
+			float m_az = 0.0f;
+
+			PROPERTY(m_age);
+			float m_age = 0.0f;
+
+			PROPERTY(m_mass);
+			float m_mass = 1.0f;
+
+			PROPERTY(m_lifetime);
+			float m_lifetime = 0.0f;
+
+			PROPERTY(m_color);
+			uint32_t m_color = 0;
+
+			PROPERTY(m_flags);
+			uint32_t m_flags = 0;
+
+			PROPERTY(m_id);
+			uint32_t m_id = 0;
+
+			PROPERTY(m_group);
+			uint32_t m_group = 0;
+	};
+}
+
+namespace Bench
+{
+	void SoA()
+	{
+		constexpr size_t Count = 1 << 20;
+		constexpr size_t Repetitions = 20;
+		constexpr float DeltaTime = 1.0f / 60.0f;
+
+		std::printf("[ SoA ] %zu particles of %zu bytes\n", Count, sizeof(SoAParticle));
+
+		std::vector<SoAParticle> aos(Count);
+		Reflection::SoAVector<SoAParticle> soa;
+		soa.Reserve(Count);
+
+		Random random(7);
+		for (size_t index = 0; index < Count; ++index)
+		{
+			SoAParticle& particle = aos[index];
+			particle.m_vx = static_cast<float>(random.Range(100)) * 0.01f;
+			particle.m_mass = static_cast<float>(random.Range(100)) * 0.1f;
+			particle.m_color = static_cast<uint32_t>(random.Next());
+			particle.m_id = static_cast<uint32_t>(index);
+
+			soa.PushBack(particle);
+		}
+
+		Measure("PushBack std::vector", 5, Count, [&]()
+		{
+			std::vector<SoAParticle> copy;
+			copy.reserve(Count);
+
+			for (const SoAParticle& particle : aos)
+			{
+				copy.push_back(particle);
+			}
+
+			DoNotOptimize(copy.data());
+		});
+
+		Measure("PushBack SoAVector", 5, Count, [&]()
+		{
+			Reflection::SoAVector<SoAParticle> copy;
+			copy.Reserve(Count);
+
+			for (const SoAParticle& particle : aos)
+			{
+				copy.PushBack(particle);
+			}
+
+			DoNotOptimize(copy.GetSize());
+		});
+
+		// One field : the sweep only needs 4 of the 64 bytes of every particle.
+		const double aosSum = Measure("Sum m_mass std::vector", Repetitions, Count, [&]()
+		{
+			float sum = 0.0f;
+			for (const SoAParticle& particle : aos)
+			{
+				sum += particle.m_mass;
+			}
+
+			DoNotOptimize(sum);
+		});
+
+		const double soaSum = Measure("Sum m_mass SoAVector column", Repetitions, Count, [&]()
+		{
+			float sum = 0.0f;
+			for (const float mass : soa.GetColumn<&SoAParticle::m_mass>())
+			{
+				sum += mass;
+			}
+
+			DoNotOptimize(sum);
+		});
+
+		Overhead(soaSum, aosSum);
+
+		Measure("Sum m_mass SoAVector rows", Repetitions, Count, [&]()
+		{
+			float sum = 0.0f;
+			for (size_t index = 0; index < Count; ++index)
+			{
+				sum += soa[index].Get<&SoAParticle::m_mass>();
+			}
+
+			DoNotOptimize(sum);
+		});
+
+		Measure("Count m_color std::vector", Repetitions, Count, [&]()
+		{
+			size_t count = 0;
+			for (const SoAParticle& particle : aos)
+			{
+				count += (particle.m_color & 1);
+			}
+
+			DoNotOptimize(count);
+		});
+
+		Measure("Count m_color SoAVector column", Repetitions, Count, [&]()
+		{
+			size_t count = 0;
+			for (const uint32_t color : soa.GetColumn<&SoAParticle::m_color>())
+			{
+				count += (color & 1);
+			}
+
+			DoNotOptimize(count);
+		});
+
+		// Two fields : m_x += m_vx * dt.
+		const double aosIntegrate = Measure("Integrate m_x std::vector", Repetitions, Count, [&]()
+		{
+			for (SoAParticle& particle : aos)
+			{
+				particle.m_x += particle.m_vx * DeltaTime;
+			}
+
+			DoNotOptimize(aos.data());
+		});
+
+		const double soaIntegrate = Measure("Integrate m_x SoAVector columns", Repetitions, Count, [&]()
+		{
+			const Reflection::ColumnSpan<float> x = soa.GetColumn<&SoAParticle::m_x>();
+			const Reflection::ColumnSpan<const float> vx = static_cast<const Reflection::SoAVector<SoAParticle>&>(soa).GetColumn<&SoAParticle::m_vx>();
+
+			for (size_t index = 0; index < x.size(); ++index)
+			{
+				x[index] += vx[index] * DeltaTime;
+			}
+
+			DoNotOptimize(x.data());
+		});
+
+		Overhead(soaIntegrate, aosIntegrate);
+
+		std::printf("\n");
+	}
+}
\ No newline at end of file
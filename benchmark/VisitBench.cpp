@@ -0,0 +1,167 @@
+#include "Benchmark.h"
+
+#include <Reflection.h>
+
+#include <utility>
+#include <vector>
+
+namespace
+{
+	class VisitEvent
+	{
+		GENERATE(VisitEvent);
+
+		public :
+			virtual ~VisitEvent() = default;
+
+		public :
+			int m_payload = 1;
+	};
+
+	class VisitInput : public VisitEvent { GENERATE(VisitInput); };
+	class VisitKey : public VisitInput { GENERATE(VisitKey); };
+	class VisitMouse : public VisitInput { GENERATE(VisitMouse); };
+	class VisitNetwork : public VisitEvent { GENERATE(VisitNetwork); };
+	class VisitPacket : public VisitNetwork { GENERATE(VisitPacket); };
+	class VisitTimer : public VisitEvent { GENERATE(VisitTimer); };
+	class VisitResize : public VisitEvent { GENERATE(VisitResize); };
+}
+
+namespace Bench
+{
+	void Visit()
+	{
+		constexpr size_t EventCount = 4096;
+		constexpr size_t Passes = 64;
+		constexpr size_t Repetitions = 10;
+
+		std::vector<VisitKey> keys(EventCount / 8);
+		std::vector<VisitMouse> mice(EventCount / 8);
+		std::vector<VisitPacket> packets(EventCount / 8);
+		std::vector<VisitNetwork> networks(EventCount / 8);
+		std::vector<VisitTimer> timers(EventCount / 8);
+		std::vector<VisitResize> resizes(EventCount / 8);
+		std::vector<VisitInput> inputs(EventCount / 8);
+		std::vector<VisitEvent> events(EventCount / 8);
+
+		std::vector<VisitEvent*> queue;
+		queue.reserve(EventCount);
+
+		Random random(42);
+		for (size_t index = 0; index < EventCount / 8; ++index)
+		{
+			VisitEvent* batch[] = { &keys[index], &mice[index], &packets[index], &networks[index], &timers[index], &resizes[index], &inputs[index], &events[index] };
+			for (VisitEvent* event : batch)
+			{
+				queue.push_back(event);
+			}
+		}
+
+		// Shuffled, so the dynamic type of the next event is not predictable.
+		for (size_t index = queue.size() - 1; 0 < index; --index)
+		{
+			std::swap(queue[index], queue[random.Range(index + 1)]);
+		}
+
+		const size_t items = EventCount * Passes;
+		std::printf("[ Visit ] %zu events of 8 types, 7 handlers, %zu passes\n", EventCount, Passes);
+
+		int chainSum = 0;
+		const double chain = Measure("Cast if-chain", Repetitions, items, [&]()
+		{
+			chainSum = 0;
+			for (size_t pass = 0; pass < Passes; ++pass)
+			{
+				for (VisitEvent* event : queue)
+				{
+					if (VisitKey* key = Reflection::Cast<VisitKey*>(event)) { chainSum += key->m_payload * 1; }
+					else if (VisitMouse* mouse = Reflection::Cast<VisitMouse*>(event)) { chainSum += mouse->m_payload * 2; }
+					else if (VisitInput* input = Reflection::Cast<VisitInput*>(event)) { chainSum += input->m_payload * 3; }
+					else if (VisitPacket* packet = Reflection::Cast<VisitPacket*>(event)) { chainSum += packet->m_payload * 4; }
+					else if (VisitNetwork* network = Reflection::Cast<VisitNetwork*>(event)) { chainSum += network->m_payload * 5; }
+					else if (VisitTimer* timer = Reflection::Cast<VisitTimer*>(event)) { chainSum += timer->m_payload * 6; }
+					else { chainSum += event->m_payload * 7; }
+				}
+			}
+
+			DoNotOptimize(chainSum);
+		});
+
+		int dynamicSum = 0;
+		Measure("dynamic_cast if-chain", Repetitions, items, [&]()
+		{
+			dynamicSum = 0;
+			for (size_t pass = 0; pass < Passes; ++pass)
+			{
+				for (VisitEvent* event : queue)
+				{
+					if (VisitKey* key = dynamic_cast<VisitKey*>(event)) { dynamicSum += key->m_payload * 1; }
+					else if (VisitMouse* mouse = dynamic_cast<VisitMouse*>(event)) { dynamicSum += mouse->m_payload * 2; }
+					else if (VisitInput* input = dynamic_cast<VisitInput*>(event)) { dynamicSum += input->m_payload * 3; }
+					else if (VisitPacket* packet = dynamic_cast<VisitPacket*>(event)) { dynamicSum += packet->m_payload * 4; }
+					else if (VisitNetwork* network = dynamic_cast<VisitNetwork*>(event)) { dynamicSum += network->m_payload * 5; }
+					else if (VisitTimer* timer = dynamic_cast<VisitTimer*>(event)) { dynamicSum += timer->m_payload * 6; }
+					else { dynamicSum += event->m_payload * 7; }
+				}
+			}
+
+			DoNotOptimize(dynamicSum);
+		});
+
+		int switchSum = 0;
+		const Reflection::TypeSwitch dispatch
+		{
+			[&switchSum](VisitKey& key) { switchSum += key.m_payload * 1; },
+			[&switchSum](VisitMouse& mouse) { switchSum += mouse.m_payload * 2; },
+			[&switchSum](VisitInput& input) { switchSum += input.m_payload * 3; },
+			[&switchSum](VisitPacket& packet) { switchSum += packet.m_payload * 4; },
+			[&switchSum](VisitNetwork& network) { switchSum += network.m_payload * 5; },
+			[&switchSum](VisitTimer& timer) { switchSum += timer.m_payload * 6; },
+			[&switchSum](VisitEvent& event) { switchSum += event.m_payload * 7; },
+		};
+
+		const double typeSwitch = Measure("TypeSwitch", Repetitions, items, [&]()
+		{
+			switchSum = 0;
+			for (size_t pass = 0; pass < Passes; ++pass)
+			{
+				for (VisitEvent* event : queue)
+				{
+					dispatch(event);
+				}
+			}
+
+			DoNotOptimize(switchSum);
+		});
+
+		std::printf("  %-36s %12.2fx\n", "  speedup vs Cast if-chain", (0.0 < typeSwitch) ? chain / typeSwitch : 0.0);
+
+		int pairSum = 0;
+		const Reflection::PairTypeSwitch interact
+		{
+			[&pairSum](VisitInput&, VisitInput&) { pairSum += 1; },
+			[&pairSum](VisitInput&, VisitNetwork&) { pairSum += 2; },
+			[&pairSum](VisitNetwork&, VisitInput&) { pairSum += 3; },
+			[&pairSum](VisitKey&, VisitKey&) { pairSum += 4; },
+			[&pairSum](VisitEvent&, VisitEvent&) { pairSum += 5; },
+		};
+
+		const size_t pairItems = EventCount * Passes / 2;
+		Measure("PairTypeSwitch", Repetitions, pairItems, [&]()
+		{
+			pairSum = 0;
+			for (size_t pass = 0; pass < Passes; ++pass)
+			{
+				for (size_t index = 0; index + 1 < queue.size(); index += 2)
+				{
+					interact(queue[index], queue[index + 1]);
+				}
+			}
+
+			DoNotOptimize(pairSum);
+		});
+
+		std::printf("  %-36s %s\n", "same result", ((chainSum == dynamicSum) && (dynamicSum == switchSum)) ? "yes" : "no");
+		std::printf("\n");
+	}
+}
\ No newline at end of file
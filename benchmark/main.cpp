@@ -0,0 +1,162 @@
+#if defined(_MSC_VER)
+	// The startup clock is constructed before the static initializers of the other translation units.
+	#pragma warning(disable : 4073)
+	#pragma init_seg(lib)
+#endif
+
+#include "Benchmark.h"
+
+#include <Reflection.h>
+
+#include <cstring>
+
+namespace
+{
+	/**
+	 * @brief	Taken before the reflected types of the benchmark register, to time the static registration.
+	 */
+	struct StartupClock
+	{
+		StartupClock()
+			: start(std::chrono::steady_clock::now())
+			, types(Reflection::TypeManager::GetHandle().GetTypeMap().size())
+		{}
+
+		std::chrono::steady_clock::time_point start;
+		size_t types;
+	};
+
+#if defined(__GNUC__) || defined(__clang__)
+	StartupClock s_startupClock __attribute__((init_priority(101)));
+#else
+	StartupClock s_startupClock;
+#endif
+
+	struct Suite
+	{
+		const char* name;
+		void (*run)();
+	};
+
+	/**
+	 * @brief	Records the static registration of the benchmark types, measured once from the startup clock to main.
+	 */
+	void Startup(const std::chrono::steady_clock::time_point& mainStart)
+	{
+		const size_t types = Reflection::TypeManager::GetHandle().GetTypeMap().size() - s_startupClock.types;
+		const double total = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(mainStart - s_startupClock.start).count());
+		const double perType = (0 < types) ? total / static_cast<double>(types) : 0.0;
+
+		std::printf("[ Startup ] %zu types registered before main\n", types);
+		std::printf("  %-36s %12.1f us/run %10.2f ns/item\n\n", "Static registration", total / 1000.0, perType);
+
+		Bench::GetResults().push_back({ "Startup", "Static registration", 1, types, total, perType });
+	}
+
+	void WriteEscaped(FILE* file, const std::string& text)
+	{
+		for (const char character : text)
+		{
+			if (('"' == character) || ('\\' == character))
+			{
+				std::fputc('\\', file);
+			}
+
+			std::fputc(character, file);
+		}
+	}
+
+	bool WriteJson(const char* path)
+	{
+		FILE* file = std::fopen(path, "w");
+		if (nullptr == file)
+		{
+			return false;
+		}
+
+		const std::vector<Bench::Result>& results = Bench::GetResults();
+
+		std::fprintf(file, "{\n  \"benchmarks\": [\n");
+
+		for (size_t index = 0; index < results.size(); ++index)
+		{
+			const Bench::Result& result = results[index];
+
+			std::fprintf(file, "    { \"suite\": \"");
+			WriteEscaped(file, result.suite);
+			std::fprintf(file, "\", \"name\": \"");
+			WriteEscaped(file, result.name);
+			std::fprintf(file, "\", \"repetitions\": %zu, \"items\": %zu, \"ns_per_run\": %.3f, \"ns_per_item\": %.3f }%s\n",
+				result.repetitions, result.items, result.nsPerRun, result.nsPerItem, (index + 1 < results.size()) ? "," : "");
+		}
+
+		std::fprintf(file, "  ]\n}\n");
+
+		return 0 == std::fclose(file);
+	}
+}
+
+/**
+ * @brief	Runs the benchmark suites.
+ * @details	Usage : ReflectionBench [--filter <suite>] [--json <path>]
+ * 			--filter runs only the suite with the given name, --json writes every measurement to a JSON file.
+ */
+int main(int argc, char** argv)
+{
+	const auto mainStart = std::chrono::steady_clock::now();
+
+	const char* filter = nullptr;
+	const char* jsonPath = nullptr;
+
+	for (int index = 1; index + 1 < argc; index += 2)
+	{
+		if (0 == std::strcmp(argv[index], "--filter"))
+		{
+			filter = argv[index + 1];
+		}
+		else if (0 == std::strcmp(argv[index], "--json"))
+		{
+			jsonPath = argv[index + 1];
+		}
+	}
+
+	const Suite suites[] =
+	{
+		{ "Core", Bench::Core },
+		{ "Diff", Bench::Diff },
+		{ "Json", Bench::Json },
+		{ "Binary", Bench::Binary },
+		{ "Path", Bench::Path },
+		{ "Job", Bench::Job },
+		{ "Cast", Bench::Cast },
+		{ "Visit", Bench::Visit },
+		{ "Graph", Bench::Graph },
+		{ "Reload", Bench::Reload },
+		{ "SoA", Bench::SoA },
+		{ "Archetype", Bench::Archetype },
+	};
+
+	if ((nullptr == filter) || (0 == std::strcmp(filter, "Startup")))
+	{
+		Startup(mainStart);
+	}
+
+	for (const Suite& suite : suites)
+	{
+		if ((nullptr != filter) && (0 != std::strcmp(filter, suite.name)))
+		{
+			continue;
+		}
+
+		Bench::GetSuite() = suite.name;
+		suite.run();
+	}
+
+	if ((nullptr != jsonPath) && !WriteJson(jsonPath))
+	{
+		std::printf("Failed to write %s\n", jsonPath);
+		return 1;
+	}
+
+	return 0;
+}
\ No newline at end of file
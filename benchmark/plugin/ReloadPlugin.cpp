@@ -0,0 +1,56 @@
+#include <Reflection.h>
+
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#define RELOAD_PLUGIN_API extern "C" __declspec(dllexport)
+#else
+#define RELOAD_PLUGIN_API extern "C" __attribute__((visibility("default")))
+#endif
+
+/**
+ * Types of the plugin loaded, reloaded and unloaded by the Reload suite.
+ * They register during the static initialization of the library, inside the ModuleScope of the loader.
+ */
+class ReloadWidget
+{
+	GENERATE(ReloadWidget);
+
+	public :
+		virtual ~ReloadWidget() = default;
+
+		METHOD(Scale);
+		void Scale(float factor)
+		{
+			m_Width *= factor;
+			m_Height *= factor;
+		}
+
+	public :
+		PROPERTY(m_Width);
+		float m_Width = 1.0f;
+
+		PROPERTY(m_Height);
+		float m_Height = 1.0f;
+
+		PROPERTY(m_Name);
+		std::string m_Name;
+
+		PROPERTY(m_Children);
+		std::vector<ReloadWidget*> m_Children;
+};
+
+class ReloadButton : public ReloadWidget
+{
+	GENERATE(ReloadButton);
+
+	public :
+		PROPERTY(m_Label);
+		std::string m_Label;
+};
+
+RELOAD_PLUGIN_API const Reflection::TypeInfo* GetReloadPluginType()
+{
+	return ReloadButton::GetStaticTypeInfo();
+}
\ No newline at end of file
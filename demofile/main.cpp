@@ -7,7 +7,9 @@
 
 #include <Reflection.h>
 
+#include <atomic>
 #include <vector>
+#include <string>
 
 class IObject
 {
@@ -116,6 +118,217 @@ public:
 	ObjectA* m_MyObject;
 };
 
+class TrackedObject
+{
+	GENERATE_TRACKED(TrackedObject);
+
+public:
+	PROPERTY(m_Health);
+	int m_Health = 100;
+
+	PROPERTY(m_Speed);
+	float m_Speed = 1.0f;
+
+	PROPERTY(m_Name);
+	std::string m_Name;
+
+	PROPERTY(m_Grid);
+	std::vector<std::vector<int>> m_Grid;
+};
+
+struct NavPolygon
+{
+	GENERATE_POD(NavPolygon);
+
+public:
+	PROPERTY(m_CenterX);
+	float m_CenterX = 0.0f;
+
+	PROPERTY(m_CenterY);
+	float m_CenterY = 0.0f;
+
+	PROPERTY(m_Neighbors);
+	Reflection::RelativeArray<uint32_t> m_Neighbors;
+};
+
+struct NavMesh
+{
+	GENERATE_POD(NavMesh);
+
+public:
+	PROPERTY(m_CellSize);
+	float m_CellSize = 0.0f;
+
+	PROPERTY(m_Polygons);
+	Reflection::RelativeArray<NavPolygon> m_Polygons;
+};
+
+struct NavPortal
+{
+	GENERATE_POD(NavPortal);
+
+public:
+	PROPERTY(m_Width);
+	float m_Width = 0.0f;
+
+	PROPERTY(m_Target);
+	Reflection::RelativePtr<NavPolygon> m_Target;
+};
+
+enum class UnitState : uint8_t
+{
+	Idle,
+	Moving,
+	Attacking,
+	Dead,
+};
+
+GENERATE_ENUM(UnitState, Idle, Moving, Attacking, Dead)
+
+enum class UnitAccess : uint32_t
+{
+	None = 0,
+	Read = 1 << 0,
+	Write = 1 << 1,
+	Execute = 1 << 2,
+};
+
+GENERATE_FLAGS(UnitAccess, None, Read, Write, Execute)
+
+class Unit
+{
+	GENERATE(Unit);
+
+public:
+	enum class Team : int16_t
+	{
+		Neutral = -1,
+		Red = 10,
+		Blue = 20,
+	};
+
+	friend GENERATE_ENUM(Team, Neutral, Red, Blue)
+
+	PROPERTY(m_State, Replicated, SaveGame);
+	UnitState m_State = UnitState::Idle;
+
+	PROPERTY(m_Access, SaveGame);
+	UnitAccess m_Access = UnitAccess::None;
+
+	PROPERTY(m_Team, Replicated);
+	Team m_Team = Team::Neutral;
+
+	PROPERTY(m_Selected, Transient, EditorOnly);
+	bool m_Selected = false;
+};
+
+class IRenderable
+{
+	GENERATE(IRenderable);
+
+	public :
+		virtual ~IRenderable() = default;
+
+	public :
+		PROPERTY(m_Layer);
+		int m_Layer = 0;
+};
+
+class ITickable
+{
+	GENERATE(ITickable);
+
+	public :
+		virtual ~ITickable() = default;
+
+	public :
+		PROPERTY(m_Interval);
+		float m_Interval = 0.5f;
+};
+
+class Turret : public IRenderable, public ITickable
+{
+	GENERATE(Turret, IRenderable, ITickable);
+
+	public :
+		PROPERTY(m_Range);
+		float m_Range = 10.0f;
+};
+
+class TurretMount
+{
+	GENERATE(TurretMount);
+
+	public :
+		PROPERTY(m_Renderable);
+		IRenderable* m_Renderable = nullptr;
+
+		PROPERTY(m_Tickable);
+		ITickable* m_Tickable = nullptr;
+};
+
+class Asset
+{
+	GENERATE(Asset);
+
+	public :
+		METHOD(Rebuild, ThreadSafe);
+		void Rebuild(int passes)
+		{
+			for (int pass = 0; pass < passes; ++pass)
+			{
+				m_Checksum = m_Checksum * 31 + static_cast<uint64_t>(pass);
+			}
+		}
+
+		METHOD(Validate);
+		bool Validate() const
+		{
+			return 0 != m_Checksum;
+		}
+
+	public :
+		PROPERTY(m_Checksum);
+		uint64_t m_Checksum = 1;
+};
+
+class SceneNode
+{
+	GENERATE(SceneNode);
+
+	public :
+		PROPERTY(m_Parent);
+		SceneNode* m_Parent = nullptr;
+
+		PROPERTY(m_Children);
+		std::vector<SceneNode*> m_Children;
+
+		PROPERTY(m_Id);
+		int m_Id = 0;
+};
+
+// Declared in the order the fields were added, which leaves holes before every double.
+struct Particle
+{
+	GENERATE_POD(Particle);
+
+public:
+	PROPERTY(m_IsAlive);
+	bool m_IsAlive = false;
+
+	PROPERTY(m_Lifetime);
+	double m_Lifetime = 0.0;
+
+	PROPERTY(m_Size);
+	float m_Size = 0.0f;
+
+	PROPERTY(m_Velocity);
+	double m_Velocity = 0.0;
+
+	PROPERTY(m_IsVisible);
+	bool m_IsVisible = false;
+};
+
 namespace Test
 {
 	void Print(const Reflection::PropertyInfo* propertyInfo)
@@ -291,6 +504,691 @@ namespace Test
 		}
 	}
 
+	void StaticProperty()
+	{
+		LOGINFO() << "[ Test Static Property ]";
+
+		ObjectB instance;
+		instance.m_dArray = { 1, 2, 3 };
+
+		Reflection::ForEachProperty(instance, [](const auto& property, auto& value)
+		{
+			using Value = Reflection::Utils::RemoveConst_t<Reflection::Utils::RemoveReference_t<decltype(value)>>;
+
+			if constexpr (Reflection::Utils::IsSame<Value, int>::value)
+			{
+				LOGINFO() << "  Property " << property.GetPropertyInfo()->GetPropertyName() << " : " << value;
+			}
+			else
+			{
+				LOGINFO() << "  Property " << property.GetPropertyInfo()->GetPropertyName();
+			}
+		});
+
+		LOGINFO() << " ";
+	}
+
+	void Compare()
+	{
+		LOGINFO() << "[ Test Compare ]";
+
+		const Reflection::TypeInfo* typeInfo = ObjectB::GetStaticTypeInfo();
+
+		ObjectB lhs;
+		lhs.m_map[1] = 10;
+		lhs.m_set.insert(5);
+
+		ObjectB rhs = lhs;
+
+		LOGINFO() << "Equals : " << typeInfo->Equals(&lhs, &rhs)
+			<< " / Hash : " << (typeInfo->Hash(&lhs) == typeInfo->Hash(&rhs));
+
+		rhs.m_vector.push_back(1);
+
+		LOGINFO() << "Changed Equals : " << typeInfo->Equals(&lhs, &rhs)
+			<< " / Hash : " << (typeInfo->Hash(&lhs) == typeInfo->Hash(&rhs));
+
+		LOGINFO() << " ";
+	}
+
+	void Diff()
+	{
+		LOGINFO() << "[ Test Diff ]";
+
+		const Reflection::TypeInfo* typeInfo = ObjectB::GetStaticTypeInfo();
+		const Reflection::TypeInfo::PropertyList& properties = typeInfo->GetPropertyList();
+
+		ObjectB previous;
+		previous.m_vector = { 1, 2, 3 };
+
+		ObjectB current = previous;
+		current.m_Other = 20;
+		current.m_vector[1] = 5;
+		current.m_vector.push_back(4);
+
+		Reflection::PropertyDiff diff;
+		typeInfo->Diff(&previous, &current, diff);
+
+		diff.GetMask().ForEach([&](size_t ordinal)
+		{
+			LOGINFO() << "  Changed " << properties[ordinal]->GetPropertyName();
+		});
+
+		typeInfo->ApplyDiff(&previous, diff);
+
+		LOGINFO() << "Applied Equals : " << typeInfo->Equals(&previous, &current);
+		LOGINFO() << " ";
+	}
+
+	void DirtyTracking()
+	{
+		LOGINFO() << "[ Test Dirty Tracking ]";
+
+		const Reflection::TypeInfo* typeInfo = TrackedObject::GetStaticTypeInfo();
+		const Reflection::TypeInfo::PropertyList& properties = typeInfo->GetPropertyList();
+
+		TrackedObject instance;
+		properties[0]->Set(instance, 50);
+		properties[2]->Set(instance, std::string("Tracked"));
+
+		Reflection::PropertyMask dirty;
+		Reflection::ConsumeDirty(instance, dirty);
+
+		dirty.ForEach([&](size_t ordinal)
+		{
+			LOGINFO() << "  Dirty " << properties[ordinal]->GetPropertyName();
+		});
+
+		LOGINFO() << "Dirty after consume : " << Reflection::IsDirty(instance);
+		LOGINFO() << " ";
+	}
+
+	void Observer()
+	{
+		LOGINFO() << "[ Test Observer ]";
+
+		const Reflection::TypeInfo* typeInfo = TrackedObject::GetStaticTypeInfo();
+		const Reflection::PropertyInfo* health = typeInfo->GetPropertyList()[0];
+
+		const size_t handle = typeInfo->Subscribe([](const Reflection::PropertyChange* changes, size_t count)
+		{
+			for (size_t index = 0; index < count; ++index)
+			{
+				LOGINFO() << "  Changed " << changes[index].property->GetPropertyName() << " on " << changes[index].type->GetTypeName();
+			}
+		});
+
+		TrackedObject instance;
+		for (int value = 0; value < 10; ++value)
+		{
+			health->Set(instance, value);
+		}
+
+		LOGINFO() << "Flushed : " << Reflection::ObserverManager::GetHandle().Flush();
+
+		typeInfo->Unsubscribe(handle);
+
+		LOGINFO() << " ";
+	}
+
+	void Path()
+	{
+		LOGINFO() << "[ Test PropertyPath ]";
+
+		ObjectB objectB;
+		objectB.m_vector = { 10, 20, 30 };
+		objectB.m_map[7] = 70;
+
+		ObjectHolder holder;
+		holder.m_MyObject = &objectB;
+
+		const Reflection::TypeInfo* holderType = ObjectHolder::GetStaticTypeInfo();
+
+		const auto valuePath = Reflection::PropertyPath::Compile(holderType, "m_MyObject->m_Value");
+		const auto vectorPath = Reflection::PropertyPath::Compile(holderType, "m_MyObject->m_vector[2]");
+		const auto mapPath = Reflection::PropertyPath::Compile(holderType, "m_MyObject->m_map[7]");
+
+		valuePath.Set(holder, 5);
+
+		LOGINFO() << "m_MyObject->m_Value : " << *valuePath.Get<int>(holder) << " (ObjectA::m_Value " << objectB.ObjectA::m_Value << ")";
+		LOGINFO() << "m_MyObject->m_vector[2] : " << *vectorPath.Get<int>(holder);
+		LOGINFO() << "m_MyObject->m_map[7] : " << *mapPath.Get<int>(holder);
+
+		const auto invalidPath = Reflection::PropertyPath::Compile(holderType, "m_MyObject->m_Missing");
+		LOGINFO() << invalidPath.GetError();
+
+		holder.m_MyObject = nullptr;
+		LOGINFO() << "Null pointer resolves to nullptr : " << (nullptr == valuePath.Get<int>(holder));
+
+		TrackedObject tracked;
+		tracked.m_Grid = { { 1, 2, 3 }, { 4, 5, 6 } };
+
+		const auto gridPath = Reflection::PropertyPath::Compile(TrackedObject::GetStaticTypeInfo(), "m_Grid[1][2]");
+		gridPath.Set(tracked, 60);
+
+		LOGINFO() << "m_Grid[1][2] : " << *gridPath.Get<int>(tracked) << " (" << tracked.m_Grid[1][2] << ")";
+		LOGINFO() << "Nested set marks m_Grid dirty : " << Reflection::IsDirty(tracked);
+		LOGINFO() << " ";
+	}
+
+	void Stats()
+	{
+		LOGINFO() << "[ Test Stats ]";
+
+		Reflection::TypeManager& typeManager = Reflection::TypeManager::GetHandle();
+		typeManager.ResetStats();
+
+		const Reflection::TypeInfo* typeInfo = ObjectB::GetStaticTypeInfo();
+		typeInfo->GetProperty(std::string(typeInfo->GetTypeName()) + "::m_Value");
+		typeInfo->GetProperty("m_Missing");
+
+		ObjectB objectB;
+		IObject* object = &objectB;
+		Reflection::Cast<ObjectB*>(object);
+
+		ObjectA objectA;
+		object = &objectA;
+		Reflection::Cast<ObjectB*>(object);
+
+		const Reflection::TypeStats stats = typeManager.GetStats();
+
+		LOGINFO() << "Enabled : " << Reflection::TypeStats::IsEnabled();
+		for (size_t index = 0; index < Reflection::TypeStats::CounterCount; ++index)
+		{
+			const auto counter = static_cast<Reflection::TypeStats::Counter>(index);
+			LOGINFO() << Reflection::TypeStats::GetCounterName(counter) << " : " << stats.Get(counter);
+		}
+
+		for (const auto& [name, count] : stats.GetMissedNames())
+		{
+			LOGINFO() << "Missed " << name << " x" << count;
+		}
+
+		LOGINFO() << " ";
+	}
+
+	void Enum()
+	{
+		LOGINFO() << "[ Test Enum ]";
+
+		LOGINFO() << "UnitState::Attacking : " << Reflection::EnumToString(UnitState::Attacking);
+		LOGINFO() << "Unit::Team::Blue : " << Reflection::EnumToString(Unit::Team::Blue);
+
+		UnitState state = UnitState::Idle;
+		LOGINFO() << "From \"Dead\" : " << Reflection::EnumFromString("Dead", state) << " -> " << static_cast<int>(state);
+
+		const Reflection::EnumInfo* accessInfo = Reflection::TypeInfo::Get<UnitAccess>()->GetEnumInfo();
+
+		char text[64];
+		accessInfo->FormatFlags(static_cast<uint64_t>(UnitAccess::Read) | static_cast<uint64_t>(UnitAccess::Execute), text, sizeof(text));
+		LOGINFO() << "Read | Execute : " << text;
+
+		uint64_t mask = 0;
+		accessInfo->ParseFlags("Write|Execute", mask);
+		LOGINFO() << "Parsed Write|Execute : " << mask;
+
+		Unit source;
+		source.m_State = UnitState::Moving;
+		source.m_Access = static_cast<UnitAccess>(static_cast<uint32_t>(UnitAccess::Read) | static_cast<uint32_t>(UnitAccess::Write));
+		source.m_Team = Unit::Team::Red;
+
+		char buffer[256];
+		Reflection::JsonWriter writer(buffer, sizeof(buffer));
+		writer.Write(source);
+
+		const std::string_view json = writer.GetPending();
+		LOGINFO() << "Written : " << std::string(json);
+
+		Unit target;
+		Reflection::JsonReader reader(json);
+
+		LOGINFO() << "Read : " << reader.Read(target) << " / Equals : " << Unit::GetStaticTypeInfo()->Equals(&source, &target);
+		LOGINFO() << " ";
+	}
+
+	void Flags()
+	{
+		LOGINFO() << "[ Test Property Flags ]";
+
+		const Reflection::TypeInfo* typeInfo = Unit::GetStaticTypeInfo();
+		const Reflection::PropertyFlag flags[] = { Reflection::PropertyFlag::Replicated, Reflection::PropertyFlag::SaveGame, Reflection::PropertyFlag::EditorOnly };
+
+		for (const Reflection::PropertyFlag flag : flags)
+		{
+			LOGINFO() << Reflection::EnumToString(flag) << " :";
+			for (const Reflection::PropertyInfo* property : typeInfo->GetPropertiesWith(flag))
+			{
+				LOGINFO() << "  " << property->GetPropertyName();
+			}
+		}
+
+		LOGINFO() << "Not Transient : " << typeInfo->GetPropertiesWithout(Reflection::PropertyFlag::Transient).size() << " / " << typeInfo->GetPropertyList().size();
+		LOGINFO() << " ";
+	}
+
+	void MultipleInheritance()
+	{
+		LOGINFO() << "[ Test Multiple Inheritance ]";
+
+		for (const Reflection::TypeInfo::BaseType& base : Turret::GetStaticTypeInfo()->GetBaseTypes())
+		{
+			LOGINFO() << "Base " << base.type->GetTypeName() << " at offset " << base.offset;
+		}
+
+		Turret turret;
+		IRenderable* renderable = &turret;
+
+		ITickable* tickable = Reflection::Cast<ITickable*>(renderable);
+		LOGINFO() << "Cross cast matches dynamic_cast : " << (dynamic_cast<ITickable*>(renderable) == tickable);
+		LOGINFO() << "Interval through the cast : " << tickable->m_Interval;
+
+		// The properties of the second base are inherited with their offsets shifted to its subobject.
+		turret.m_Interval = 1.5f;
+		const Reflection::PropertyInfo* interval = Turret::GetStaticTypeInfo()->GetProperty("ITickable::m_Interval");
+		LOGINFO() << "Interval through the Turret property : " << ((nullptr != interval) ? *interval->Get<float>(turret) : 0.0f);
+
+		const Turret* back = Reflection::Cast<const Turret*>(static_cast<const ITickable*>(tickable));
+		LOGINFO() << "Down cast from the second base : " << (back == &turret);
+		LOGINFO() << "IsChild ITickable of Turret : " << Reflection::IsChild(ITickable::GetStaticTypeInfo(), Turret::GetStaticTypeInfo());
+		LOGINFO() << " ";
+	}
+
+	void Visit()
+	{
+		LOGINFO() << "[ Test Visit ]";
+
+		ObjectA objectA;
+		ObjectB objectB;
+		Turret turret;
+
+		IObject* objects[] = { &objectA, &objectB };
+
+		const Reflection::TypeSwitch describe
+		{
+			[](ObjectB& object) { LOGINFO() << "ObjectB handler, m_Value : " << object.ObjectB::m_Value; },
+			[](IObject& object) { LOGINFO() << "IObject fallback, m_Value : " << object.m_Value; },
+		};
+
+		for (IObject* object : objects)
+		{
+			describe(object);
+		}
+
+		IRenderable* renderable = &turret;
+		Reflection::Visit(renderable, [](ITickable& tickable) { LOGINFO() << "Visit through the second base, interval : " << tickable.m_Interval; });
+
+		const Reflection::PairTypeSwitch interact
+		{
+			[](IObject&, IObject&) { LOGINFO() << "Pair : IObject / IObject"; },
+			[](ObjectB&, IObject&) { LOGINFO() << "Pair : ObjectB / IObject"; },
+			[](ObjectB&, ObjectB&) { LOGINFO() << "Pair : ObjectB / ObjectB"; },
+		};
+
+		interact(objects[0], objects[1]);
+		interact(objects[1], objects[0]);
+		interact(objects[1], objects[1]);
+		LOGINFO() << " ";
+	}
+
+	void Jobs()
+	{
+		LOGINFO() << "[ Test Async Invoke ]";
+
+		const Reflection::TypeInfo* typeInfo = Asset::GetStaticTypeInfo();
+		const Reflection::MethodInfo* rebuild = typeInfo->GetMethod(std::string(typeInfo->GetTypeName()) + "::Rebuild");
+		const Reflection::MethodInfo* validate = typeInfo->GetMethod(std::string(typeInfo->GetTypeName()) + "::Validate");
+
+		if ((nullptr == rebuild) || (nullptr == validate))
+		{
+			return;
+		}
+
+		std::vector<Asset> assets(1000);
+		std::vector<Asset*> pointers;
+		for (Asset& asset : assets)
+		{
+			pointers.push_back(&asset);
+		}
+
+		LOGINFO() << "Workers : " << Reflection::JobSystem::GetHandle().GetWorkerCount();
+		LOGINFO() << "Rebuild ThreadSafe : " << rebuild->HasFlags(Reflection::MethodFlag::ThreadSafe) << " / Validate ThreadSafe : " << validate->HasFlags(Reflection::MethodFlag::ThreadSafe);
+
+		const bool scheduled = rebuild->ParallelInvoke<void>(pointers.data(), pointers.size(), 100);
+		LOGINFO() << "ParallelInvoke : " << scheduled << " / Same checksum : " << (assets.front().m_Checksum == assets.back().m_Checksum);
+
+		Reflection::MethodFuture<bool> future = validate->InvokeAsync<bool>(assets.front());
+		LOGINFO() << "InvokeAsync Validate : " << future.Get();
+		LOGINFO() << " ";
+	}
+
+	void References()
+	{
+		LOGINFO() << "[ Test Reference Graph ]";
+
+		std::vector<SceneNode> nodes(64);
+		for (size_t index = 1; index < nodes.size() - 1; ++index)
+		{
+			SceneNode& parent = nodes[(index - 1) / 2];
+
+			nodes[index].m_Id = static_cast<int>(index);
+			nodes[index].m_Parent = &parent;
+			parent.m_Children.push_back(&nodes[index]);
+		}
+
+		// The last node is never linked, so it is reported as unreachable.
+		size_t reachable = 0;
+		const size_t visited = Reflection::VisitReferences(&nodes.front(), [&](const Reflection::TypeInfo* type, void* object)
+		{
+			reachable += (SceneNode::GetStaticTypeInfo() == type) && (nullptr != object);
+		});
+
+		std::atomic<size_t> marked{ 0 };
+		const size_t parallel = Reflection::VisitReferences(&nodes.front(), [&](const Reflection::TypeInfo*, void*)
+		{
+			marked.fetch_add(1, std::memory_order_relaxed);
+		}, Reflection::TraversalMode::Parallel);
+
+		// Both bases of one turret : the turret is visited once, as a Turret at its own address.
+		Turret turret;
+		TurretMount mount;
+		mount.m_Renderable = &turret;
+		mount.m_Tickable = &turret;
+
+		bool isComplete = false;
+		const size_t mountVisited = Reflection::VisitReferences(&mount, [&](const Reflection::TypeInfo* type, void* object)
+		{
+			isComplete |= (Turret::GetStaticTypeInfo() == type) && (&turret == object);
+		});
+
+		LOGINFO() << "Visited : " << visited << " / Reachable : " << reachable << " / Leaked : " << (nodes.size() - visited);
+		LOGINFO() << "Parallel visited : " << parallel << " / Marked : " << marked.load();
+		LOGINFO() << "Mount visited : " << mountVisited << " / Turret as complete object : " << isComplete;
+		LOGINFO() << " ";
+	}
+
+	void Json()
+	{
+		LOGINFO() << "[ Test Json ]";
+
+		ObjectB source;
+		source.m_Value = 7;
+		source.m_vector = { 1, 2, 3 };
+
+		char buffer[1024];
+		Reflection::JsonWriter writer(buffer, sizeof(buffer));
+		writer.Write(source);
+
+		const std::string_view json = writer.GetPending();
+		LOGINFO() << "Written : " << std::string(json);
+
+		ObjectB target;
+		Reflection::JsonReader reader(json);
+
+		LOGINFO() << "Read : " << reader.Read(target) << " / Equals : " << ObjectB::GetStaticTypeInfo()->Equals(&source, &target);
+		LOGINFO() << " ";
+	}
+
+	void Binary()
+	{
+		LOGINFO() << "[ Test Binary ]";
+
+		ObjectB source;
+		source.m_Value = 7;
+		source.m_vector = { 1, 2, 3 };
+
+		Reflection::BinaryWriter writer;
+		writer.Write(source);
+
+		const std::vector<char> buffer = writer.GetBuffer();
+
+		ObjectB target;
+		Reflection::BinaryReader reader(buffer.data(), buffer.size());
+
+		LOGINFO() << "Size : " << buffer.size() << " bytes / Read : " << reader.Read(target)
+			<< " / Equals : " << ObjectB::GetStaticTypeInfo()->Equals(&source, &target);
+		LOGINFO() << " ";
+	}
+
+	void Graph()
+	{
+		LOGINFO() << "[ Test Graph Serialization ]";
+
+		std::vector<SceneNode> nodes(7);
+		for (size_t index = 1; index < nodes.size(); ++index)
+		{
+			SceneNode& parent = nodes[(index - 1) / 2];
+
+			nodes[index].m_Id = static_cast<int>(index);
+			nodes[index].m_Parent = &parent;
+			parent.m_Children.push_back(&nodes[index]);
+		}
+
+		ObjectB target;
+		target.m_vector = { 4, 5, 6 };
+
+		ObjectHolder holder;
+		holder.m_MyObject = &target;
+
+		// Every child points back to its parent : each node must still be written once.
+		Reflection::GraphWriter writer;
+		writer.Write(nodes.front());
+		writer.Write(holder);
+
+		const std::vector<char> buffer = writer.GetBuffer();
+
+		Reflection::Arena arena;
+		Reflection::GraphReader reader(buffer.data(), buffer.size());
+
+		const bool isRead = reader.Read(arena);
+		const SceneNode* root = reader.GetRoot<SceneNode>(0);
+		const ObjectHolder* loadedHolder = reader.GetRoot<ObjectHolder>(1);
+
+		if (!isRead || (nullptr == root) || (nullptr == loadedHolder))
+		{
+			return;
+		}
+
+		const SceneNode* leaf = root->m_Children.back()->m_Children.back();
+
+		LOGINFO() << "Size : " << buffer.size() << " bytes / Objects : " << reader.GetObjectCount()
+			<< " / Leaf : " << leaf->m_Id << " / Cycle kept : " << (leaf->m_Parent->m_Parent == root);
+		LOGINFO() << "Holder target : " << loadedHolder->m_MyObject->GetTypeInfo()->GetTypeName()
+			<< " / Equals : " << ObjectB::GetStaticTypeInfo()->Equals(loadedHolder->m_MyObject, &target);
+
+		// Both bases of one turret : a single object is written, and both pointers load back into it.
+		Turret turret;
+		turret.m_Range = 25.0f;
+		turret.m_Interval = 2.0f;
+
+		TurretMount mount;
+		mount.m_Renderable = &turret;
+		mount.m_Tickable = &turret;
+
+		Reflection::GraphWriter mountWriter;
+		mountWriter.Write(mount);
+
+		const std::vector<char> mountBuffer = mountWriter.GetBuffer();
+		Reflection::GraphReader mountReader(mountBuffer.data(), mountBuffer.size());
+
+		const TurretMount* loadedMount = mountReader.Read(arena) ? mountReader.GetRoot<TurretMount>(0) : nullptr;
+		if (nullptr == loadedMount)
+		{
+			return;
+		}
+
+		LOGINFO() << "Mount objects : " << mountReader.GetObjectCount()
+			<< " / Same turret : " << (Reflection::Cast<ITickable*>(loadedMount->m_Renderable) == loadedMount->m_Tickable)
+			<< " / Range : " << Reflection::Cast<const Turret*>(loadedMount->m_Tickable)->m_Range
+			<< " / Interval : " << loadedMount->m_Tickable->m_Interval;
+		LOGINFO() << " ";
+	}
+
+	void Layout()
+	{
+		LOGINFO() << "[ Test Layout ]";
+
+		const Reflection::LayoutReport report = Particle::GetStaticTypeInfo()->AnalyzeLayout();
+
+		for (const Reflection::LayoutField& field : report.fields)
+		{
+			LOGINFO() << field.property->GetPropertyName() << " : offset " << field.offset << " / size " << field.size
+				<< " / padding before " << field.paddingBefore;
+		}
+
+		std::string order;
+		for (const Reflection::PropertyInfo* property : report.suggestedOrder)
+		{
+			order += property->GetPropertyName();
+			order += " ";
+		}
+
+		LOGINFO() << "Size : " << report.size << " / Padding : " << report.paddingBytes
+			<< " / Suggested size : " << report.suggestedSize << " / Order : " << order;
+		LOGINFO() << " ";
+	}
+
+	void SoA()
+	{
+		LOGINFO() << "[ Test SoA ]";
+
+		Reflection::SoAVector<Particle> particles;
+		for (int index = 0; index < 4; ++index)
+		{
+			Particle particle;
+			particle.m_IsAlive = (0 == index % 2);
+			particle.m_Velocity = 2.0 * index;
+
+			particles.PushBack(particle);
+		}
+
+		// A system sweeping two columns, then object-style access to one row.
+		const Reflection::ColumnSpan<double> lifetimes = particles.GetColumn<&Particle::m_Lifetime>();
+		const Reflection::ColumnSpan<double> velocities = particles.GetColumn<&Particle::m_Velocity>();
+		for (size_t index = 0; index < lifetimes.size(); ++index)
+		{
+			lifetimes[index] += velocities[index] * 0.5;
+		}
+
+		particles.SwapRemove(0);
+		const Particle last = particles[2].ToObject();
+
+		LOGINFO() << "Columns : " << particles.GetStorage().GetColumnCount() << " / Rows : " << particles.GetSize()
+			<< " / Lifetime of row 0 : " << particles[0].Get<&Particle::m_Lifetime>()
+			<< " / Row 2 alive : " << last.m_IsAlive;
+		LOGINFO() << " ";
+	}
+
+	void Archetype()
+	{
+		LOGINFO() << "[ Test Archetype ]";
+
+		Reflection::ArchetypeStore store;
+
+		for (int index = 0; index < 6; ++index)
+		{
+			const Reflection::Entity entity = store.CreateEntity();
+			store.AddComponent<Particle>(entity)->m_Velocity = 1.0 + index;
+
+			// Every other particle is also a scene node, which moves it to another archetype.
+			if (0 == index % 2)
+			{
+				store.AddComponent<SceneNode>(entity)->m_Id = index;
+			}
+		}
+
+		Reflection::ArchetypeQuery moving;
+		store.ForEach<Particle>(moving, [](Reflection::Entity, Particle& particle)
+		{
+			particle.m_Lifetime += particle.m_Velocity;
+		});
+
+		size_t nodes = 0;
+		Reflection::ArchetypeQuery loose;
+		loose.Without<SceneNode>();
+		store.ForEach<const Particle>(loose, [&nodes](Reflection::Entity, const Particle&)
+		{
+			++nodes;
+		});
+
+		LOGINFO() << "Entities : " << store.GetEntityCount() << " / Archetypes : " << store.GetArchetypeCount()
+			<< " / Without node : " << nodes;
+		LOGINFO() << " ";
+	}
+
+	void Archive()
+	{
+		LOGINFO() << "[ Test Archive ]";
+
+		constexpr size_t PolygonCount = 4;
+
+		Reflection::ArchiveWriter writer;
+		const size_t mesh = writer.Allocate<NavMesh>();
+		const size_t polygons = writer.Allocate<NavPolygon>(PolygonCount);
+
+		for (size_t index = 0; index < PolygonCount; ++index)
+		{
+			const size_t neighbors = writer.Allocate<uint32_t>(2);
+			writer.Get<uint32_t>(neighbors)[0] = static_cast<uint32_t>((index + 1) % PolygonCount);
+			writer.Get<uint32_t>(neighbors)[1] = static_cast<uint32_t>((index + PolygonCount - 1) % PolygonCount);
+
+			NavPolygon& polygon = writer.Get<NavPolygon>(polygons)[index];
+			polygon.m_CenterX = static_cast<float>(index);
+			polygon.m_Neighbors.Set(writer.Get<uint32_t>(neighbors), 2);
+		}
+
+		writer.Get<NavMesh>(mesh)->m_CellSize = 0.5f;
+		writer.Get<NavMesh>(mesh)->m_Polygons.Set(writer.Get<NavPolygon>(polygons), PolygonCount);
+		writer.SetRoot<NavMesh>(mesh);
+
+		Reflection::MappedArchive archive;
+		if (!archive.Attach(writer.GetData(), writer.GetSize()))
+		{
+			LOGERROR() << "Invalid archive";
+			return;
+		}
+
+		const NavMesh* root = archive.GetRoot<NavMesh>();
+		const Reflection::PropertyInfo* cellSize = NavMesh::GetStaticTypeInfo()->GetProperty("NavMesh::m_CellSize");
+
+		LOGINFO() << "Cell size : " << *cellSize->Get<float>(*root) << " / Polygons : " << root->m_Polygons.size()
+			<< " / Neighbor of 0 : " << root->m_Polygons[0].m_Neighbors[0]
+			<< " / Stale type rejected : " << (nullptr == archive.GetRoot<NavPolygon>());
+
+		// A relative pointer is fingerprinted with its target, so an archive whose only change is in NavPolygon is rejected too.
+		const Reflection::TypeInfo* targetType = Reflection::TypeInfo::Get<Reflection::RelativePtr<NavPolygon>>();
+		const std::string_view targetName = targetType->GetTypeName();
+		const size_t nameOnly = Reflection::Utils::HashBytes(targetName.data(), targetName.size(),
+			Reflection::Utils::HashCombine(targetType->GetTypeSize(), targetType->GetTypeAlignment()));
+
+		LOGINFO() << "Relative pointer fingerprint folds its target : " << (nameOnly != targetType->GetLayoutFingerprint());
+		LOGINFO() << " ";
+	}
+
+	void Clone()
+	{
+		LOGINFO() << "[ Test Clone ]";
+
+		ObjectB target;
+		target.m_vector = { 1, 2, 3 };
+
+		ObjectHolder holder;
+		holder.m_MyObject = &target;
+
+		Reflection::Arena arena;
+
+		const Reflection::TypeInfo* typeInfo = ObjectHolder::GetStaticTypeInfo();
+		ObjectHolder* clone = static_cast<ObjectHolder*>(typeInfo->Clone(&holder, arena));
+		if (nullptr != clone)
+		{
+			LOGINFO() << "Cloned target : " << (clone->m_MyObject != &target)
+				<< " / Type : " << clone->m_MyObject->GetTypeInfo()->GetTypeName()
+				<< " / Equals : " << ObjectB::GetStaticTypeInfo()->Equals(clone->m_MyObject, &target)
+				<< " / Arena : " << arena.GetUsedBytes() << " bytes";
+		}
+
+		LOGINFO() << " ";
+	}
+
 	void Print()
 	{
 		LOGINFO() << "[ Print Type Info ]";
@@ -457,8 +1355,29 @@ int MAIN()
 
 	Test::Print();
 	Test::Cast();
+	Test::MultipleInheritance();
+	Test::Visit();
 	Test::Property();
 	Test::Invoke();
+	Test::StaticProperty();
+	Test::Compare();
+	Test::Clone();
+	Test::Diff();
+	Test::DirtyTracking();
+	Test::Observer();
+	Test::Path();
+	Test::Stats();
+	Test::Enum();
+	Test::Flags();
+	Test::Jobs();
+	Test::References();
+	Test::Json();
+	Test::Archive();
+	Test::Binary();
+	Test::Graph();
+	Test::Layout();
+	Test::SoA();
+	Test::Archetype();
 
 	Container();
 
@@ -0,0 +1,448 @@
+#ifndef __REFLECTION_ARCHETYPESTORE_H__
+#define __REFLECTION_ARCHETYPESTORE_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Type/TypeInfo.h"
+
+namespace Reflection
+{
+	/**
+	 * @struct	Entity
+	 * @brief	Handle of an entity of an ArchetypeStore.
+	 * @details	The index of a destroyed entity is reused with a new generation, so a stale handle is detected.
+	 */
+	struct Entity
+	{
+		static constexpr uint32_t InvalidIndex = UINT32_MAX;
+
+		uint32_t index;
+		uint32_t generation;
+
+		bool IsValid() const
+		{
+			return InvalidIndex != index;
+		}
+
+		bool operator==(const Entity& other) const
+		{
+			return (index == other.index) && (generation == other.generation);
+		}
+
+		bool operator!=(const Entity& other) const
+		{
+			return !(*this == other);
+		}
+	};
+
+	/**
+	 * @class	TypeSet
+	 * @brief	Bitset of dense type identifiers (TypeInfo::GetTypeId), the component set of an archetype or a query.
+	 * @details	Trailing zero words are never stored, so equal sets have equal words.
+	 */
+	class TypeSet
+	{
+		public :
+			struct Hash
+			{
+				size_t operator()(const TypeSet& typeSet) const
+				{
+					return typeSet.GetHash();
+				}
+			};
+
+		public :
+			void Insert(const TypeInfo* type);
+			void Erase(const TypeInfo* type);
+
+			bool Contains(const TypeInfo* type) const
+			{
+				const uint32_t typeId = type->GetTypeId();
+				const size_t word = typeId / 64;
+
+				return (word < m_words.size()) && (0 != (m_words[word] & (uint64_t(1) << (typeId % 64))));
+			}
+
+			/**
+			 * @brief	Checks if every type of the other set is in this set.
+			 */
+			bool ContainsAll(const TypeSet& other) const;
+
+			/**
+			 * @brief	Checks if a type of the other set is in this set.
+			 */
+			bool Intersects(const TypeSet& other) const;
+
+			bool IsEmpty() const;
+			size_t GetHash() const;
+
+			bool operator==(const TypeSet& other) const;
+			bool operator!=(const TypeSet& other) const;
+
+		private :
+			std::vector<uint64_t> m_words;
+	};
+
+	/**
+	 * @class	Archetype
+	 * @brief	The storage of the entities having exactly the same set of component types.
+	 * @details	Rows are stored in chunks of ChunkBytes bytes, allocated on ColumnAlignment bytes. A chunk holds
+	 * 			the entity handles first, then one column per component type ordered by type identifier, each one
+	 * 			starting on a ColumnAlignment boundary. A component larger than a chunk gets a chunk of one row.
+	 * 			Removing a row moves the last row into the hole, so rows stay dense.
+	 * 			Components are constructed, moved and destroyed through the lifecycle thunks of their TypeInfo.
+	 */
+	class Archetype
+	{
+		public :
+			static constexpr size_t ChunkBytes = 16 * 1024;
+			static constexpr size_t ColumnAlignment = 64;
+
+			struct Column
+			{
+				const TypeInfo* type;
+				size_t offset;
+				size_t size;
+				bool isTriviallyCopyable;
+				bool isTriviallyDestructible;
+			};
+
+			struct Chunk
+			{
+				char* data;
+				size_t count;
+			};
+
+		public :
+			/**
+			 * @brief	Constructor for Archetype.
+			 * @param	types The component types, without duplicates.
+			 */
+			explicit Archetype(std::vector<const TypeInfo*> types);
+			~Archetype();
+
+			Archetype(const Archetype&) = delete;
+			Archetype& operator=(const Archetype&) = delete;
+
+		public :
+			const TypeSet& GetTypeSet() const;
+
+			size_t GetColumnCount() const;
+			const Column& GetColumn(size_t column) const;
+
+			/**
+			 * @brief	Finds the column of a component type with one indexed load.
+			 * @return	size_t The index of the column, or GetColumnCount() if the archetype has no such component.
+			 */
+			size_t FindColumn(const TypeInfo* type) const
+			{
+				const uint32_t typeId = type->GetTypeId();
+
+				return (typeId < m_columnIndices.size()) ? m_columnIndices[typeId] : m_columns.size();
+			}
+
+			size_t GetSize() const;
+			size_t GetChunkCapacity() const;
+			size_t GetChunkCount() const;
+			const Chunk& GetChunk(size_t chunk) const;
+
+			const Entity* GetEntities(const Chunk& chunk) const
+			{
+				return reinterpret_cast<const Entity*>(chunk.data);
+			}
+
+			void* GetColumnData(const Chunk& chunk, size_t column) const
+			{
+				return chunk.data + m_columns[column].offset;
+			}
+
+			void* GetComponent(size_t column, size_t row) const
+			{
+				const Chunk& chunk = m_chunks[row / m_chunkCapacity];
+				return chunk.data + m_columns[column].offset + (row % m_chunkCapacity) * m_columns[column].size;
+			}
+
+		private :
+			friend class ArchetypeStore;
+
+			/**
+			 * @brief	Appends a row for the entity. Its components are left uninitialized.
+			 */
+			size_t AppendRow(Entity entity);
+
+			/**
+			 * @brief	Removes a row whose components have already been destroyed or moved out.
+			 * @return	Entity The entity moved from the last row into the removed one, or an invalid entity.
+			 */
+			Entity EraseRow(size_t row);
+
+			void DestructRow(size_t row);
+
+			/**
+			 * @brief	Gets the chunk data and the index in the chunk of a row, so its components are addressed without a division.
+			 */
+			char* LocateRow(size_t row, size_t& index) const
+			{
+				index = row % m_chunkCapacity;
+				return m_chunks[row / m_chunkCapacity].data;
+			}
+
+			void* GetComponentAt(char* data, size_t index, size_t column) const
+			{
+				return data + m_columns[column].offset + index * m_columns[column].size;
+			}
+
+			void RelocateValue(size_t column, void* target, void* source) const;
+			void DestructValue(size_t column, void* value) const;
+
+		private :
+			TypeSet m_typeSet;
+			std::vector<Column> m_columns;
+			std::vector<uint32_t> m_columnIndices;
+			std::vector<Chunk> m_chunks;
+			size_t m_chunkCapacity;
+			size_t m_chunkSize;
+			size_t m_chunkAlignment;
+			size_t m_size;
+
+			// The archetypes reached by adding or removing a component type, by type identifier.
+			// An archetype has few of them, so a linear search beats a hash lookup.
+			std::vector<std::pair<uint32_t, Archetype*>> m_addEdges;
+			std::vector<std::pair<uint32_t, Archetype*>> m_removeEdges;
+	};
+
+	/**
+	 * @class	ArchetypeQuery
+	 * @brief	The archetypes having every included component type and none of the excluded ones.
+	 * @details	The matching archetypes are cached. Archetypes are never destroyed, so a query only tests
+	 * 			the archetypes created since its last use.
+	 */
+	class ArchetypeQuery
+	{
+		public :
+			ArchetypeQuery();
+
+		public :
+			ArchetypeQuery& With(const TypeInfo* type);
+			ArchetypeQuery& Without(const TypeInfo* type);
+
+			template<typename T>
+			ArchetypeQuery& With()
+			{
+				return With(TypeInfo::Get<std::remove_const_t<T>>());
+			}
+
+			template<typename T>
+			ArchetypeQuery& Without()
+			{
+				return Without(TypeInfo::Get<std::remove_const_t<T>>());
+			}
+
+			bool Matches(const Archetype& archetype) const;
+
+		private :
+			friend class ArchetypeStore;
+
+			void Reset();
+
+		private :
+			TypeSet m_include;
+			TypeSet m_exclude;
+			std::vector<Archetype*> m_matches;
+			size_t m_scanned;
+			const void* m_store;
+	};
+
+	/**
+	 * @class	ArchetypeStore
+	 * @brief	Component storage keyed by TypeInfo, grouping the entities with the same component types in archetypes.
+	 * @details	Adding or removing a component moves the entity to the archetype of its new type set, found through
+	 * 			an edge cached on the source archetype. Component pointers are invalidated by any structural change
+	 * 			(creation, destruction, adding or removing components), which must not happen during a ForEach.
+	 * 			The store is not thread-safe.
+	 */
+	class ArchetypeStore
+	{
+		public :
+			ArchetypeStore();
+			~ArchetypeStore();
+
+			ArchetypeStore(const ArchetypeStore&) = delete;
+			ArchetypeStore& operator=(const ArchetypeStore&) = delete;
+
+		public :
+			/**
+			 * @brief	Creates an entity without components.
+			 */
+			Entity CreateEntity();
+
+			/**
+			 * @brief	Destroys an entity and its components.
+			 * @return	bool False if the entity is not alive.
+			 */
+			bool DestroyEntity(Entity entity);
+
+			bool IsAlive(Entity entity) const;
+			size_t GetEntityCount() const;
+
+			/**
+			 * @brief	Adds a default constructed component, or gets the component the entity already has.
+			 * @return	void* The address of the component, or nullptr if the entity is not alive
+			 * 			or the type is not default constructible and movable.
+			 */
+			void* AddComponent(Entity entity, const TypeInfo* type);
+
+			/**
+			 * @brief	Adds a copy of a value as a component, or assigns it to the component the entity already has.
+			 * @return	void* The address of the component, or nullptr if the entity is not alive or the type is not copyable and movable.
+			 */
+			void* AddComponent(Entity entity, const TypeInfo* type, const void* value);
+
+			/**
+			 * @brief	Destroys a component of an entity.
+			 * @return	bool False if the entity is not alive or does not have the component.
+			 */
+			bool RemoveComponent(Entity entity, const TypeInfo* type);
+
+			void* GetComponent(Entity entity, const TypeInfo* type) const;
+			bool HasComponent(Entity entity, const TypeInfo* type) const;
+
+			template<typename T>
+			T* AddComponent(Entity entity)
+			{
+				return static_cast<T*>(AddComponent(entity, TypeInfo::Get<T>()));
+			}
+
+			template<typename T>
+			T* AddComponent(Entity entity, const T& value)
+			{
+				return static_cast<T*>(AddComponent(entity, TypeInfo::Get<T>(), &value));
+			}
+
+			template<typename T>
+			bool RemoveComponent(Entity entity)
+			{
+				return RemoveComponent(entity, TypeInfo::Get<T>());
+			}
+
+			template<typename T>
+			T* GetComponent(Entity entity) const
+			{
+				return static_cast<T*>(GetComponent(entity, TypeInfo::Get<std::remove_const_t<T>>()));
+			}
+
+			template<typename T>
+			bool HasComponent(Entity entity) const
+			{
+				return HasComponent(entity, TypeInfo::Get<std::remove_const_t<T>>());
+			}
+
+			/**
+			 * @brief	Gets the archetype of an entity, nullptr if the entity is not alive.
+			 */
+			const Archetype* GetArchetype(Entity entity) const;
+
+			size_t GetArchetypeCount() const;
+			const Archetype& GetArchetype(size_t index) const;
+
+		public :
+			/**
+			 * @brief	Calls func(archetype, chunk) for every non-empty chunk of the archetypes matching the query.
+			 */
+			template<typename Func>
+			void ForEachChunk(ArchetypeQuery& query, Func&& func)
+			{
+				for (const Archetype* archetype : Match(query))
+				{
+					for (const Archetype::Chunk& chunk : archetype->m_chunks)
+					{
+						if (0 == chunk.count)
+						{
+							break;
+						}
+
+						func(*archetype, chunk);
+					}
+				}
+			}
+
+			/**
+			 * @brief	Calls func(entity, components...) for every entity matching the query and having the components.
+			 * @details	The component types are added to the included types of the query. A const component type is read-only.
+			 * 			The columns are resolved once per archetype, then every chunk is swept with plain pointers.
+			 * @tparam	Components The component types, e.g. ForEach<Position, const Velocity>(query, func).
+			 */
+			template<typename... Components, typename Func>
+			void ForEach(ArchetypeQuery& query, Func&& func)
+			{
+				(query.With<Components>(), ...);
+
+				for (const Archetype* archetype : Match(query))
+				{
+					const size_t columns[] = { archetype->FindColumn(TypeInfo::Get<std::remove_const_t<Components>>())..., 0 };
+
+					for (const Archetype::Chunk& chunk : archetype->m_chunks)
+					{
+						if (0 == chunk.count)
+						{
+							break;
+						}
+
+						ForEachRow<Components...>(*archetype, chunk, columns, func, std::index_sequence_for<Components...>{});
+					}
+				}
+			}
+
+		private :
+			struct Record
+			{
+				Archetype* archetype;
+				uint32_t row;
+				uint32_t generation;
+			};
+
+			template<typename... Components, typename Func, size_t... I>
+			static void ForEachRow(const Archetype& archetype, const Archetype::Chunk& chunk, const size_t* columns, Func& func, std::index_sequence<I...>)
+			{
+				const Entity* entities = archetype.GetEntities(chunk);
+				const std::tuple<Components*...> data{ static_cast<Components*>(archetype.GetColumnData(chunk, columns[I]))... };
+
+				for (size_t row = 0; row < chunk.count; ++row)
+				{
+					func(entities[row], std::get<I>(data)[row]...);
+				}
+			}
+
+			const std::vector<Archetype*>& Match(ArchetypeQuery& query) const;
+
+			Record* FindRecord(Entity entity);
+			const Record* FindRecord(Entity entity) const;
+
+			Archetype* FindArchetype(std::vector<const TypeInfo*> types);
+			Archetype* GetAddTarget(Archetype* source, const TypeInfo* type);
+			Archetype* GetRemoveTarget(Archetype* source, const TypeInfo* type);
+
+			/**
+			 * @brief	Moves the components of an entity to another archetype, relocating the shared ones
+			 * 			and destroying the ones the target does not have. The new components are left uninitialized.
+			 */
+			void MoveEntity(Entity entity, Record& record, Archetype* target);
+
+		private :
+			std::vector<std::unique_ptr<Archetype>> m_archetypes;
+			std::unordered_map<TypeSet, Archetype*, TypeSet::Hash> m_archetypeMap;
+			std::vector<Record> m_records;
+			std::vector<uint32_t> m_freeIndices;
+			Archetype* m_emptyArchetype;
+			size_t m_entityCount;
+	};
+};
+
+#endif // __REFLECTION_ARCHETYPESTORE_H__
\ No newline at end of file
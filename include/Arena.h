@@ -0,0 +1,107 @@
+#ifndef __REFLECTION_ARENA_H__
+#define __REFLECTION_ARENA_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+#include <type_traits>
+
+namespace Reflection
+{
+	/**
+	 * @class	Arena
+	 * @brief	Bump allocator releasing every allocation at once.
+	 * @details	Memory is carved from large blocks, so allocating an object costs a pointer bump.
+	 * 			Objects with a non-trivial destructor register a finalizer, which is stored in the arena itself.
+	 * 			Reset() runs the finalizers in reverse order of registration and releases the blocks.
+	 * 			The arena is not thread-safe.
+	 */
+	class Arena
+	{
+		public :
+			using Finalizer = void(*)(void* object);
+
+		public :
+			/**
+			 * @brief	Constructor for Arena.
+			 * @param	blockSize The default size of the blocks requested from the heap.
+			 */
+			explicit Arena(size_t blockSize = 64 * 1024);
+			~Arena();
+
+			Arena(const Arena&) = delete;
+			Arena& operator=(const Arena&) = delete;
+
+		public :
+			/**
+			 * @brief	Allocates uninitialized memory from the arena.
+			 * @param	size      The number of bytes.
+			 * @param	alignment The alignment, a power of two.
+			 * @return	void* The address of the memory.
+			 */
+			void* Allocate(size_t size, size_t alignment);
+
+			/**
+			 * @brief	Registers a finalizer called on the object when the arena is reset.
+			 * @param	object    The address of the object.
+			 * @param	finalizer The function destroying the object.
+			 */
+			void AddFinalizer(void* object, Finalizer finalizer);
+
+			/**
+			 * @brief	Constructs an object in the arena, registering its destructor if needed.
+			 * @tparam	T    The object type.
+			 * @tparam	Args The constructor argument types.
+			 * @return	T* The address of the object.
+			 */
+			template<typename T, typename... Args>
+			T* New(Args&&... args)
+			{
+				void* memory = Allocate(sizeof(T), alignof(T));
+				T* object = new (memory) T(std::forward<Args>(args)...);
+
+				if constexpr (!std::is_trivially_destructible<T>::value)
+				{
+					AddFinalizer(object, [](void* pointer) { static_cast<T*>(pointer)->~T(); });
+				}
+
+				return object;
+			}
+
+			/**
+			 * @brief	Runs the finalizers and releases every allocation.
+			 */
+			void Reset();
+
+			size_t GetUsedBytes() const;
+			size_t GetReservedBytes() const;
+
+		private :
+			struct Block
+			{
+				Block* next;
+				size_t size;
+				size_t used;
+			};
+
+			struct FinalizerNode
+			{
+				FinalizerNode* next;
+				void* object;
+				Finalizer finalizer;
+			};
+
+			Block* AllocateBlock(size_t minimumSize);
+
+		private :
+			Block* m_head;
+			FinalizerNode* m_finalizers;
+
+			const size_t m_blockSize;
+			size_t m_usedBytes;
+			size_t m_reservedBytes;
+	};
+};
+
+#endif // __REFLECTION_ARENA_H__
\ No newline at end of file
@@ -0,0 +1,186 @@
+#ifndef __REFLECTION_JOBSYSTEM_H__
+#define __REFLECTION_JOBSYSTEM_H__
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "LockFreeQueue.h"
+
+namespace Reflection
+{
+	/**
+	 * @class	JobCounter
+	 * @brief	Counts the unfinished jobs of a batch. JobSystem::Wait returns once it reaches zero.
+	 */
+	class JobCounter
+	{
+		public :
+			JobCounter()
+				: m_pending(0)
+			{}
+
+			JobCounter(const JobCounter&) = delete;
+			JobCounter& operator=(const JobCounter&) = delete;
+
+		public :
+			void Add(size_t count)
+			{
+				m_pending.fetch_add(count, std::memory_order_relaxed);
+			}
+
+			void Done()
+			{
+				m_pending.fetch_sub(1, std::memory_order_acq_rel);
+			}
+
+			bool IsDone() const
+			{
+				return 0 == m_pending.load(std::memory_order_acquire);
+			}
+
+		private :
+			std::atomic<size_t> m_pending;
+	};
+
+	/**
+	 * @brief	A unit of work : run(context, first, last) processes the items [first, last) of a batch.
+	 * @details	Jobs are plain values, so scheduling one copies it into a queue without allocating.
+	 * 			The context must outlive the job; counter, if any, is signaled when the job is done.
+	 */
+	struct Job
+	{
+		using RunFunc = void(*)(void* context, size_t first, size_t last);
+
+		RunFunc run;
+		void* context;
+		size_t first;
+		size_t last;
+		JobCounter* counter;
+	};
+
+	/**
+	 * @class	JobSystem
+	 * @brief	Singleton running jobs on a fixed pool of worker threads with work stealing.
+	 * @details	Every worker owns a LockFreeQueue. Jobs scheduled by a worker go to its own queue, the others
+	 * 			are spread over the queues in turn. An idle worker first drains its own queue, then steals from
+	 * 			the queues of the other workers, and sleeps only when every queue is empty.
+	 * 			A thread waiting for a batch runs pending jobs instead of blocking, so jobs may wait for other jobs.
+	 * 			When a queue is full, the job runs immediately on the scheduling thread.
+	 */
+	class JobSystem
+	{
+		public :
+			static constexpr size_t QueueCapacity = 4096;
+
+		private :
+			JobSystem();
+			~JobSystem();
+
+		public :
+			static JobSystem& GetHandle();
+
+		public :
+			/**
+			 * @brief	Queues a job. The counter of the job must have been incremented by the caller.
+			 */
+			void Schedule(const Job& job);
+
+			/**
+			 * @brief	Runs run(context, first, last) over [0, count) in chunks of grain items and waits for them.
+			 * @details	The calling thread takes part in the work. A grain of 0 picks chunks giving about
+			 * 			four per thread.
+			 * @param	count   The number of items.
+			 * @param	grain   The number of items of a job, or 0.
+			 * @param	context The context passed to every job.
+			 * @param	run     The function processing a chunk.
+			 */
+			void ParallelFor(size_t count, size_t grain, void* context, Job::RunFunc run);
+
+			/**
+			 * @brief	Runs pending jobs until the counter reaches zero.
+			 */
+			void Wait(const JobCounter& counter);
+
+			/**
+			 * @brief	Runs one pending job on the calling thread, taken from any queue.
+			 * @return	bool False if no job was pending.
+			 */
+			bool RunOne();
+
+			/**
+			 * @brief	Gets the number of worker threads, not counting the threads calling Wait.
+			 */
+			size_t GetWorkerCount() const;
+
+			/**
+			 * @brief	Checks if the calling thread is one of the workers.
+			 */
+			bool IsWorkerThread() const;
+
+		private :
+			void WorkerLoop(size_t index);
+			bool TakeJob(size_t start, Job& job);
+			void Execute(const Job& job);
+
+		private :
+			std::vector<std::unique_ptr<LockFreeQueue<Job>>> m_queues;
+			std::vector<std::thread> m_workers;
+
+			// Incremented before a job is queued and decremented once it is taken, so it never underestimates.
+			alignas(64) std::atomic<int64_t> m_pending;
+			alignas(64) std::atomic<size_t> m_nextQueue;
+			std::atomic<size_t> m_sleeping;
+
+			std::mutex m_sleepMutex;
+			std::condition_variable m_sleepCondition;
+			bool m_stop;
+	};
+
+	/**
+	 * @class	JobSerializer
+	 * @brief	Runs jobs one at a time without blocking the threads submitting them.
+	 * @details	A job submitted while another one runs is queued, and the thread leaving the serializer runs the queued jobs
+	 * 			before leaving. A thread waiting for a batch inside a job therefore never blocks on a job of the same
+	 * 			serializer, even one it picks up itself.
+	 */
+	class JobSerializer
+	{
+		public :
+			JobSerializer();
+
+			JobSerializer(const JobSerializer&) = delete;
+			JobSerializer& operator=(const JobSerializer&) = delete;
+
+		public :
+			/**
+			 * @brief	Enters the serializer, or queues the job if it is already entered, by any thread.
+			 * @return	bool True if the caller entered and must call Leave, false if the job was queued.
+			 */
+			bool Enter(const Job& job);
+
+			/**
+			 * @brief	Enters the serializer, running pending jobs until it is free. A thread already inside stays inside.
+			 * @return	bool True if the caller entered and must call Leave, false if it was already inside.
+			 */
+			bool Acquire();
+
+			/**
+			 * @brief	Runs the queued jobs, then leaves the serializer.
+			 */
+			void Leave();
+
+		private :
+			std::mutex m_mutex;
+			std::thread::id m_owner;
+			std::deque<Job> m_queued;
+	};
+};
+
+#endif // __REFLECTION_JOBSYSTEM_H__
\ No newline at end of file
@@ -0,0 +1,146 @@
+#ifndef __REFLECTION_LOCKFREEQUEUE_H__
+#define __REFLECTION_LOCKFREEQUEUE_H__
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+namespace Reflection
+{
+	/**
+	 * @class	LockFreeQueue
+	 * @brief	Bounded multi-producer multi-consumer queue without locks.
+	 * @details	Every cell carries a sequence number telling producers and consumers whose turn it is,
+	 * 			so a push or a pop costs one compare-and-swap on the shared position and no allocation.
+	 * 			Push fails instead of blocking when the queue is full; the caller decides how to fall back.
+	 * @tparam	T The element type, trivially copyable.
+	 */
+	template<typename T>
+	class LockFreeQueue
+	{
+		static_assert(std::is_trivially_copyable<T>::value, "Reflection::LockFreeQueue : The element type must be trivially copyable.");
+
+		public :
+			/**
+			 * @brief	Constructor for LockFreeQueue.
+			 * @param	capacity The number of cells, rounded up to a power of two.
+			 */
+			explicit LockFreeQueue(size_t capacity)
+				: m_cells(nullptr)
+				, m_mask(0)
+				, m_pushPosition(0)
+				, m_popPosition(0)
+			{
+				size_t size = 2;
+				while (size < capacity)
+				{
+					size <<= 1;
+				}
+
+				m_cells.reset(new Cell[size]);
+				m_mask = size - 1;
+
+				for (size_t index = 0; index < size; ++index)
+				{
+					m_cells[index].sequence.store(index, std::memory_order_relaxed);
+				}
+			}
+
+			LockFreeQueue(const LockFreeQueue&) = delete;
+			LockFreeQueue& operator=(const LockFreeQueue&) = delete;
+
+		public :
+			/**
+			 * @brief	Appends an element.
+			 * @return	bool False if the queue is full.
+			 */
+			bool Push(const T& value)
+			{
+				size_t position = m_pushPosition.load(std::memory_order_relaxed);
+
+				while (true)
+				{
+					Cell& cell = m_cells[position & m_mask];
+					const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+					const intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+					if (0 == difference)
+					{
+						if (m_pushPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+						{
+							cell.value = value;
+							cell.sequence.store(position + 1, std::memory_order_release);
+
+							return true;
+						}
+					}
+					else if (difference < 0)
+					{
+						return false;
+					}
+					else
+					{
+						position = m_pushPosition.load(std::memory_order_relaxed);
+					}
+				}
+			}
+
+			/**
+			 * @brief	Removes the oldest element.
+			 * @return	bool False if the queue is empty.
+			 */
+			bool Pop(T& value)
+			{
+				size_t position = m_popPosition.load(std::memory_order_relaxed);
+
+				while (true)
+				{
+					Cell& cell = m_cells[position & m_mask];
+					const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+					const intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+
+					if (0 == difference)
+					{
+						if (m_popPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+						{
+							value = cell.value;
+							cell.sequence.store(position + m_mask + 1, std::memory_order_release);
+
+							return true;
+						}
+					}
+					else if (difference < 0)
+					{
+						return false;
+					}
+					else
+					{
+						position = m_popPosition.load(std::memory_order_relaxed);
+					}
+				}
+			}
+
+			size_t GetCapacity() const
+			{
+				return m_mask + 1;
+			}
+
+		private :
+			struct Cell
+			{
+				std::atomic<size_t> sequence;
+				T value;
+			};
+
+		private :
+			std::unique_ptr<Cell[]> m_cells;
+			size_t m_mask;
+
+			alignas(64) std::atomic<size_t> m_pushPosition;
+			alignas(64) std::atomic<size_t> m_popPosition;
+	};
+};
+
+#endif // __REFLECTION_LOCKFREEQUEUE_H__
\ No newline at end of file
@@ -15,4 +15,83 @@
 #define __STATIC_USED__
 #endif
 
+/**
+ * @def		__REFLECTION_FOR_EACH__( Macro, Data, ... )
+ * @brief	Expands Macro(Data, Argument) for every argument of the variadic list, up to 64 arguments.
+ * @details	__REFLECTION_EXPAND__ forces a rescan, so MSVC splits __VA_ARGS__ like the other preprocessors.
+ */
+#define __REFLECTION_EXPAND__( x ) x
+#define __REFLECTION_CONCAT_IMPL__( a, b ) a##b
+#define __REFLECTION_CONCAT__( a, b ) __REFLECTION_CONCAT_IMPL__(a, b)
+#define __REFLECTION_ARG_COUNT_IMPL__( _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, N, ... ) N
+#define __REFLECTION_ARG_COUNT__( ... ) __REFLECTION_EXPAND__(__REFLECTION_ARG_COUNT_IMPL__(__VA_ARGS__, 64, 63, 62, 61, 60, 59, 58, 57, 56, 55, 54, 53, 52, 51, 50, 49, 48, 47, 46, 45, 44, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1))
+
+#define __REFLECTION_FOR_EACH_1__( Macro, Data, x ) Macro(Data, x)
+#define __REFLECTION_FOR_EACH_2__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_1__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_3__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_2__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_4__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_3__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_5__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_4__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_6__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_5__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_7__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_6__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_8__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_7__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_9__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_8__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_10__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_9__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_11__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_10__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_12__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_11__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_13__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_12__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_14__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_13__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_15__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_14__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_16__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_15__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_17__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_16__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_18__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_17__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_19__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_18__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_20__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_19__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_21__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_20__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_22__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_21__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_23__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_22__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_24__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_23__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_25__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_24__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_26__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_25__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_27__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_26__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_28__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_27__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_29__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_28__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_30__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_29__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_31__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_30__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_32__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_31__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_33__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_32__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_34__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_33__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_35__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_34__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_36__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_35__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_37__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_36__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_38__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_37__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_39__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_38__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_40__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_39__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_41__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_40__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_42__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_41__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_43__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_42__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_44__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_43__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_45__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_44__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_46__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_45__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_47__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_46__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_48__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_47__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_49__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_48__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_50__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_49__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_51__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_50__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_52__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_51__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_53__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_52__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_54__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_53__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_55__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_54__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_56__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_55__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_57__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_56__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_58__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_57__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_59__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_58__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_60__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_59__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_61__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_60__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_62__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_61__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_63__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_62__(Macro, Data, __VA_ARGS__))
+#define __REFLECTION_FOR_EACH_64__( Macro, Data, x, ... ) Macro(Data, x) __REFLECTION_EXPAND__(__REFLECTION_FOR_EACH_63__(Macro, Data, __VA_ARGS__))
+
+#define __REFLECTION_FOR_EACH__( Macro, Data, ... ) \
+	__REFLECTION_EXPAND__(__REFLECTION_CONCAT__(__REFLECTION_FOR_EACH_, __REFLECTION_CONCAT__(__REFLECTION_ARG_COUNT__(__VA_ARGS__), __))(Macro, Data, __VA_ARGS__))
+
 #endif // __REFLECTION_MACRO_H__
\ No newline at end of file
@@ -0,0 +1,39 @@
+#ifndef __REFLECTION_METHODFLAG_H__
+#define __REFLECTION_METHODFLAG_H__
+
+#include <cstdint>
+
+#include "Type/EnumInfo.h"
+
+namespace Reflection
+{
+	/**
+	 * @brief	Attributes attached to a method by the METHOD macro, e.g. METHOD(Rebuild, ThreadSafe).
+	 * @details	ThreadSafe marks a method that may run on several instances at the same time :
+	 * 			MethodInfo::ParallelInvoke spreads it over the JobSystem and InvokeAsync calls run unordered.
+	 * 			Other methods run one call at a time. User0 to User3 are free for the application.
+	 */
+	enum class MethodFlag : uint32_t
+	{
+		None = 0,
+		ThreadSafe = 1 << 0,
+		User0 = 1 << 4,
+		User1 = 1 << 5,
+		User2 = 1 << 6,
+		User3 = 1 << 7,
+	};
+
+	GENERATE_FLAGS(MethodFlag, None, ThreadSafe, User0, User1, User2, User3)
+
+	constexpr MethodFlag operator|(MethodFlag lhs, MethodFlag rhs)
+	{
+		return static_cast<MethodFlag>(static_cast<uint32_t>(lhs) | static_cast<uint32_t>(rhs));
+	}
+
+	constexpr MethodFlag operator&(MethodFlag lhs, MethodFlag rhs)
+	{
+		return static_cast<MethodFlag>(static_cast<uint32_t>(lhs) & static_cast<uint32_t>(rhs));
+	}
+};
+
+#endif // __REFLECTION_METHODFLAG_H__
\ No newline at end of file
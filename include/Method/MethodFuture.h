@@ -0,0 +1,194 @@
+#ifndef __REFLECTION_METHODFUTURE_H__
+#define __REFLECTION_METHODFUTURE_H__
+
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "JobSystem.h"
+#include "Method/MethodCall.h"
+
+namespace Reflection
+{
+	/**
+	 * @brief	The state shared by an InvokeAsync call and its MethodFuture.
+	 * @tparam	Return The return type of the method.
+	 */
+	template<typename Return>
+	struct AsyncResult
+	{
+		// std::optional cannot hold a reference : a reference result is kept as a pointer to the referred object.
+		using Stored = typename std::conditional<std::is_reference<Return>::value, std::remove_reference_t<Return>*, Return>::type;
+
+		JobCounter counter;
+		std::optional<Stored> value;
+	};
+
+	template<>
+	struct AsyncResult<void>
+	{
+		JobCounter counter;
+	};
+
+	/**
+	 * @brief	An InvokeAsync call, allocated once with its arguments and result and run as a single job.
+	 * @details	The job keeps the call alive through self, so the future may be dropped before the call runs.
+	 * 			A call of a method without the ThreadSafe flag goes through the method's JobSerializer : if another call
+	 * 			of the method is running, it is queued and run after it instead of blocking the thread.
+	 * @tparam	Return The return type of the method.
+	 * @tparam	Args   The argument types of the method.
+	 */
+	template<typename Return, typename... Args>
+	struct AsyncMethodCall : AsyncResult<Return>
+	{
+		const MethodCall<Return, Args...>* call;
+		void* instance;
+		JobSerializer* serializer;
+		std::tuple<Args...> args;
+		std::shared_ptr<AsyncMethodCall> self;
+
+		AsyncMethodCall(const MethodCall<Return, Args...>* methodCall, void* pointer, JobSerializer* methodSerializer, Args... arguments)
+			: call(methodCall)
+			, instance(pointer)
+			, serializer(methodSerializer)
+			, args(std::move(arguments)...)
+			, self()
+		{}
+
+		static void Run(void* context, size_t, size_t)
+		{
+			JobSerializer* serializer = static_cast<AsyncMethodCall*>(context)->serializer;
+
+			if (nullptr == serializer)
+			{
+				Call(context, 0, 1);
+			}
+			else if (serializer->Enter({ &AsyncMethodCall::Call, context, 0, 1, nullptr }))
+			{
+				Call(context, 0, 1);
+				serializer->Leave();
+			}
+		}
+
+		static void Call(void* context, size_t, size_t)
+		{
+			AsyncMethodCall* state = static_cast<AsyncMethodCall*>(context);
+			const std::shared_ptr<AsyncMethodCall> keep = std::move(state->self);
+
+			if constexpr (Utils::IsSame<Return, void>::value)
+			{
+				std::apply([state](Args&... arguments) { state->call->Invoke(state->instance, arguments...); }, state->args);
+			}
+			else if constexpr (std::is_reference<Return>::value)
+			{
+				state->value.emplace(&std::apply([state](Args&... arguments) -> Return { return state->call->Invoke(state->instance, arguments...); }, state->args));
+			}
+			else
+			{
+				state->value.emplace(std::apply([state](Args&... arguments) { return state->call->Invoke(state->instance, arguments...); }, state->args));
+			}
+
+			state->counter.Done();
+		}
+	};
+
+	/**
+	 * @brief	A ParallelInvoke call, living on the stack of the caller for the duration of the batch.
+	 * @tparam	Return The return type of the method, discarded.
+	 * @tparam	Class  The class of the instances.
+	 * @tparam	Args   The argument types of the method.
+	 */
+	template<typename Return, typename Class, typename... Args>
+	struct ParallelMethodCall
+	{
+		const MethodCall<Return, Args...>* call;
+		Class* const* instances;
+		std::tuple<Args...> args;
+
+		static void Run(void* context, size_t first, size_t last)
+		{
+			ParallelMethodCall* batch = static_cast<ParallelMethodCall*>(context);
+
+			for (size_t index = first; index < last; ++index)
+			{
+				void* pointer = reinterpret_cast<void*>(batch->instances[index]);
+
+				std::apply([batch, pointer](const Args&... arguments) { batch->call->Invoke(pointer, arguments...); }, batch->args);
+			}
+		}
+	};
+
+	/**
+	 * @class	MethodFuture
+	 * @brief	The result of MethodInfo::InvokeAsync.
+	 * @details	Waiting runs pending jobs on the calling thread, so a job may wait for the future of another call.
+	 * 			A default constructed future, or the future of a failed call, is invalid and always ready.
+	 * @tparam	Return The return type of the method.
+	 */
+	template<typename Return>
+	class MethodFuture
+	{
+		public :
+			MethodFuture() = default;
+
+			explicit MethodFuture(std::shared_ptr<AsyncResult<Return>> state)
+				: m_state(std::move(state))
+			{}
+
+		public :
+			/**
+			 * @brief	Checks if the call was scheduled, false if the method signature did not match.
+			 */
+			bool IsValid() const
+			{
+				return nullptr != m_state;
+			}
+
+			bool IsReady() const
+			{
+				return (nullptr == m_state) || m_state->counter.IsDone();
+			}
+
+			void Wait() const
+			{
+				if (nullptr != m_state)
+				{
+					JobSystem::GetHandle().Wait(m_state->counter);
+				}
+			}
+
+			/**
+			 * @brief	Waits for the call and gets its result.
+			 * @return	Return The value returned by the method, or a default value if the future is invalid.
+			 */
+			Return Get() const
+			{
+				Wait();
+
+				if constexpr (!Utils::IsSame<Return, void>::value)
+				{
+					if (nullptr == m_state)
+					{
+						static std::remove_cv_t<std::remove_reference_t<Return>> null;
+						return null;
+					}
+
+					if constexpr (std::is_reference<Return>::value)
+					{
+						return **m_state->value;
+					}
+					else
+					{
+						return *m_state->value;
+					}
+				}
+			}
+
+		private :
+			std::shared_ptr<AsyncResult<Return>> m_state;
+	};
+};
+
+#endif // __REFLECTION_METHODFUTURE_H__
\ No newline at end of file
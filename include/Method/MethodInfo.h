@@ -2,9 +2,12 @@
 #define __REFLECTION_METHODINFO_H__
 
 #include <string>
+#include <string_view>
 
 #include "Type/TypeCast.h"
 #include "Method/MethodCall.h"
+#include "Method/MethodFlag.h"
+#include "Method/MethodFuture.h"
 
 namespace Reflection
 {
@@ -41,14 +44,17 @@ namespace Reflection
 			 * @tparam	Type   The owner type of the method.
 			 * @tparam	Method The method type.
 			 * @param	initializer The initializer containing method metadata.
-			 * @param	methodName  The name of the method.
+			 * @param	methodName  The name of the method, interned with the owner's name as "Owner::Method".
+			 * @param	flags       The attributes given to the METHOD macro.
 			 */
 			template<typename Type, typename Method>
-			explicit MethodInfo(const Initializer<Type, Method>& initializer, const std::string& methodName)
+			explicit MethodInfo(const Initializer<Type, Method>& initializer, std::string_view methodName, MethodFlag flags = MethodFlag::None)
 				: m_ownerType(initializer.ownerType)
 				, m_methodType(initializer.methodType)
 				, m_methodBase(initializer.methodBase)
-				, m_methodName(initializer.ownerType != nullptr ? initializer.ownerType->GetTypeName() + "::" + methodName : methodName)
+				, m_methodName(NamePool::GetHandle().Intern(nullptr != initializer.ownerType ? initializer.ownerType->GetTypeName() : std::string_view(), methodName))
+				, m_flags(flags)
+				, m_serializer()
 			{
 				TypeInfo* ownerType = const_cast<TypeInfo*>(m_ownerType);
 				if (nullptr != ownerType)
@@ -82,6 +88,10 @@ namespace Reflection
 					{
 						methodCall->Invoke(pointer, std::forward<Args>(args)...);						
 					}
+					else
+					{
+						REFLECTION_COUNT(InvokeFailure);
+					}
 				}
 				else
 				{
@@ -91,22 +101,119 @@ namespace Reflection
 					}
 					else
 					{
-						static Return null;
+						REFLECTION_COUNT(InvokeFailure);
+
+						static std::remove_cv_t<std::remove_reference_t<Return>> null;
 						return null;
 					}
 				}
 			}
 
+			/**
+			 * @brief	Schedules the method on the JobSystem and returns immediately.
+			 * @details	The arguments are copied into the call. The instance must stay alive until the call is done.
+			 * 			Calls of methods without the ThreadSafe flag run one at a time : a call made while another one runs
+			 * 			is queued behind it, so waiting on the future inside a call of the same method does not deadlock.
+			 * @tparam	Return The return type of the method.
+			 * @tparam	Class  The class type of the method.
+			 * @tparam	Args   The argument types of the method.
+			 * @param	instance A reference to the instance on which to invoke the method.
+			 * @param	args     The arguments to pass to the method.
+			 * @return	MethodFuture<Return> The future of the call, invalid if the signature does not match.
+			 */
+			template<typename Return, typename Class, typename... Args>
+			MethodFuture<Return> InvokeAsync(Class& instance, Args... args) const
+			{
+				const MethodCall<Return, Args...>* methodCall = Cast<const MethodCall<Return, Args...>*>(m_methodBase);
+
+				if (nullptr == methodCall)
+				{
+					REFLECTION_COUNT(InvokeFailure);
+					return MethodFuture<Return>();
+				}
+
+				JobSerializer* serializer = HasFlags(MethodFlag::ThreadSafe) ? nullptr : &m_serializer;
+
+				auto state = std::make_shared<AsyncMethodCall<Return, Args...>>(methodCall, reinterpret_cast<void*>(&instance), serializer, std::move(args)...);
+				state->self = state;
+				state->counter.Add(1);
+
+				JobSystem::GetHandle().Schedule({ &AsyncMethodCall<Return, Args...>::Run, state.get(), 0, 1, nullptr });
+
+				return MethodFuture<Return>(std::move(state));
+			}
+
+			/**
+			 * @brief	Invokes the method on every instance and waits for all the calls. The results are discarded.
+			 * @details	ThreadSafe methods are spread over the JobSystem in chunks, with the calling thread taking part.
+			 * 			Other methods are called in order on the calling thread.
+			 * @tparam	Return The return type of the method.
+			 * @tparam	Class  The class type of the method.
+			 * @tparam	Args   The argument types of the method.
+			 * @param	instances The instances on which to invoke the method.
+			 * @param	count     The number of instances.
+			 * @param	args      The arguments passed to every call.
+			 * @return	bool False if the signature does not match.
+			 */
+			template<typename Return, typename Class, typename... Args>
+			bool ParallelInvoke(Class* const* instances, size_t count, Args... args) const
+			{
+				const MethodCall<Return, Args...>* methodCall = Cast<const MethodCall<Return, Args...>*>(m_methodBase);
+
+				if (nullptr == methodCall)
+				{
+					REFLECTION_COUNT(InvokeFailure);
+					return false;
+				}
+
+				using Batch = ParallelMethodCall<Return, Class, Args...>;
+				Batch batch = { methodCall, instances, std::tuple<Args...>(std::move(args)...) };
+
+				if (HasFlags(MethodFlag::ThreadSafe))
+				{
+					JobSystem::GetHandle().ParallelFor(count, 0, &batch, &Batch::Run);
+				}
+				else
+				{
+					// A batch started from inside a call of the method is already serialized : it runs without entering again.
+					const bool isEntered = m_serializer.Acquire();
+					Batch::Run(&batch, 0, count);
+
+					if (isEntered)
+					{
+						m_serializer.Leave();
+					}
+				}
+
+				return true;
+			}
+
 		public :
 			const TypeInfo* GetOwnerType() const;
 			const TypeInfo* GetMethodType() const;
-			const std::string& GetMethodName() const;
+			std::string_view GetMethodName() const;
+
+			MethodFlag GetFlags() const;
+
+			/**
+			 * @brief	Checks if the method has every flag of the mask.
+			 */
+			bool HasFlags(MethodFlag flags) const;
+
+			/**
+			 * @brief	Gets the bytes of this method object and of its call thunk. Used by TypeManager::GetMemoryStats.
+			 */
+			size_t GetMetadataBytes() const;
 
 		private :
 			const TypeInfo* m_ownerType;
 			const TypeInfo* m_methodType;
 			const MethodBase* m_methodBase;
-			const std::string m_methodName;
+			const std::string_view m_methodName;
+			const MethodFlag m_flags;
+
+			// Serializes the asynchronous and parallel calls of the methods without the ThreadSafe flag.
+			mutable JobSerializer m_serializer;
 	};
 };
 
@@ -14,16 +14,23 @@
  * 			**Type-Erased Invoker (Thunk)**. This allows the method to be 
  * 			dynamically invoked at runtime via `MethodInfo::Invoke`, regardless 
  * 			of the specific function signature.
+ * 			The names following the method are MethodFlag enumerators, e.g. METHOD(Rebuild, ThreadSafe),
+ * 			parsed at compile time.
  * @param	Method The name of the member function to register (without quotes).
+ * @param	...    The MethodFlag names of the method, if any.
  */
-#define METHOD( Method ) \
+#define __REFLECTION_METHOD_FLAG__( Data, Flag ) | Reflection::ParseEnumName<Reflection::MethodFlag>(#Flag)
+
+#define METHOD( Method, ... ) \
+		static constexpr Reflection::MethodFlag s_methodFlags##Method = Reflection::MethodFlag::None __REFLECTION_FOR_EACH__(__REFLECTION_METHOD_FLAG__, Method, __VA_ARGS__); \
+		\
 		struct RegisterMethod##Method \
 		{ \
 			RegisterMethod##Method() \
 			{ \
 				static const Reflection::MethodBase* methodBase = Reflection::MethodCreator<decltype(&ThisType::Method), &ThisType::Method>::Create(); \
 				static Reflection::MethodInfo::Initializer<ThisType, decltype(&ThisType::Method)> initializer(methodBase); \
-				static Reflection::MethodInfo methodInfo(initializer, std::string(#Method)); \
+				static Reflection::MethodInfo methodInfo(initializer, #Method, s_methodFlags##Method); \
 			}; \
 		}; \
 		\
@@ -0,0 +1,79 @@
+#ifndef __REFLECTION_NAMEPOOL_H__
+#define __REFLECTION_NAMEPOOL_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+#include "Arena.h"
+
+namespace Reflection
+{
+	/**
+	 * @class	NamePool
+	 * @brief	Singleton interning the names of the reflection metadata (types, properties, methods).
+	 * @details	Every distinct name is stored once, null-terminated, in the blocks of an Arena, and the metadata keeps
+	 * 			std::string_view to it. The name is preceded by its size and hash, so the deduplication table only holds
+	 * 			one pointer per slot. Equal names share their bytes, so the "Owner::member" names of the inherited and
+	 * 			reloaded metadata cost nothing more. Names are never released : the views stay valid until the end of the
+	 * 			program, even after the plugin that registered them is unloaded. Interning is thread-safe.
+	 */
+	class NamePool
+	{
+		private :
+			struct Header
+			{
+				uint32_t size;
+				uint32_t hash;
+			};
+
+			NamePool();
+			~NamePool();
+
+		public :
+			static NamePool& GetHandle();
+
+		public :
+			/**
+			 * @brief	Gets the interned copy of a name, storing it on the first request.
+			 * @return	std::string_view The interned name, null-terminated.
+			 */
+			std::string_view Intern(std::string_view name);
+
+			/**
+			 * @brief	Gets the interned "scope::name", without building the joined name on the heap.
+			 * @return	std::string_view The interned name, or name alone if scope is empty.
+			 */
+			std::string_view Intern(std::string_view scope, std::string_view name);
+
+			/**
+			 * @brief	Gets the number of distinct names.
+			 */
+			size_t GetNameCount() const;
+
+			/**
+			 * @brief	Gets the bytes of every interned name, duplicates included : what one string per request would hold.
+			 */
+			size_t GetRequestedBytes() const;
+
+			/**
+			 * @brief	Gets the bytes held by the pool : its arena blocks and its hash table.
+			 */
+			size_t GetReservedBytes() const;
+
+		private :
+			std::string_view InternLocked(std::string_view name);
+			void Grow();
+
+		private :
+			Arena m_arena;
+			std::vector<const Header*> m_slots;
+			size_t m_count;
+			size_t m_requestedBytes;
+			mutable std::mutex m_mutex;
+	};
+};
+
+#endif // __REFLECTION_NAMEPOOL_H__
\ No newline at end of file
@@ -0,0 +1,160 @@
+#ifndef __REFLECTION_NAMETABLE_H__
+#define __REFLECTION_NAMETABLE_H__
+
+#include <algorithm>
+#include <cstddef>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "Utils.h"
+
+namespace Reflection
+{
+	/**
+	 * @class	NameTable
+	 * @brief	Flat map from names to metadata, such as the properties of a TypeInfo by qualified name.
+	 * @details	Two parallel arrays sorted by name hash : the hashes, searched with a binary search, and the entries.
+	 * 			No node is allocated per entry, and the names are views of the NamePool, so they are not copied.
+	 * 			Adding an entry costs a shift of the arrays, which suits the tables filled once at registration.
+	 * 			Tables of at most LinearLimit entries, like the properties of most types, are scanned without hashing the name.
+	 * 			Iteration follows the hash order. The table is not thread-safe.
+	 * @tparam	T The type of the metadata.
+	 */
+	template<typename T>
+	class NameTable
+	{
+		public :
+			using Entry = std::pair<std::string_view, const T*>;
+			using const_iterator = typename std::vector<Entry>::const_iterator;
+
+			static constexpr size_t LinearLimit = 16;
+
+		public :
+			/**
+			 * @brief	Finds the metadata of a name.
+			 * @return	const T* The metadata, or nullptr if the name is not in the table.
+			 */
+			const T* Find(std::string_view name) const
+			{
+				if (m_entries.size() <= LinearLimit)
+				{
+					for (const Entry& entry : m_entries)
+					{
+						if (name == entry.first)
+						{
+							return entry.second;
+						}
+					}
+
+					return nullptr;
+				}
+
+				const size_t hash = Hash(name);
+
+				for (size_t index = LowerBound(hash); (index < m_hashes.size()) && (hash == m_hashes[index]); ++index)
+				{
+					if (name == m_entries[index].first)
+					{
+						return m_entries[index].second;
+					}
+				}
+
+				return nullptr;
+			}
+
+			/**
+			 * @brief	Adds a name, or replaces the metadata of a name already in the table.
+			 * @param	name  The name, which must outlive the table (e.g. interned in the NamePool).
+			 * @param	value The metadata.
+			 * @return	const T* The replaced metadata, or nullptr if the name was added.
+			 */
+			const T* Insert(std::string_view name, const T* value)
+			{
+				const size_t hash = Hash(name);
+
+				size_t index = LowerBound(hash);
+				for (; (index < m_hashes.size()) && (hash == m_hashes[index]); ++index)
+				{
+					if (name == m_entries[index].first)
+					{
+						const T* replaced = m_entries[index].second;
+						m_entries[index].second = value;
+
+						return replaced;
+					}
+				}
+
+				m_hashes.insert(m_hashes.begin() + index, hash);
+				m_entries.insert(m_entries.begin() + index, Entry(name, value));
+
+				return nullptr;
+			}
+
+			/**
+			 * @brief	Replaces the content of the table with the given entries, sorted once.
+			 * @details	Of several entries with the same name, the first one is kept.
+			 */
+			void Assign(std::vector<Entry> entries)
+			{
+				std::vector<std::pair<size_t, Entry>> sorted;
+				sorted.reserve(entries.size());
+
+				for (const Entry& entry : entries)
+				{
+					sorted.push_back({ Hash(entry.first), entry });
+				}
+
+				std::stable_sort(sorted.begin(), sorted.end(), [](const std::pair<size_t, Entry>& lhs, const std::pair<size_t, Entry>& rhs)
+				{
+					return (lhs.first != rhs.first) ? (lhs.first < rhs.first) : (lhs.second.first < rhs.second.first);
+				});
+
+				m_hashes.clear();
+				m_entries.clear();
+				m_hashes.reserve(sorted.size());
+				m_entries.reserve(sorted.size());
+
+				for (const auto& [hash, entry] : sorted)
+				{
+					if (!m_entries.empty() && (hash == m_hashes.back()) && (entry.first == m_entries.back().first))
+					{
+						continue;
+					}
+
+					m_hashes.push_back(hash);
+					m_entries.push_back(entry);
+				}
+			}
+
+			const_iterator begin() const { return m_entries.begin(); }
+			const_iterator end() const { return m_entries.end(); }
+			size_t size() const { return m_entries.size(); }
+			bool empty() const { return m_entries.empty(); }
+
+			/**
+			 * @brief	Gets the heap bytes held by the table.
+			 */
+			size_t GetMemoryBytes() const
+			{
+				return m_hashes.capacity() * sizeof(size_t) + m_entries.capacity() * sizeof(Entry);
+			}
+
+		private :
+			static size_t Hash(std::string_view name)
+			{
+				return Utils::HashBytes(name.data(), name.size(), 0);
+			}
+
+			size_t LowerBound(size_t hash) const
+			{
+				return static_cast<size_t>(std::lower_bound(m_hashes.begin(), m_hashes.end(), hash) - m_hashes.begin());
+			}
+
+		private :
+			std::vector<size_t> m_hashes;
+			std::vector<Entry> m_entries;
+	};
+};
+
+#endif // __REFLECTION_NAMETABLE_H__
\ No newline at end of file
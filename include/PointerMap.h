@@ -0,0 +1,100 @@
+#ifndef __REFLECTION_POINTERMAP_H__
+#define __REFLECTION_POINTERMAP_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Reflection
+{
+	/**
+	 * @class	PointerMap
+	 * @brief	Compact map from addresses to 32-bit values, such as object indices.
+	 * @details	The PointerSet layout with a parallel array of values : 12 bytes per slot, no node allocation,
+	 * 			kept at most half full. nullptr cannot be used as a key. The map is not thread-safe.
+	 */
+	class PointerMap
+	{
+		public :
+			/**
+			 * @brief	Constructor for PointerMap.
+			 * @param	count The number of addresses to reserve room for.
+			 */
+			explicit PointerMap(size_t count = 0);
+
+		public :
+			/**
+			 * @brief	Adds an address with its value, unless the address is already in the map.
+			 * @param	pointer The address, not nullptr.
+			 * @param	value   The value of a new address.
+			 * @param	stored  Receives the value of the address, the given one if it was added.
+			 * @return	bool True if the address was added.
+			 */
+			bool Insert(const void* pointer, uint32_t value, uint32_t& stored)
+			{
+				if (m_keys.size() <= m_size * 2)
+				{
+					Grow();
+				}
+
+				const uintptr_t key = reinterpret_cast<uintptr_t>(pointer);
+				for (size_t slot = GetSlot(key); ; slot = (slot + 1) & m_mask)
+				{
+					if (key == m_keys[slot])
+					{
+						stored = m_values[slot];
+						return false;
+					}
+
+					if (0 == m_keys[slot])
+					{
+						m_keys[slot] = key;
+						m_values[slot] = value;
+						++m_size;
+
+						stored = value;
+						return true;
+					}
+				}
+			}
+
+			/**
+			 * @brief	Gets the value of an address.
+			 * @return	bool False if the address is not in the map.
+			 */
+			bool Find(const void* pointer, uint32_t& value) const;
+
+			/**
+			 * @brief	Makes room for count addresses without growing.
+			 */
+			void Reserve(size_t count);
+
+			/**
+			 * @brief	Removes every address, keeping the memory.
+			 */
+			void Clear();
+
+			/**
+			 * @brief	Gets the number of addresses in the map.
+			 */
+			size_t GetSize() const;
+
+		private :
+			size_t GetSlot(uintptr_t key) const
+			{
+				return static_cast<size_t>((static_cast<uint64_t>(key) * 0x9E3779B97F4A7C15ull) >> m_shift) & m_mask;
+			}
+
+			void Grow();
+			void Rehash(size_t capacity);
+
+		private :
+			std::vector<uintptr_t> m_keys;
+			std::vector<uint32_t> m_values;
+			size_t m_size;
+			size_t m_mask;
+			uint32_t m_shift;
+	};
+};
+
+#endif // __REFLECTION_POINTERMAP_H__
\ No newline at end of file
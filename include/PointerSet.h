@@ -0,0 +1,94 @@
+#ifndef __REFLECTION_POINTERSET_H__
+#define __REFLECTION_POINTERSET_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Reflection
+{
+	/**
+	 * @class	PointerSet
+	 * @brief	Compact set of addresses.
+	 * @details	The addresses are stored in a single power-of-two array probed linearly, so an entry costs 8 bytes
+	 * 			and no node allocation, and the array is kept at most half full. nullptr cannot be stored, it marks the empty slots.
+	 * 			The set is not thread-safe.
+	 */
+	class PointerSet
+	{
+		public :
+			/**
+			 * @brief	Constructor for PointerSet.
+			 * @param	count The number of addresses to reserve room for.
+			 */
+			explicit PointerSet(size_t count = 0);
+
+		public :
+			/**
+			 * @brief	Adds an address to the set.
+			 * @param	pointer The address, not nullptr.
+			 * @return	bool True if the address was not in the set.
+			 */
+			bool Insert(const void* pointer)
+			{
+				if (m_slots.size() <= m_size * 2)
+				{
+					Grow();
+				}
+
+				const uintptr_t key = reinterpret_cast<uintptr_t>(pointer);
+				for (size_t slot = GetSlot(key); ; slot = (slot + 1) & m_mask)
+				{
+					if (key == m_slots[slot])
+					{
+						return false;
+					}
+
+					if (0 == m_slots[slot])
+					{
+						m_slots[slot] = key;
+						++m_size;
+						return true;
+					}
+				}
+			}
+
+			/**
+			 * @brief	Checks whether an address is in the set.
+			 */
+			bool Contains(const void* pointer) const;
+
+			/**
+			 * @brief	Makes room for count addresses without growing.
+			 */
+			void Reserve(size_t count);
+
+			/**
+			 * @brief	Removes every address, keeping the memory.
+			 */
+			void Clear();
+
+			/**
+			 * @brief	Gets the number of addresses in the set.
+			 */
+			size_t GetSize() const;
+
+		private :
+			size_t GetSlot(uintptr_t key) const
+			{
+				// Fibonacci hashing, the low bits of an address being mostly alignment.
+				return static_cast<size_t>((static_cast<uint64_t>(key) * 0x9E3779B97F4A7C15ull) >> m_shift) & m_mask;
+			}
+
+			void Grow();
+			void Rehash(size_t capacity);
+
+		private :
+			std::vector<uintptr_t> m_slots;
+			size_t m_size;
+			size_t m_mask;
+			uint32_t m_shift;
+	};
+};
+
+#endif // __REFLECTION_POINTERSET_H__
\ No newline at end of file
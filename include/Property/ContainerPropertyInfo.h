@@ -2,9 +2,18 @@
 #define __REFLECTION_CONTAINERPROPERTYINFO_H__
 
 #include "Property/PropertyInfo.h"
+#include "Property/PropertyDiff.h"
 
 namespace Reflection
 {
+	/**
+	 * @brief	Gets the ownerless description of Element as a container, and attaches it to the TypeInfo of Element.
+	 * @details	Called by the initializers of the containers holding Element, see TypeInfo::GetContainer.
+	 * @return	const TypeInfo* The TypeInfo of Element.
+	 */
+	template<typename Element>
+	const TypeInfo* GetElementType();
+
 	class ContainerPropertyInfo : public PropertyInfo
 	{
 		GENERATE(ContainerPropertyInfo);
@@ -19,6 +28,39 @@ namespace Reflection
 		using ElementFunc = void* (*)(const Iterator& iterator);
 		using CopyFunc = void(*)(Iterator& lhs, const Iterator& rhs);
 		using CompareFunc = bool(*)(const Iterator& lhs, const Iterator& rhs);
+		using SizeFunc = size_t(*)(const void* container);
+		using DataFunc = const void* (*)(const void* container);
+		using FindFunc = const void* (*)(const void* container, const void* key);
+		using ClearFunc = void(*)(void* container);
+		using ReserveFunc = void(*)(void* container, size_t size);
+		using InsertFunc = void* (*)(void* container, const void* element);
+		using EraseFunc = void(*)(void* container, const void* key);
+		using ResizeFunc = void(*)(void* container, size_t size);
+
+		/**
+		 * @struct	Operations
+		 * @brief	The thunks of a container type, built once and shared by every property of that type.
+		 * @details	A thunk is nullptr when the container does not support the operation.
+		 */
+		struct Operations
+		{
+			BeginFunc beginFunc;
+			EndFunc endFunc;
+			NextFunc nextFunc;
+			PrevFunc prevFunc;
+			DestroyFunc destroyFunc;
+			ElementFunc elementFunc;
+			CopyFunc copyFunc;
+			CompareFunc compareFunc;
+			SizeFunc sizeFunc;
+			DataFunc dataFunc;
+			FindFunc findFunc;
+			ClearFunc clearFunc;
+			ReserveFunc reserveFunc;
+			InsertFunc insertFunc;
+			EraseFunc eraseFunc;
+			ResizeFunc resizeFunc;
+		};
 
 		class Iterator
 		{
@@ -153,12 +195,146 @@ namespace Reflection
 
 	public :
 		template<typename Type, typename Property>
-		explicit ContainerPropertyInfo(const Initializer<Type, Property>& initializer, const std::string& propertyName)
-			: PropertyInfo(initializer, propertyName)
+		explicit ContainerPropertyInfo(const Initializer<Type, Property>& initializer, std::string_view propertyName, PropertyFlag flags = PropertyFlag::None)
+			: PropertyInfo(initializer, propertyName, flags)
+			, m_operations(GetSharedOperations<Property>())
+		{
+		}
+
+	protected :
+		ContainerPropertyInfo(const ContainerPropertyInfo& other, const TypeInfo* ownerType, size_t baseOffset)
+			: PropertyInfo(other, ownerType, baseOffset)
+			, m_operations(other.m_operations)
+		{
+		}
+
+	public :
+
+		Iterator begin(const void* container) const
+		{
+			if (nullptr != m_operations->beginFunc)
+			{
+				Iterator itr;
+				m_operations->beginFunc(container, itr);
+
+				itr.m_nextFunc = m_operations->nextFunc;
+				itr.m_prevFunc = m_operations->prevFunc;
+				itr.m_destroyFunc = m_operations->destroyFunc;
+				itr.m_elementFunc = m_operations->elementFunc;
+				itr.m_copyFunc = m_operations->copyFunc;
+				itr.m_compareFunc = m_operations->compareFunc;
+
+				return itr;
+			}
+			else
+			{
+				return Iterator();
+			}
+		}
+
+		Iterator end(const void* container) const
+		{
+			if (nullptr != m_operations->endFunc)
+			{
+				Iterator itr;
+				m_operations->endFunc(container, itr);
+
+				itr.m_nextFunc = m_operations->nextFunc;
+				itr.m_prevFunc = m_operations->prevFunc;
+				itr.m_destroyFunc = m_operations->destroyFunc;
+				itr.m_elementFunc = m_operations->elementFunc;
+				itr.m_copyFunc = m_operations->copyFunc;
+				itr.m_compareFunc = m_operations->compareFunc;
+
+				return itr;
+			}
+			else
+			{
+				return Iterator();
+			}
+		}
+
+		/**
+		 * @brief	Gets the number of elements of the container.
+		 * @details	Uses the size()/Size() member of the container if available, otherwise counts by iteration.
+		 * @param	container The address of the container.
+		 * @return	size_t The number of elements.
+		 */
+		size_t GetSize(const void* container) const;
+
+		/**
+		 * @brief	Gets the address of the contiguous element storage of the container.
+		 * @param	container The address of the container.
+		 * @return	const void* The address of the first element, or nullptr if the container is not contiguous.
+		 */
+		const void* GetData(const void* container) const;
+
+		/**
+		 * @brief	Finds the element of the given key in a keyed container (Set / Map).
+		 * @param	container The address of the container.
+		 * @param	key       The address of the key.
+		 * @return	const void* The address of the element, or nullptr if not found or not supported.
+		 */
+		const void* Find(const void* container, const void* key) const;
+
+		bool HasFind() const { return nullptr != m_operations->findFunc; }
+
+		/**
+		 * @brief	Removes every element of the container.
+		 * @return	bool False if the container cannot be cleared (e.g. fixed size arrays).
+		 */
+		bool Clear(void* container) const;
+
+		/**
+		 * @brief	Reserves the capacity of the container, if the container supports it.
+		 */
+		void Reserve(void* container, size_t size) const;
+
+		/**
+		 * @brief	Appends (Array) or inserts (Set / Map) a copy of the element into the container.
+		 * @param	container The address of the container.
+		 * @param	element   The address of the element, a value_type of the container.
+		 * @return	void* The address of the stored element, or nullptr if the container cannot grow.
+		 */
+		void* Insert(void* container, const void* element) const;
+
+		bool CanInsert() const { return nullptr != m_operations->insertFunc; }
+
+		/**
+		 * @brief	Removes the element with the given key (Set / Map).
+		 * @return	bool False if the container does not support erasing.
+		 */
+		bool Erase(void* container, const void* key) const;
+
+		/**
+		 * @brief	Resizes the container, default constructing the new elements (Array).
+		 * @return	bool False if the container does not support resizing.
+		 */
+		bool Resize(void* container, size_t size) const;
+
+		bool CanErase() const { return nullptr != m_operations->eraseFunc; }
+
+		const Operations* GetOperations() const { return m_operations; }
+
+	private :
+		/**
+		 * @brief	Gets the thunks of a container type, built on the first property of that type.
+		 */
+		template<typename Property>
+		static const Operations* GetSharedOperations()
+		{
+			static const Operations operations = CreateOperations<Property>();
+			return &operations;
+		}
+
+		template<typename Property>
+		static Operations CreateOperations()
 		{
 			using ContainerConstIterator = typename Utils::IteratorTraits<Property>::ConstIterator;
 
-			m_nextFunc = [](Iterator& iterator)
+			Operations operations = {};
+
+			operations.nextFunc = [](Iterator& iterator)
 			{
 				ContainerConstIterator* rawIterator = reinterpret_cast<ContainerConstIterator*>(&iterator.m_storage[0]);
 				if (nullptr != rawIterator)
@@ -167,7 +343,7 @@ namespace Reflection
 				}
 			};
 
-			m_prevFunc = [](Iterator& iterator)
+			operations.prevFunc = [](Iterator& iterator)
 			{
 				ContainerConstIterator* rawIterator = reinterpret_cast<ContainerConstIterator*>(&iterator.m_storage[0]);
 				if (nullptr != rawIterator)
@@ -176,13 +352,13 @@ namespace Reflection
 				}
 			};
 
-			m_destroyFunc = [](Iterator& iterator)
+			operations.destroyFunc = [](Iterator& iterator)
 				{
 					auto* itr = reinterpret_cast<ContainerConstIterator*>(&iterator.m_storage[0]);
 					itr->~ContainerConstIterator();
 				};
 
-			m_elementFunc = [](const Iterator& iterator) -> void*
+			operations.elementFunc = [](const Iterator& iterator) -> void*
 			{
 				const ContainerConstIterator* rawIterator = reinterpret_cast<const ContainerConstIterator*>(&iterator.m_storage);
 				if (nullptr != rawIterator)
@@ -195,14 +371,14 @@ namespace Reflection
 				}
 			};
 
-			m_copyFunc = [](Iterator& lhs, const Iterator& rhs)
+			operations.copyFunc = [](Iterator& lhs, const Iterator& rhs)
 				{
 					const ContainerConstIterator* itr = reinterpret_cast<const ContainerConstIterator*>(&rhs.m_storage);
 
 					new (&lhs.m_storage) ContainerConstIterator(*itr);
 				};
 
-			m_compareFunc = [](const Iterator& lhs, const Iterator& rhs) -> bool
+			operations.compareFunc = [](const Iterator& lhs, const Iterator& rhs) -> bool
 			{
 				const ContainerConstIterator* lhsIterator = reinterpret_cast<const ContainerConstIterator*>(&lhs.m_storage);
 				const ContainerConstIterator* rhsIterator = reinterpret_cast<const ContainerConstIterator*>(&rhs.m_storage);
@@ -210,7 +386,7 @@ namespace Reflection
 				return *lhsIterator == *rhsIterator;
 			};
 
-			m_beginFunc = [](const void* container, Iterator& iterator)
+			operations.beginFunc = [](const void* container, Iterator& iterator)
 			{
 				const Property* property = static_cast<const Property*>(container);
 
@@ -218,68 +394,253 @@ namespace Reflection
 				new (&iterator.m_storage) ContainerConstIterator(itr);
 			};
 
-			m_endFunc = [](const void* container, Iterator& iterator)
+			operations.endFunc = [](const void* container, Iterator& iterator)
 			{
 				const Property* property = static_cast<const Property*>(container);
 
 				const auto itr = property->end();
 				new (&iterator.m_storage) ContainerConstIterator(itr);
 			};
-		}
 
-		Iterator begin(const void* container) const
-		{
-			if (nullptr != m_beginFunc)
+			if constexpr (Utils::HasStdSize<Property>::value)
 			{
-				Iterator itr;
-				m_beginFunc(container, itr);
+				operations.sizeFunc = [](const void* container) -> size_t
+				{
+					return static_cast<size_t>(static_cast<const Property*>(container)->size());
+				};
+			}
+			else if constexpr (Utils::HasSize<Property>::value)
+			{
+				operations.sizeFunc = [](const void* container) -> size_t
+				{
+					return static_cast<size_t>(static_cast<const Property*>(container)->Size());
+				};
+			}
 
-				itr.m_nextFunc = m_nextFunc;
-				itr.m_prevFunc = m_prevFunc;
-				itr.m_destroyFunc = m_destroyFunc;
-				itr.m_elementFunc = m_elementFunc;
-				itr.m_copyFunc = m_copyFunc;
-				itr.m_compareFunc = m_compareFunc;
+			if constexpr (Utils::HasStdData<Property>::value)
+			{
+				operations.dataFunc = [](const void* container) -> const void*
+				{
+					return static_cast<const void*>(static_cast<const Property*>(container)->data());
+				};
+			}
+			else if constexpr (Utils::HasData<Property>::value)
+			{
+				operations.dataFunc = [](const void* container) -> const void*
+				{
+					return static_cast<const void*>(static_cast<const Property*>(container)->Data());
+				};
+			}
 
-				return itr;
+			if constexpr (Utils::HasStdFind<Property>::value)
+			{
+				operations.findFunc = [](const void* container, const void* key) -> const void*
+				{
+					using KeyType = typename Utils::KeyTraits<Property>::KeyType;
+
+					const Property* property = static_cast<const Property*>(container);
+					const auto itr = property->find(*static_cast<const KeyType*>(key));
+
+					return (itr == property->end()) ? nullptr : static_cast<const void*>(&(*itr));
+				};
 			}
-			else
+			else if constexpr (Utils::HasFind<Property>::value)
 			{
-				return Iterator();
+				operations.findFunc = [](const void* container, const void* key) -> const void*
+				{
+					using KeyType = typename Utils::KeyTraits<Property>::KeyType;
+
+					const Property* property = static_cast<const Property*>(container);
+					const auto itr = property->Find(*static_cast<const KeyType*>(key));
+
+					return (itr == property->end()) ? nullptr : static_cast<const void*>(&(*itr));
+				};
+			}
+
+			if constexpr (Utils::HasStdClear<Property>::value)
+			{
+				operations.clearFunc = [](void* container)
+				{
+					static_cast<Property*>(container)->clear();
+				};
+			}
+			else if constexpr (Utils::HasClear<Property>::value)
+			{
+				operations.clearFunc = [](void* container)
+				{
+					static_cast<Property*>(container)->Clear();
+				};
+			}
+
+			if constexpr (Utils::HasStdReserve<Property>::value)
+			{
+				operations.reserveFunc = [](void* container, size_t size)
+				{
+					static_cast<Property*>(container)->reserve(size);
+				};
+			}
+			else if constexpr (Utils::HasReserve<Property>::value)
+			{
+				operations.reserveFunc = [](void* container, size_t size)
+				{
+					static_cast<Property*>(container)->Reserve(size);
+				};
+			}
+
+			operations.insertFunc = CreateInsertFunc<Property>();
+
+			if constexpr (Utils::HasStdErase<Property>::value)
+			{
+				operations.eraseFunc = [](void* container, const void* key)
+				{
+					using KeyType = typename Utils::KeyTraits<Property>::KeyType;
+
+					static_cast<Property*>(container)->erase(*static_cast<const KeyType*>(key));
+				};
+			}
+			else if constexpr (Utils::HasErase<Property>::value)
+			{
+				operations.eraseFunc = [](void* container, const void* key)
+				{
+					using KeyType = typename Utils::KeyTraits<Property>::KeyType;
+
+					static_cast<Property*>(container)->Erase(*static_cast<const KeyType*>(key));
+				};
+			}
+
+			if constexpr (std::is_default_constructible<typename Utils::ValueTraits<Property>::ValueType>::value)
+			{
+				if constexpr (Utils::HasStdResize<Property>::value)
+				{
+					operations.resizeFunc = [](void* container, size_t size)
+					{
+						static_cast<Property*>(container)->resize(size);
+					};
+				}
+				else if constexpr (Utils::HasResize<Property>::value)
+				{
+					operations.resizeFunc = [](void* container, size_t size)
+					{
+						static_cast<Property*>(container)->Resize(size);
+					};
+				}
 			}
+
+			return operations;
 		}
 
-		Iterator end(const void* container) const
+		template<typename Property>
+		static InsertFunc CreateInsertFunc()
 		{
-			if (nullptr != m_endFunc)
+			using ValueType = typename Utils::ValueTraits<Property>::ValueType;
+
+			if constexpr (!std::is_copy_constructible<ValueType>::value)
 			{
-				Iterator itr;
-				m_endFunc(container, itr);
+				return nullptr;
+			}
+			else if constexpr (Utils::IsArray<Property> && Utils::HasStdPushBack<Property>::value)
+			{
+				return [](void* container, const void* element) -> void*
+				{
+					Property* property = static_cast<Property*>(container);
+					property->push_back(*static_cast<const ValueType*>(element));
 
-				itr.m_nextFunc = m_nextFunc;
-				itr.m_prevFunc = m_prevFunc;
-				itr.m_destroyFunc = m_destroyFunc;
-				itr.m_elementFunc = m_elementFunc;
-				itr.m_copyFunc = m_copyFunc;
-				itr.m_compareFunc = m_compareFunc;
+					return static_cast<void*>(&property->back());
+				};
+			}
+			else if constexpr (Utils::IsArray<Property> && Utils::HasPushBack<Property>::value)
+			{
+				return [](void* container, const void* element) -> void*
+				{
+					Property* property = static_cast<Property*>(container);
+					property->PushBack(*static_cast<const ValueType*>(element));
 
-				return itr;
+					auto itr = property->end();
+					--itr;
+
+					return const_cast<void*>(static_cast<const void*>(&(*itr)));
+				};
+			}
+			else if constexpr (!Utils::IsArray<Property> && (Utils::HasStdInsert<Property>::value || Utils::HasInsert<Property>::value)
+				&& (Utils::HasStdFind<Property>::value || Utils::HasFind<Property>::value))
+			{
+				return [](void* container, const void* element) -> void*
+				{
+					Property* property = static_cast<Property*>(container);
+					const ValueType& value = *static_cast<const ValueType*>(element);
+
+					if constexpr (Utils::HasStdInsert<Property>::value)
+					{
+						property->insert(value);
+					}
+					else
+					{
+						property->Insert(value);
+					}
+
+					const auto& key = Utils::GetKey(value);
+					
+					if constexpr (Utils::HasStdFind<Property>::value)
+					{
+						return const_cast<void*>(static_cast<const void*>(&(*property->find(key))));
+					}
+					else
+					{
+						return const_cast<void*>(static_cast<const void*>(&(*property->Find(key))));
+					}
+				};
 			}
 			else
 			{
-				return Iterator();
+				return nullptr;
 			}
 		}
 
+	public :
+		/**
+		 * @brief	Compares the contents of two containers of this property's type.
+		 * @details	Used by TypeInfo::Equals. Keyed containers are compared independently of the iteration order.
+		 * @param	lhs The address of the first container.
+		 * @param	rhs The address of the second container.
+		 * @return	bool True if both containers hold structurally equal elements.
+		 */
+		virtual bool Equals(const void* lhs, const void* rhs) const = 0;
+
+		/**
+		 * @brief	Hashes the contents of a container of this property's type.
+		 * @details	Used by TypeInfo::Hash. Keyed containers are hashed independently of the iteration order.
+		 * @param	container The address of the container.
+		 * @param	seed      The initial hash value.
+		 * @return	size_t The hash value.
+		 */
+		virtual size_t Hash(const void* container, size_t seed) const = 0;
+
+		/**
+		 * @brief	Computes the element-level changes turning the lhs container into the rhs container.
+		 * @details	Used by TypeInfo::Diff. Trivially-copyable elements are compared with memcmp.
+		 * @param	lhs   The address of the old container.
+		 * @param	rhs   The address of the new container.
+		 * @param	delta The delta to fill, already reset for this property.
+		 * @return	bool True if the containers differ.
+		 */
+		virtual bool Diff(const void* lhs, const void* rhs, ElementDelta& delta) const = 0;
+
+		/**
+		 * @brief	Applies element-level changes computed by Diff, touching only the changed elements.
+		 * @param	container The address of the container to update, equal to the lhs of Diff.
+		 * @param	source    The address of the container the changes are read from, the copy of the rhs of Diff kept by the PropertyDiff.
+		 * @param	delta     The changes computed by Diff.
+		 */
+		virtual void ApplyDiff(void* container, const void* source, const ElementDelta& delta) const = 0;
+
+	protected :
+		/**
+		 * @brief	Copies the whole container, the fallback when the elements cannot be updated one by one.
+		 */
+		void Assign(void* container, const void* source) const;
+
 	private :
-		BeginFunc m_beginFunc;
-		EndFunc m_endFunc;
-		NextFunc m_nextFunc;
-		PrevFunc m_prevFunc;
-		DestroyFunc m_destroyFunc;
-		ElementFunc m_elementFunc;
-		CopyFunc m_copyFunc;
-		CompareFunc m_compareFunc;
+		const Operations* m_operations;
 	};
 
 	class ArrayPropertyInfo : public ContainerPropertyInfo
@@ -296,21 +657,36 @@ namespace Reflection
 
 			Initializer(const size_t offset)
 				: PropertyInfo::Initializer<Type, Property>(offset)
-				, valueType(TypeInfo::Get<ValueType>())
+				, valueType(GetElementType<ValueType>())
 			{}
 		};
 
 	public :
 		template<typename Type, typename Property>
-		explicit ArrayPropertyInfo(const Initializer<Type, Property>& initializer, const std::string& propertyName)
-			: ContainerPropertyInfo(initializer, propertyName)
+		explicit ArrayPropertyInfo(const Initializer<Type, Property>& initializer, std::string_view propertyName, PropertyFlag flags = PropertyFlag::None)
+			: ContainerPropertyInfo(initializer, propertyName, flags)
 			, m_valueType(initializer.valueType)
 		{
 		}
 
+	protected :
+		ArrayPropertyInfo(const ArrayPropertyInfo& other, const TypeInfo* ownerType, size_t baseOffset)
+			: ContainerPropertyInfo(other, ownerType, baseOffset)
+			, m_valueType(other.m_valueType)
+		{
+		}
+
 	public :
 		const TypeInfo* GetValueType() const { return m_valueType; }
 
+		const PropertyInfo* Rebase(const TypeInfo* ownerType, size_t baseOffset) const override;
+
+		bool Equals(const void* lhs, const void* rhs) const override;
+		size_t Hash(const void* container, size_t seed) const override;
+
+		bool Diff(const void* lhs, const void* rhs, ElementDelta& delta) const override;
+		void ApplyDiff(void* container, const void* source, const ElementDelta& delta) const override;
+
 	private :
 		const TypeInfo* m_valueType;
 	};
@@ -338,17 +714,33 @@ namespace Reflection
 
 	public:
 		template<typename Type, typename Property>
-		explicit SetPropertyInfo(const Initializer<Type, Property>& initializer, const std::string& propertyName)
-			: ContainerPropertyInfo(initializer, propertyName)
+		explicit SetPropertyInfo(const Initializer<Type, Property>& initializer, std::string_view propertyName, PropertyFlag flags = PropertyFlag::None)
+			: ContainerPropertyInfo(initializer, propertyName, flags)
 			, m_valueType(initializer.valueType)
 			, m_keyType(initializer.keyType)
 		{
 		}
 
+	protected :
+		SetPropertyInfo(const SetPropertyInfo& other, const TypeInfo* ownerType, size_t baseOffset)
+			: ContainerPropertyInfo(other, ownerType, baseOffset)
+			, m_valueType(other.m_valueType)
+			, m_keyType(other.m_keyType)
+		{
+		}
+
 	public :
 		const TypeInfo* GetValueType() const { return m_valueType; }
 		const TypeInfo* GetKeyType() const { return m_keyType; }
 
+		const PropertyInfo* Rebase(const TypeInfo* ownerType, size_t baseOffset) const override;
+
+		bool Equals(const void* lhs, const void* rhs) const override;
+		size_t Hash(const void* container, size_t seed) const override;
+
+		bool Diff(const void* lhs, const void* rhs, ElementDelta& delta) const override;
+		void ApplyDiff(void* container, const void* source, const ElementDelta& delta) const override;
+
 	private :
 		const TypeInfo* m_valueType;
 		const TypeInfo* m_keyType;
@@ -377,7 +769,7 @@ namespace Reflection
 				: PropertyInfo::Initializer<Type, Property>(offset)
 				, valueType(TypeInfo::Get<ValueType>())
 				, keyType(TypeInfo::Get<KeyType>())
-				, mappedType(TypeInfo::Get<MappedType>())
+				, mappedType(GetElementType<MappedType>())
 				, keyOffset(reinterpret_cast<size_t>(&(static_cast<ValueType*>(nullptr)->first)))
 				, mappedOffset(reinterpret_cast<size_t>(&(static_cast<ValueType*>(nullptr)->second)))
 			{}
@@ -385,8 +777,8 @@ namespace Reflection
 
 	public:
 		template<typename Type, typename Property>
-		explicit MapPropertyInfo(const Initializer<Type, Property>& initializer, const std::string& propertyName)
-			: ContainerPropertyInfo(initializer, propertyName)
+		explicit MapPropertyInfo(const Initializer<Type, Property>& initializer, std::string_view propertyName, PropertyFlag flags = PropertyFlag::None)
+			: ContainerPropertyInfo(initializer, propertyName, flags)
 			, m_valueType(initializer.valueType)
 			, m_keyType(initializer.keyType)
 			, m_mappedType(initializer.mappedType)
@@ -395,6 +787,17 @@ namespace Reflection
 		{
 		}
 
+	protected :
+		MapPropertyInfo(const MapPropertyInfo& other, const TypeInfo* ownerType, size_t baseOffset)
+			: ContainerPropertyInfo(other, ownerType, baseOffset)
+			, m_valueType(other.m_valueType)
+			, m_keyType(other.m_keyType)
+			, m_mappedType(other.m_mappedType)
+			, m_keyOffset(other.m_keyOffset)
+			, m_mappedOffset(other.m_mappedOffset)
+		{
+		}
+
 	public :
 		const TypeInfo* GetValueType() const { return m_valueType; }
 		const TypeInfo* GetKeyType() const { return m_keyType; }
@@ -416,6 +819,14 @@ namespace Reflection
 			return reinterpret_cast<const void*>(address);
 		}
 
+		const PropertyInfo* Rebase(const TypeInfo* ownerType, size_t baseOffset) const override;
+
+		bool Equals(const void* lhs, const void* rhs) const override;
+		size_t Hash(const void* container, size_t seed) const override;
+
+		bool Diff(const void* lhs, const void* rhs, ElementDelta& delta) const override;
+		void ApplyDiff(void* container, const void* source, const ElementDelta& delta) const override;
+
 	private :
 		const TypeInfo* m_valueType;
 		const TypeInfo* m_keyType;
@@ -424,6 +835,25 @@ namespace Reflection
 		const size_t m_keyOffset;
 		const size_t m_mappedOffset;
 	};
+
+	template<typename Element>
+	const TypeInfo* GetElementType()
+	{
+		const TypeInfo* elementType = TypeInfo::Get<Element>();
+
+		if constexpr (Utils::IsArray<Element> || Utils::IsSet<Element> || Utils::IsMap<Element>)
+		{
+			using Description = typename Utils::Conditional<Utils::IsArray<Element>, ArrayPropertyInfo,
+				typename Utils::Conditional<Utils::IsSet<Element>, SetPropertyInfo, MapPropertyInfo>::Type>::Type;
+
+			static typename Description::template Initializer<void, Element> initializer(0);
+			static Description description(initializer, elementType->GetTypeName());
+
+			const_cast<TypeInfo*>(elementType)->SetContainer(&description);
+		}
+
+		return elementType;
+	}
 };
 
 #endif // __REFLECTION_CONTAINERPROPERTYINFO_H__
\ No newline at end of file
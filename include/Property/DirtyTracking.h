@@ -0,0 +1,57 @@
+#ifndef __REFLECTION_DIRTYTRACKING_H__
+#define __REFLECTION_DIRTYTRACKING_H__
+
+#include "Type/TypeInfo.h"
+#include "Property/PropertyMask.h"
+
+namespace Reflection
+{
+	/**
+	 * @brief	Checks if any reflected property of a tracked instance was written since the last ConsumeDirty.
+	 * @tparam	T The instance type, declared with GENERATE_TRACKED.
+	 */
+	template<typename T>
+	bool IsDirty(const T& instance)
+	{
+		static_assert(Utils::HasDirtyMask<T>::value, "Reflection::IsDirty : The type must be declared with GENERATE_TRACKED.");
+
+		return instance.GetDirtyMask().Any();
+	}
+
+	/**
+	 * @brief	Moves the dirty mask of a tracked instance into the output mask and clears it.
+	 * @details	Replication and save systems call this once per frame and process only the set ordinals,
+	 * 			which index the instance's TypeInfo::GetPropertyList().
+	 * @tparam	T The instance type, declared with GENERATE_TRACKED.
+	 * @param	instance The tracked instance.
+	 * @param	dirty    The mask receiving the written ordinals. Its storage is reused.
+	 * @return	bool True if any property was written.
+	 */
+	template<typename T>
+	bool ConsumeDirty(T& instance, PropertyMask& dirty)
+	{
+		static_assert(Utils::HasDirtyMask<T>::value, "Reflection::ConsumeDirty : The type must be declared with GENERATE_TRACKED.");
+
+		PropertyMask& mask = instance.GetDirtyMask();
+
+		dirty.Clear();
+		dirty |= mask;
+		mask.Clear();
+
+		return dirty.Any();
+	}
+
+	/**
+	 * @brief	Returns the dirty mask of a tracked instance and clears it.
+	 */
+	template<typename T>
+	PropertyMask ConsumeDirty(T& instance)
+	{
+		PropertyMask dirty;
+		ConsumeDirty(instance, dirty);
+
+		return dirty;
+	}
+};
+
+#endif // __REFLECTION_DIRTYTRACKING_H__
\ No newline at end of file
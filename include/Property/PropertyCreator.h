@@ -10,14 +10,14 @@ namespace Reflection
 	template<typename Pointer, Pointer pointer, typename = void>
 	struct PropertyCreator
 	{
-		static const PropertyInfo* Create(const std::string& propertyName)
+		static const PropertyInfo* Create(std::string_view propertyName, PropertyFlag flags)
 		{
 			using Class = typename Utils::MemberTraits<Pointer>::ClassType;
 			using Property = typename Utils::MemberTraits<Pointer>::PropertyType;
 
 			static size_t offset = reinterpret_cast<size_t>(&(static_cast<Class*>(nullptr)->*pointer));
 			static PropertyInfo::Initializer<Class, Property> initializer(offset);
-			static Reflection::PropertyInfo propertyInfo(initializer, propertyName);
+			static Reflection::PropertyInfo propertyInfo(initializer, propertyName, flags);
 
 			return &propertyInfo;
 		}
@@ -26,11 +26,11 @@ namespace Reflection
 	template<typename Class, typename Property, Property Class::* pointer>
 	struct PropertyCreator<Property Class::*, pointer, typename Utils::IsEnabled_t<Utils::IsArray<Property>>>
 	{
-		static const PropertyInfo* Create(const std::string& propertyName)
+		static const PropertyInfo* Create(std::string_view propertyName, PropertyFlag flags)
 		{
 			static size_t offset = reinterpret_cast<size_t>(&(static_cast<Class*>(nullptr)->*pointer));
 			static ArrayPropertyInfo::Initializer<Class, Property> initializer(offset);
-			static Reflection::ArrayPropertyInfo propertyInfo(initializer, propertyName);
+			static Reflection::ArrayPropertyInfo propertyInfo(initializer, propertyName, flags);
 
 			return &propertyInfo;
 		}
@@ -39,11 +39,11 @@ namespace Reflection
 	template<typename Class, typename Property, Property Class::* pointer>
 	struct PropertyCreator<Property Class::*, pointer, typename Utils::IsEnabled_t<Utils::IsSet<Property>>>
 	{
-		static const PropertyInfo* Create(const std::string& propertyName)
+		static const PropertyInfo* Create(std::string_view propertyName, PropertyFlag flags)
 		{
 			static size_t offset = reinterpret_cast<size_t>(&(static_cast<Class*>(nullptr)->*pointer));
 			static SetPropertyInfo::Initializer<Class, Property> initializer(offset);
-			static Reflection::SetPropertyInfo propertyInfo(initializer, propertyName);
+			static Reflection::SetPropertyInfo propertyInfo(initializer, propertyName, flags);
 
 			return &propertyInfo;
 		}
@@ -52,11 +52,11 @@ namespace Reflection
 	template<typename Class, typename Property, Property Class::* pointer>
 	struct PropertyCreator<Property Class::*, pointer, typename Utils::IsEnabled_t<Utils::IsMap<Property>>>
 	{
-		static const PropertyInfo* Create(const std::string& propertyName)
+		static const PropertyInfo* Create(std::string_view propertyName, PropertyFlag flags)
 		{
 			static size_t offset = reinterpret_cast<size_t>(&(static_cast<Class*>(nullptr)->*pointer));
 			static MapPropertyInfo::Initializer<Class, Property> initializer(offset);
-			static Reflection::MapPropertyInfo propertyInfo(initializer, propertyName);
+			static Reflection::MapPropertyInfo propertyInfo(initializer, propertyName, flags);
 
 			return &propertyInfo;
 		}
@@ -0,0 +1,156 @@
+#ifndef __REFLECTION_PROPERTYDIFF_H__
+#define __REFLECTION_PROPERTYDIFF_H__
+
+#include <vector>
+
+#include "Property/PropertyMask.h"
+
+namespace Reflection
+{
+	class TypeInfo;
+
+	/**
+	 * @struct	ElementDelta
+	 * @brief	Element-level changes of a single container property.
+	 * @details	Indices follow the iteration order of the source (new) container.
+	 * 			For arrays they are the changed positions shared by both containers;
+	 * 			for sets and maps they are the added elements (and, for maps, the elements whose mapped value changed).
+	 * 			When the container cannot be compared element by element (no find or erase), full is set
+	 * 			and the whole container is copied on apply.
+	 */
+	struct ElementDelta
+	{
+		size_t ordinal;
+		size_t size;
+		size_t removed;
+		bool full;
+		std::vector<size_t> indices;
+
+		void Reset(size_t propertyOrdinal)
+		{
+			ordinal = propertyOrdinal;
+			size = 0;
+			removed = 0;
+			full = false;
+			indices.clear();
+		}
+	};
+
+	/**
+	 * @struct	PropertyValue
+	 * @brief	The new value of a changed property, stored in a PropertyDiff.
+	 */
+	struct PropertyValue
+	{
+		size_t ordinal;
+		const TypeInfo* type;
+		size_t offset;
+		bool stored;
+	};
+
+	/**
+	 * @class	PropertyDiff
+	 * @brief	Result of TypeInfo::Diff, the changed properties of an instance and their new values.
+	 * @details	The mask holds the ordinals of every changed property, containers included.
+	 * 			Container properties also record an ElementDelta, ordered by property offset.
+	 * 			Every changed property keeps a copy of its new value, so the diff is applied without the instance
+	 * 			it was computed from. A changed container is copied whole and its ElementDelta indexes the copy,
+	 * 			so applying it still touches only the changed elements.
+	 * 			A PropertyDiff can be reused across calls, so diffing many instances does not allocate
+	 * 			once the element and value buffers have grown (values owning memory, like strings, still copy it).
+	 */
+	class PropertyDiff
+	{
+		public :
+			PropertyDiff();
+			~PropertyDiff();
+
+			PropertyDiff(PropertyDiff&& other) noexcept;
+			PropertyDiff& operator=(PropertyDiff&& other) noexcept;
+
+			PropertyDiff(const PropertyDiff&) = delete;
+			PropertyDiff& operator=(const PropertyDiff&) = delete;
+
+		public :
+			const PropertyMask& GetMask() const { return m_mask; }
+			PropertyMask& GetMask() { return m_mask; }
+
+			const ElementDelta* GetElements() const { return m_elements.data(); }
+			ElementDelta* GetElements() { return m_elements.data(); }
+			size_t GetElementCount() const { return m_elementCount; }
+
+			const PropertyValue* GetValues() const { return m_values.data(); }
+			size_t GetValueCount() const { return m_valueCount; }
+
+			/**
+			 * @brief	Gets the stored new value of the index-th changed property.
+			 * @return	const void* The address of the value, or nullptr if its type cannot be copied.
+			 */
+			const void* GetValue(size_t index) const;
+
+			bool Empty() const { return !m_mask.Any(); }
+
+			/**
+			 * @brief	Destroys the stored values and empties the diff, keeping its buffers.
+			 */
+			void Clear();
+
+			/**
+			 * @brief	Adds an element delta for a container property, reusing the storage of previous calls.
+			 */
+			ElementDelta& AddElementDelta(size_t ordinal)
+			{
+				if (m_elementCount == m_elements.size())
+				{
+					m_elements.emplace_back();
+				}
+
+				ElementDelta& delta = m_elements[m_elementCount++];
+				delta.Reset(ordinal);
+
+				return delta;
+			}
+
+			/**
+			 * @brief	Drops the last element delta, when the container turned out to be unchanged.
+			 */
+			void PopElementDelta()
+			{
+				if (0 != m_elementCount)
+				{
+					--m_elementCount;
+				}
+			}
+
+			/**
+			 * @brief	[Internal Use Only] Reserves room for the new value of a changed property. Called by TypeInfo::Diff.
+			 */
+			void AddValue(size_t ordinal, const TypeInfo* type);
+
+			/**
+			 * @brief	[Internal Use Only] Copies the index-th new value from source, once every value has been added.
+			 * @return	bool False if the type of the value cannot be copied.
+			 */
+			bool StoreValue(size_t index, const void* source);
+
+		private :
+			void Release();
+
+		private :
+			PropertyMask m_mask;
+			std::vector<ElementDelta> m_elements;
+			size_t m_elementCount;
+
+			std::vector<PropertyValue> m_values;
+			size_t m_valueCount;
+
+			// The values are laid out first and copied into a buffer sized once, so a value never moves.
+			void* m_buffer;
+			size_t m_bufferSize;
+			size_t m_bufferAlignment;
+			size_t m_valueBytes;
+			size_t m_valueAlignment;
+	};
+};
+
+#endif // __REFLECTION_PROPERTYDIFF_H__
\ No newline at end of file
@@ -0,0 +1,47 @@
+#ifndef __REFLECTION_PROPERTYFLAG_H__
+#define __REFLECTION_PROPERTYFLAG_H__
+
+#include <cstdint>
+#include <string_view>
+
+#include "Type/EnumInfo.h"
+
+namespace Reflection
+{
+	/**
+	 * @brief	Attributes attached to a property by the PROPERTY macro, e.g. PROPERTY(m_cache, Transient).
+	 * @details	Each flag has its own precomputed property lists in TypeInfo (GetPropertiesWith / GetPropertiesWithout).
+	 * 			JsonWriter and JsonReader skip Transient properties. User0 to User3 are free for the application.
+	 */
+	enum class PropertyFlag : uint32_t
+	{
+		None = 0,
+		Transient = 1 << 0,
+		Replicated = 1 << 1,
+		EditorOnly = 1 << 2,
+		SaveGame = 1 << 3,
+		User0 = 1 << 4,
+		User1 = 1 << 5,
+		User2 = 1 << 6,
+		User3 = 1 << 7,
+	};
+
+	GENERATE_FLAGS(PropertyFlag, None, Transient, Replicated, EditorOnly, SaveGame, User0, User1, User2, User3)
+
+	/**
+	 * @brief	The number of flag bits, and so of per-flag property lists.
+	 */
+	constexpr size_t PropertyFlagCount = 8;
+
+	constexpr PropertyFlag operator|(PropertyFlag lhs, PropertyFlag rhs)
+	{
+		return static_cast<PropertyFlag>(static_cast<uint32_t>(lhs) | static_cast<uint32_t>(rhs));
+	}
+
+	constexpr PropertyFlag operator&(PropertyFlag lhs, PropertyFlag rhs)
+	{
+		return static_cast<PropertyFlag>(static_cast<uint32_t>(lhs) & static_cast<uint32_t>(rhs));
+	}
+};
+
+#endif // __REFLECTION_PROPERTYFLAG_H__
\ No newline at end of file
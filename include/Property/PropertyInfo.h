@@ -2,12 +2,18 @@
 #define __REFLECTION_PROPERTYINFO_H__
 
 #include <string>
+#include <string_view>
+#include <atomic>
+#include <cstdint>
 
 #include "Type/TypeCast.h"
 #include "Type/TypeMacro.h"
+#include "Property/PropertyFlag.h"
 
 namespace Reflection
 {
+	struct PropertyChange;
+
 	/**
 	 * @class	PropertyInfo
 	 * @brief	Class that holds information about a property in the reflection system.
@@ -22,7 +28,7 @@ namespace Reflection
 			 * @brief	Template struct for initializing PropertyInfo instances.
 			 * @details The propertyOffset is calculated via reinterpret_cast to safely support 
 			 * 			non-standard-layout types (e.g., classes with virtual functions).
-			 * @tparam	Type   The owner type of the property.
+			 * @tparam	Type   The owner type of the property, void for the ownerless description of a nested container.
 			 * @tparam	Property The property type.
 			 */
 			template<typename Type, typename Property>
@@ -33,10 +39,22 @@ namespace Reflection
 				const size_t propertyOffset;
 
 				Initializer(const size_t offset)
-					: ownerType(TypeInfo::Get<Type>())
+					: ownerType(GetOwnerType())
 					, propertyType(TypeInfo::Get<Property>())
 					, propertyOffset(offset)
 				{}
+
+				static const TypeInfo* GetOwnerType()
+				{
+					if constexpr (Utils::IsSame<Type, void>::value)
+					{
+						return nullptr;
+					}
+					else
+					{
+						return TypeInfo::Get<Type>();
+					}
+				}
 			};
 
 			/**
@@ -49,6 +67,15 @@ namespace Reflection
 			*/
 			using Assigner = void(*)(void* instance, const void* value);
 
+			/**
+			 * @brief	Bits of the write hooks enabled on a property.
+			 * @details	HookDirty is enabled when a tracked type (GENERATE_TRACKED) owns the property.
+			 * 			HookObserve is enabled while an observer of the property or of its owner type is subscribed.
+			 */
+			static constexpr uint8_t HookNone = 0;
+			static constexpr uint8_t HookDirty = 1 << 0;
+			static constexpr uint8_t HookObserve = 1 << 1;
+
 		public :
 			/**
 			 * @brief	Constructor for PropertyInfo. Registers the property with the owner TypeInfo.
@@ -60,15 +87,19 @@ namespace Reflection
 			 * @tparam	Type     The owner type of the property.
 			 * @tparam	Property The property type.
 			 * @param	initializer The initializer containing property metadata.
-			 * @param	propertyName The name of the property.
+			 * @param	propertyName The name of the property, interned with the owner's name as "Owner::name".
+			 * @param	flags The attributes given to the PROPERTY macro.
 			 */
 			template<typename Type, typename Property>
-			explicit PropertyInfo(const Initializer<Type, Property>& initializer, const std::string& propertyName)
-				: m_propertyName(initializer.ownerType != nullptr ? initializer.ownerType->GetTypeName() + "::" + propertyName : propertyName)
+			explicit PropertyInfo(const Initializer<Type, Property>& initializer, std::string_view propertyName, PropertyFlag flags = PropertyFlag::None)
+				: m_propertyName(NamePool::GetHandle().Intern(nullptr != initializer.ownerType ? initializer.ownerType->GetTypeName() : std::string_view(), propertyName))
 				, m_propertyOffset(initializer.propertyOffset)
 				, m_propertyType(initializer.propertyType)
 				, m_ownerType(initializer.ownerType)
 				, m_propertyAssigner(nullptr)
+				, m_propertyOrdinal(nullptr != initializer.ownerType ? initializer.ownerType->GetPropertyList().size() : 0)
+				, m_hooks(HookNone)
+				, m_flags(flags)
 			{
 				TypeInfo* ownerType = const_cast<TypeInfo*>(m_ownerType);
 				if (nullptr != ownerType)
@@ -83,6 +114,8 @@ namespace Reflection
 				};
 			}
 
+			virtual ~PropertyInfo() = default;
+
 			bool operator==(const PropertyInfo& other) const;
 
 		public :
@@ -128,6 +161,7 @@ namespace Reflection
 				{
 					if (!IsSame(m_propertyType, inputType) && !IsChild(m_propertyType->GetPureType(), inputType->GetPureType()))
 					{
+						REFLECTION_COUNT(SetTypeMismatch);
 						return;
 					}
 				}
@@ -135,6 +169,7 @@ namespace Reflection
 				{
 					if (!IsSame(m_propertyType, inputType))
 					{
+						REFLECTION_COUNT(SetTypeMismatch);
 						return;
 					}
 				}
@@ -191,6 +226,23 @@ namespace Reflection
 				{
 					m_propertyAssigner(reinterpret_cast<void*>(address), value);
 				}
+
+				if (HookNone != m_hooks.load(std::memory_order_relaxed))
+				{
+					OnWrite(instance);
+				}
+			}
+
+			/**
+			 * @brief	Records a write made to the property without SetRaw (e.g. through the pointer returned by Get).
+			 * @param	instance The raw address of the instance.
+			 */
+			void MarkWritten(void* instance) const
+			{
+				if (HookNone != m_hooks.load(std::memory_order_relaxed))
+				{
+					OnWrite(instance);
+				}
 			}
 
 		private :
@@ -226,24 +278,80 @@ namespace Reflection
 					}
 				}
 
+				REFLECTION_COUNT(GetTypeMismatch);
 				return nullptr;
 			}
 
+			/**
+			 * @brief	Runs the enabled write hooks, the slow path of SetRaw.
+			 */
+			void OnWrite(void* instance) const;
+
 		public :
-			const std::string& GetPropertyName() const;
+			std::string_view GetPropertyName() const;
 			size_t GetPropertyOffset() const;
 
+			/**
+			 * @brief	Gets the index of the property in the owner's TypeInfo::GetPropertyList().
+			 * @details	Properties inherited from the primary base keep the same ordinal in the derived types.
+			 * 			The copies made for the secondary bases (see Rebase) get their ordinal in the derived type.
+			 */
+			size_t GetPropertyOrdinal() const;
+
+			/**
+			 * @brief	[Internal Use Only] Copies this property for a derived type holding its owner at baseOffset.
+			 * @details	The copy keeps the name, type and flags, is owned by ownerType and starts at baseOffset plus the offset
+			 * 			of this property. Called by TypeInfo for the properties of the secondary bases, which deletes the copy.
+			 */
+			virtual const PropertyInfo* Rebase(const TypeInfo* ownerType, size_t baseOffset) const;
+
+			/**
+			 * @brief	[Internal Use Only] Enables write hooks on this property.
+			 */
+			void EnableHooks(uint8_t hooks) const;
+			void DisableHooks(uint8_t hooks) const;
+			uint8_t GetHooks() const;
+
+			/**
+			 * @brief	Observes the reflected writes of this property. Notifications are delivered by ObserverManager::Flush.
+			 * @return	size_t The handle to pass to Unsubscribe.
+			 */
+			size_t Subscribe(std::function<void(const PropertyChange* changes, size_t count)> observer) const;
+			void Unsubscribe(size_t handle) const;
+
 			const TypeInfo* GetOwnerType() const;
 			const TypeInfo* GetPropertyType() const;
 
+			PropertyFlag GetFlags() const;
+
+			/**
+			 * @brief	Checks if the property has every flag of the mask.
+			 */
+			bool HasFlags(PropertyFlag flags) const;
+
+			/**
+			 * @brief	Gets the bytes of this property object, of its dynamic type. Used by TypeManager::GetMemoryStats.
+			 */
+			size_t GetMetadataBytes() const;
+
+		protected :
+			/**
+			 * @brief	Constructor of the copies made by Rebase. The copy is not added to ownerType.
+			 */
+			PropertyInfo(const PropertyInfo& other, const TypeInfo* ownerType, size_t baseOffset);
+
 		protected :
-			const std::string m_propertyName;
+			const std::string_view m_propertyName;
 			const size_t m_propertyOffset;
 
 			const TypeInfo* m_propertyType;
 			const TypeInfo* m_ownerType;
 
 			Assigner m_propertyAssigner;
+
+			const size_t m_propertyOrdinal;
+			mutable std::atomic<uint8_t> m_hooks;
+			const PropertyFlag m_flags;
 	};
 };
 
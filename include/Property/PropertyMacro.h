@@ -1,9 +1,12 @@
 #ifndef __REFLECTION_PROPERTYMACRO_H__
 #define __REFLECTION_PROPERTYMACRO_H__
 
+#include <cassert>
+
 #include "Macro.h"
 #include "Property/PropertyInfo.h"
 #include "Property/PropertyCreator.h"
+#include "Property/StaticProperty.h"
 
 /**
  * @brief	Registers a property into the Reflection System.
@@ -14,17 +17,36 @@
  * 				This technique is used to safely compute the member offset for **non-standard-layout types** * 
  * 				(e.g., classes with virtual functions) where the standard `offsetof` macro is conditionally supported.
  * 			It also statically asserts that the property is not a reference type, as pointers to references are not valid in C++.
+ * 			**Static Property List:** 
+ * 				The macro also appends a `StaticProperty` entry to the compile-time property list of the class.
+ * 				The index is taken from the `StaticPropertyCounter` overloads declared so far in the class body,
+ * 				and a new overload returning the next index is declared right after it.
+ * 				The runtime registration goes through the same entry, so `ForEachProperty` and `TypeInfo` stay in sync.
+ * 			**Flags:** 
+ * 				The names following the property are PropertyFlag enumerators, e.g. PROPERTY(m_cache, Transient, EditorOnly).
+ * 				They are parsed at compile time, so an unknown name fails to compile.
  * @param	Property The member variable name to register.
+ * @param	...      The PropertyFlag names of the property, if any.
  */
 
-#define PROPERTY( Property ) \
+#define __REFLECTION_PROPERTY_FLAG__( Data, Flag ) | Reflection::ParseEnumName<Reflection::PropertyFlag>(#Flag)
+
+#define PROPERTY( Property, ... ) \
+		static constexpr size_t s_staticPropertyIndex##Property = decltype(StaticPropertyCounter(Reflection::Utils::Rank<Reflection::Utils::MaxStaticProperty>{}))::value; \
+		static constexpr Reflection::PropertyFlag s_propertyFlags##Property = Reflection::PropertyFlag::None __REFLECTION_FOR_EACH__(__REFLECTION_PROPERTY_FLAG__, Property, __VA_ARGS__); \
+		static Reflection::Utils::Counter<s_staticPropertyIndex##Property + 1> StaticPropertyCounter(Reflection::Utils::Rank<s_staticPropertyIndex##Property + 1>); \
+		\
+		static constexpr auto StaticPropertyEntry(Reflection::Utils::Index<s_staticPropertyIndex##Property>) \
+		{ \
+			static_assert(!Reflection::Utils::IsReference<decltype(ThisType::Property)>::value, "Reflection::PROPERTY : The property cannot be a reference type."); \
+			return Reflection::StaticProperty<decltype(&ThisType::Property), &ThisType::Property>(#Property, s_propertyFlags##Property); \
+		} \
+		\
 		struct RegisterProperty##Property \
 		{ \
 			RegisterProperty##Property() \
 			{ \
-				static_assert(!Reflection::Utils::IsReference<decltype(ThisType::Property)>::value, "Reflection::PROPERTY : The property cannot be a reference type."); \
-				static std::string propertyName = std::string(#Property); \
-				static const Reflection::PropertyInfo* property = Reflection::PropertyCreator<decltype(&ThisType::Property), &ThisType::Property>::Create(propertyName); \
+				static const Reflection::PropertyInfo* property = StaticPropertyEntry(Reflection::Utils::Index<s_staticPropertyIndex##Property>{}).GetPropertyInfo(); \
 				assert(nullptr != property && "The property is invalid."); \
 			}; \
 		}; \
@@ -0,0 +1,94 @@
+#ifndef __REFLECTION_PROPERTYMASK_H__
+#define __REFLECTION_PROPERTYMASK_H__
+
+#include <cstdint>
+#include <vector>
+
+#include "Utils.h"
+
+namespace Reflection
+{
+	/**
+	 * @class	PropertyMask
+	 * @brief	Bitset of property ordinals, the indices into TypeInfo::GetPropertyList().
+	 * @details	The first InlineBits ordinals are stored inline, so most types never allocate.
+	 * 			Larger ordinals spill into a heap allocated overflow, which is kept on Clear() for reuse.
+	 */
+	class PropertyMask
+	{
+		public :
+			static constexpr size_t WordBits = 64;
+			static constexpr size_t InlineWords = 2;
+			static constexpr size_t InlineBits = WordBits * InlineWords;
+
+		public :
+			PropertyMask();
+
+		public :
+			void Set(size_t ordinal);
+
+			/**
+			 * @brief	Sets an ordinal with an atomic OR, so threads setting different ordinals do not lose bits.
+			 * @details	Only the inline ordinals are atomic : a larger ordinal may grow the overflow, which needs a single writer.
+			 */
+			void SetAtomic(size_t ordinal);
+
+			void Reset(size_t ordinal);
+			bool Test(size_t ordinal) const;
+
+			/**
+			 * @brief	Checks if any ordinal is set.
+			 */
+			bool Any() const;
+
+			/**
+			 * @brief	Counts the set ordinals.
+			 */
+			size_t Count() const;
+
+			/**
+			 * @brief	Resets every ordinal, keeping the overflow storage.
+			 */
+			void Clear();
+
+			PropertyMask& operator|=(const PropertyMask& other);
+			bool operator==(const PropertyMask& other) const;
+			bool operator!=(const PropertyMask& other) const;
+
+			/**
+			 * @brief	Calls the function with every set ordinal, in increasing order.
+			 * @details	Skips whole zero words and jumps between set bits with a count of trailing zeros.
+			 * @tparam	Func The function type, invocable with a size_t.
+			 */
+			template<typename Func>
+			void ForEach(Func&& func) const
+			{
+				for (size_t index = 0; index < InlineWords; ++index)
+				{
+					ForEachBit(m_inline[index], index * WordBits, func);
+				}
+
+				for (size_t index = 0; index < m_overflow.size(); ++index)
+				{
+					ForEachBit(m_overflow[index], InlineBits + index * WordBits, func);
+				}
+			}
+
+		private :
+			template<typename Func>
+			static void ForEachBit(uint64_t word, const size_t base, Func& func)
+			{
+				while (0 != word)
+				{
+					func(base + Utils::CountTrailingZeros(word));
+					word &= word - 1;
+				}
+			}
+
+		private :
+			uint64_t m_inline[InlineWords];
+			std::vector<uint64_t> m_overflow;
+	};
+};
+
+#endif // __REFLECTION_PROPERTYMASK_H__
\ No newline at end of file
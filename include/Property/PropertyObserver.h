@@ -0,0 +1,137 @@
+#ifndef __REFLECTION_PROPERTYOBSERVER_H__
+#define __REFLECTION_PROPERTYOBSERVER_H__
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "LockFreeQueue.h"
+
+namespace Reflection
+{
+	class TypeInfo;
+	class PropertyInfo;
+
+	/**
+	 * @struct	PropertyChange
+	 * @brief	A reflected write recorded for the observers.
+	 * @details	type is the dynamic type of the instance at the time of the write.
+	 * 			The instance is not dereferenced by the observer system, so it may be gone by the time of the flush.
+	 */
+	struct PropertyChange
+	{
+		void* instance;
+		const PropertyInfo* property;
+		const TypeInfo* type;
+	};
+
+	/**
+	 * @class	ObserverManager
+	 * @brief	Singleton delivering batched notifications of reflected property writes.
+	 * @details	PropertyInfo::SetRaw pushes a PropertyChange into a lock-free queue when the property is observed.
+	 * 			Flush() drains the queue, coalesces the changes to one per (instance, property),
+	 * 			and calls every matching observer with contiguous batches of changes.
+	 * 			Properties nobody observes keep their hook bit cleared, so their writes pay a single branch.
+	 * 			When the queue is full, the changes spill into a mutex protected overflow instead of being lost.
+	 * 			The observers are kept in a copy-on-write list : subscribing copies it, flushing only shares it.
+	 * 			When types are unregistered, their queued changes and their observers are dropped, and the unregistration
+	 * 			waits for the flushes delivering at that time, so no change of an unloaded plugin is delivered.
+	 */
+	class ObserverManager
+	{
+		public :
+			using ObserverFunc = std::function<void(const PropertyChange* changes, size_t count)>;
+			using ObserverHandle = size_t;
+
+			static constexpr ObserverHandle InvalidHandle = 0;
+			static constexpr size_t DefaultQueueCapacity = 64 * 1024;
+			static constexpr size_t DefaultBatchSize = 256;
+
+		private :
+			ObserverManager();
+			~ObserverManager();
+
+		public :
+			static ObserverManager& GetHandle();
+
+		public :
+			/**
+			 * @brief	Observes the writes of a single property, on any instance.
+			 * @return	ObserverHandle The handle to pass to Unsubscribe.
+			 */
+			ObserverHandle Subscribe(const PropertyInfo* property, ObserverFunc observer);
+
+			/**
+			 * @brief	Observes the writes of every property of a type (inherited ones included),
+			 * 			on instances of the type or of its derived types.
+			 * @return	ObserverHandle The handle to pass to Unsubscribe.
+			 */
+			ObserverHandle Subscribe(const TypeInfo* type, ObserverFunc observer);
+
+			/**
+			 * @brief	Removes an observer. Properties left without observers stop recording their writes.
+			 */
+			void Unsubscribe(ObserverHandle handle);
+
+			/**
+			 * @brief	[Internal Use Only] Records a write, called by PropertyInfo on observed properties.
+			 */
+			void Push(const PropertyChange& change);
+
+			/**
+			 * @brief	Delivers the recorded changes, coalesced to one per (instance, property).
+			 * @details	Typically called once per frame. The observers are called without any lock held, so they may
+			 * 			subscribe, unsubscribe or flush again. Observers may write reflected properties; those changes are
+			 * 			delivered by the next Flush. Observers must not unregister types.
+			 * @param	batchSize The maximum number of changes passed to an observer in one call.
+			 * @return	size_t The number of coalesced changes.
+			 */
+			size_t Flush(size_t batchSize = DefaultBatchSize);
+
+		private :
+			struct Observer
+			{
+				ObserverHandle handle;
+				const PropertyInfo* property;
+				const TypeInfo* type;
+				ObserverFunc func;
+			};
+
+			using ObserverList = std::vector<Observer>;
+
+			void AddHooks(const Observer& observer);
+			void RemoveHooks(const Observer& observer);
+			void Deliver(const ObserverFunc& func, const PropertyChange* changes, size_t count, size_t batchSize) const;
+
+			/**
+			 * @brief	Moves the queued changes into the given vector. Called with the flush mutex locked.
+			 */
+			void Drain(std::vector<PropertyChange>& changes);
+
+			/**
+			 * @brief	Drops the queued changes and the observers of an unregistered type, then waits for the running deliveries.
+			 */
+			static void OnUnregist(const TypeInfo* type);
+
+		private :
+			LockFreeQueue<PropertyChange> m_queue;
+
+			std::mutex m_overflowMutex;
+			std::vector<PropertyChange> m_overflow;
+
+			std::mutex m_observerMutex;
+			std::shared_ptr<const ObserverList> m_observers;
+			std::unordered_map<const PropertyInfo*, size_t> m_observedCounts;
+			ObserverHandle m_nextHandle;
+
+			std::mutex m_flushMutex;
+			std::vector<PropertyChange> m_changes;
+			std::vector<PropertyChange> m_batch;
+			std::atomic<size_t> m_deliveries;
+	};
+};
+
+#endif // __REFLECTION_PROPERTYOBSERVER_H__
\ No newline at end of file
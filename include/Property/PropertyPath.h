@@ -0,0 +1,174 @@
+#ifndef __REFLECTION_PROPERTYPATH_H__
+#define __REFLECTION_PROPERTYPATH_H__
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Property/PropertyInfo.h"
+
+namespace Reflection
+{
+	class ContainerPropertyInfo;
+	class ScratchValue;
+
+	/**
+	 * @class	PropertyPath
+	 * @brief	A path to a nested value ("m_transform.m_position.x", "m_MyObject->m_Value", "m_items[2].m_name"),
+	 * 			resolved once into a chain of offsets and dereference steps.
+	 * @details	Members are named unqualified (the most derived declaration wins, as in C++) or qualified ("IObject::m_Value").
+	 * 			'.' and '->' both follow pointer members. Arrays are indexed with [n] and maps / sets are looked up
+	 * 			with [key], where key is an integer, a floating point number or a quoted string.
+	 * 			Nested containers are indexed in turn ("m_grid[1][2]").
+	 * 			Consecutive members are merged into one offset, so evaluating a path costs one add per step
+	 * 			plus one load per pointer and one lookup per container access.
+	 * 			Pointer members are typed by their static pointee type; paths through a base pointer
+	 * 			can only name the members of that base.
+	 */
+	class PropertyPath
+	{
+		public :
+			PropertyPath();
+
+			/**
+			 * @brief	Resolves a path against a type.
+			 * @param	type The type of the instances the path will be evaluated on.
+			 * @param	path The path to resolve.
+			 * @return	PropertyPath The compiled path. IsValid() is false and GetError() describes the problem if the path cannot be resolved.
+			 */
+			static PropertyPath Compile(const TypeInfo* type, std::string_view path);
+
+		public :
+			/**
+			 * @brief	Gets the address of the value the path points to.
+			 * @param	instance The address of an instance of the type the path was compiled for.
+			 * @return	void* The address of the value, or nullptr if a pointer on the way is null,
+			 * 			an index is out of range or a key is missing.
+			 */
+			void* Resolve(void* instance) const;
+			const void* Resolve(const void* instance) const;
+
+			/**
+			 * @brief	Gets the value the path points to.
+			 * @tparam	T The expected type of the value.
+			 * @tparam	U The type of the instance.
+			 * @return	T* A pointer to the value, or nullptr if the value type does not match or the path cannot be followed.
+			 */
+			template<typename T, typename U>
+			T* Get(U& instance) const
+			{
+				const TypeInfo* valueType = TypeInfo::Get<T>();
+				if ((m_valueType != valueType) && !IsSame(m_valueType, valueType))
+				{
+					return nullptr;
+				}
+
+				return static_cast<T*>(Resolve(&instance));
+			}
+
+			template<typename T, typename U>
+			const T* Get(const U& instance) const
+			{
+				const TypeInfo* valueType = TypeInfo::Get<T>();
+				if ((m_valueType != valueType) && !IsSame(m_valueType, valueType))
+				{
+					return nullptr;
+				}
+
+				return static_cast<const T*>(Resolve(static_cast<const void*>(&instance)));
+			}
+
+			/**
+			 * @brief	Assigns the value the path points to.
+			 * @details	A path naming a single member is assigned through PropertyInfo::SetRaw, so the write hooks of the member run.
+			 * 			A deeper value ("m_transform.m_position.x", "m_items[2]") is copy assigned and reported as a write of the
+			 * 			first member of the path on the instance, so dirty tracking and observers see the object they know.
+			 * 			Past a pointer, the object pointed to and the first member named after the pointer are reported instead.
+			 * 			Set elements and map keys cannot be assigned.
+			 * @return	bool False if the value type does not match or the path cannot be followed.
+			 */
+			template<typename T, typename U>
+			bool Set(U& instance, const T& value) const
+			{
+				const TypeInfo* valueType = TypeInfo::Get<T>();
+				if ((m_valueType != valueType) && !IsSame(m_valueType, valueType))
+				{
+					return false;
+				}
+
+				return SetRaw(&instance, &value);
+			}
+
+			/**
+			 * @brief	[Unsafe API] Assigns the value the path points to from the address of a value of GetValueType().
+			 */
+			bool SetRaw(void* instance, const void* value) const;
+
+		public :
+			bool IsValid() const;
+			const std::string& GetError() const;
+			const std::string& GetPath() const;
+
+			/**
+			 * @brief	Gets the type of the value the path points to.
+			 */
+			const TypeInfo* GetValueType() const;
+
+			/**
+			 * @brief	Gets the member the path ends with, or nullptr if it ends with a container element.
+			 */
+			const PropertyInfo* GetProperty() const;
+
+		private :
+			enum class StepKind : uint8_t
+			{
+				Deref,
+				Index,
+				Key,
+			};
+
+			/**
+			 * @brief	Adds offset to the current address, then loads a pointer or looks an element up.
+			 */
+			struct Step
+			{
+				StepKind kind;
+				size_t offset;
+				size_t index;
+				size_t elementSize;
+				const ContainerPropertyInfo* container;
+				std::shared_ptr<ScratchValue> key;
+			};
+
+			/**
+			 * @brief	Runs the steps, returning the address the remaining offset is added to.
+			 */
+			const char* Walk(const char* address) const;
+
+			/**
+			 * @brief	Runs the steps [first, last) from address, or returns nullptr if one cannot be followed.
+			 */
+			const char* Walk(const char* address, size_t first, size_t last) const;
+
+			bool Fail(std::string error);
+
+		private :
+			std::string m_path;
+			std::string m_error;
+
+			std::vector<Step> m_steps;
+			size_t m_offset;
+
+			const TypeInfo* m_valueType;
+			const PropertyInfo* m_property;
+
+			// The member reported by SetRaw, of the object reached after the first m_notifySteps steps.
+			const PropertyInfo* m_notifyProperty;
+			size_t m_notifySteps;
+
+			bool m_assignable;
+	};
+};
+
+#endif // __REFLECTION_PROPERTYPATH_H__
\ No newline at end of file
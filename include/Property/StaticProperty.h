@@ -0,0 +1,152 @@
+#ifndef __REFLECTION_STATICPROPERTY_H__
+#define __REFLECTION_STATICPROPERTY_H__
+
+#include <utility>
+
+#include "Utils.h"
+#include "Property/PropertyCreator.h"
+
+namespace Reflection
+{
+	/**
+	 * @class	StaticProperty
+	 * @brief	Compile-time descriptor of a reflected member variable.
+	 * @details	The PROPERTY macro generates one StaticProperty per member next to the runtime registration.
+	 * 			Since the member pointer is a template argument, accessing the member through this
+	 * 			descriptor is resolved at compile-time and can be fully inlined by the compiler.
+	 * @tparam	Pointer The member pointer type.
+	 * @tparam	pointer The compile-time member pointer constant.
+	 */
+	template<typename Pointer, Pointer pointer>
+	struct StaticProperty
+	{
+		using ClassType = typename Utils::MemberTraits<Pointer>::ClassType;
+		using PropertyType = typename Utils::MemberTraits<Pointer>::PropertyType;
+
+		static constexpr Pointer memberPointer = pointer;
+
+		const char* name;
+		PropertyFlag flags;
+
+		constexpr explicit StaticProperty(const char* propertyName, PropertyFlag propertyFlags = PropertyFlag::None)
+			: name(propertyName)
+			, flags(propertyFlags)
+		{}
+
+		/**
+		 * @brief	Gets the member of the given instance.
+		 * @param	instance The instance containing the property.
+		 * @return	PropertyType& A reference to the member.
+		 */
+		static PropertyType& Get(ClassType& instance)
+		{
+			return instance.*pointer;
+		}
+
+		/**
+		 * @brief	Gets the member of the given const instance.
+		 * @param	instance The instance containing the property.
+		 * @return	const PropertyType& A const reference to the member.
+		 */
+		static const PropertyType& Get(const ClassType& instance)
+		{
+			return instance.*pointer;
+		}
+
+		/**
+		 * @brief	Gets the runtime PropertyInfo registered for the same member.
+		 * @details	The PROPERTY macro registers the runtime property through this function,
+		 * 			so the static and the runtime descriptors always refer to the same PropertyInfo instance.
+		 * @return	const PropertyInfo* The runtime property information.
+		 */
+		const PropertyInfo* GetPropertyInfo() const
+		{
+			static const PropertyInfo* propertyInfo = PropertyCreator<Pointer, pointer>::Create(name, flags);
+
+			return propertyInfo;
+		}
+	};
+
+	/**
+	 * @class	StaticPropertyList
+	 * @brief	Compile-time list of the properties declared by the PROPERTY macro in the class T.
+	 * @details	The list only contains the properties declared by T itself, in declaration order.
+	 * 			Properties of the super types are visited through ForEachProperty.
+	 * 			This struct is declared as a friend by the GENERATE macro, so private properties are also accessible.
+	 * @tparam	T The reflected class type.
+	 */
+	template<typename T>
+	struct StaticPropertyList
+	{
+		static constexpr size_t Count = decltype(T::StaticPropertyCounter(Utils::Rank<Utils::MaxStaticProperty>{}))::value;
+
+		/**
+		 * @brief	Gets the static property descriptor of the given index.
+		 * @tparam	I The declaration index of the property in T.
+		 * @return	The StaticProperty descriptor.
+		 */
+		template<size_t I>
+		static constexpr auto Get()
+		{
+			static_assert(I < Count, "Reflection::StaticPropertyList : The index is out of range.");
+
+			return T::StaticPropertyEntry(Utils::Index<I>{});
+		}
+
+		/**
+		 * @brief	Invokes the visitor for each property declared by T.
+		 * @tparam	Instance The instance type, possibly const qualified.
+		 * @tparam	Visitor  The visitor type.
+		 * @param	instance The instance containing the properties.
+		 * @param	visitor  The visitor called as visitor(property, member).
+		 */
+		template<typename Instance, typename Visitor>
+		static void ForEach(Instance& instance, Visitor& visitor)
+		{
+			ForEachImpl(instance, visitor, std::make_index_sequence<Count>{});
+		}
+
+	private :
+		template<typename Instance, typename Visitor, size_t... I>
+		static void ForEachImpl(Instance& instance, Visitor& visitor, std::index_sequence<I...>)
+		{
+			(VisitImpl<I>(instance, visitor), ...);
+		}
+
+		template<size_t I, typename Instance, typename Visitor>
+		static void VisitImpl(Instance& instance, Visitor& visitor)
+		{
+			constexpr auto property = Get<I>();
+
+			visitor(property, instance.*(decltype(property)::memberPointer));
+		}
+	};
+
+	/**
+	 * @brief	Visits every reflected property of the instance through the compile-time property list.
+	 * @details	The properties of the super types are visited first, followed by the properties of T
+	 * 			in declaration order. This is the same order as TypeInfo::GetPropertyList().
+	 * 			Every call is resolved at compile-time, so no void* or function pointer is involved.
+	 * @tparam	T       The instance type, possibly const qualified.
+	 * @tparam	Visitor The visitor type, called as visitor(const StaticProperty<...>& property, Member& member).
+	 * @param	instance The instance to visit.
+	 * @param	visitor  The visitor.
+	 */
+	template<typename T, typename Visitor>
+	void ForEachProperty(T& instance, Visitor&& visitor)
+	{
+		using Class = Utils::RemoveConst_t<T>;
+		using Super = typename Class::SuperType;
+
+		if constexpr (!Utils::IsSame<Super, void>::value)
+		{
+			using SuperInstance = Utils::Conditional_t<Utils::IsConst<T>::value, const Super, Super>;
+
+			ForEachProperty(static_cast<SuperInstance&>(instance), visitor);
+		}
+
+		StaticPropertyList<Class>::ForEach(instance, visitor);
+	}
+};
+
+#endif // __REFLECTION_STATICPROPERTY_H__
\ No newline at end of file
@@ -5,6 +5,28 @@
 #include "Property/PropertyMacro.h"
 #include "Type/TypeMacro.h"
 #include "Type/TypeCast.h"
+#include "Type/CastCache.h"
+#include "Type/TypeSwitch.h"
+#include "Type/ReferenceGraph.h"
+#include "Type/LayoutReport.h"
+#include "Type/MemoryStats.h"
 #include "Type/TypeManager.h"
+#include "Property/DirtyTracking.h"
+#include "Property/PropertyObserver.h"
+#include "Property/PropertyPath.h"
+#include "Arena.h"
+#include "PointerMap.h"
+#include "PointerSet.h"
+#include "SoAVector.h"
+#include "ArchetypeStore.h"
+#include "JobSystem.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonWriter.h"
+#include "Serialization/ArchiveWriter.h"
+#include "Serialization/MappedArchive.h"
+#include "Serialization/BinaryReader.h"
+#include "Serialization/BinaryWriter.h"
+#include "Serialization/GraphReader.h"
+#include "Serialization/GraphWriter.h"
 
 #endif // __REFLECTION_H__
\ No newline at end of file
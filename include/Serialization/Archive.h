@@ -0,0 +1,122 @@
+#ifndef __REFLECTION_ARCHIVE_H__
+#define __REFLECTION_ARCHIVE_H__
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Reflection
+{
+	/**
+	 * @struct	ArchiveHeader
+	 * @brief	The header at the start of a memory-mappable archive image.
+	 * @details	fingerprint is TypeInfo::GetLayoutFingerprint() of the root type that wrote the image.
+	 * 			Offsets are counted from the start of the image.
+	 */
+	struct ArchiveHeader
+	{
+		static constexpr uint32_t MagicNumber = 0x414C4652; // "RFLA"
+		static constexpr uint32_t CurrentVersion = 1;
+		static constexpr size_t Alignment = 16;
+
+		uint32_t magic;
+		uint32_t version;
+		uint64_t fingerprint;
+		uint64_t rootOffset;
+		uint64_t size;
+	};
+
+	/**
+	 * @class	RelativePtr
+	 * @brief	A pointer stored as the distance from its own address, so it stays valid wherever the image is mapped.
+	 * @details	Zero means null. Copying a RelativePtr outside of its image makes it point elsewhere,
+	 * 			so archived objects should be used in place.
+	 * @tparam	T The pointee type.
+	 */
+	template<typename T>
+	class RelativePtr
+	{
+		public :
+			using PointeeType = T;
+
+		public :
+			RelativePtr() : m_offset(0) {}
+
+		public :
+			void Set(const T* target)
+			{
+				m_offset = (nullptr == target) ? 0 : reinterpret_cast<const char*>(target) - reinterpret_cast<const char*>(this);
+			}
+
+			T* Get()
+			{
+				return (0 == m_offset) ? nullptr : reinterpret_cast<T*>(reinterpret_cast<char*>(this) + m_offset);
+			}
+
+			const T* Get() const
+			{
+				return (0 == m_offset) ? nullptr : reinterpret_cast<const T*>(reinterpret_cast<const char*>(this) + m_offset);
+			}
+
+			T* operator->() { return Get(); }
+			const T* operator->() const { return Get(); }
+			T& operator*() { return *Get(); }
+			const T& operator*() const { return *Get(); }
+
+			explicit operator bool() const { return 0 != m_offset; }
+
+		private :
+			int64_t m_offset;
+	};
+
+	/**
+	 * @class	RelativeArray
+	 * @brief	A contiguous array stored as the distance to its first element and a size, the archive form of std::vector.
+	 * @details	Exposes begin/end/size/data, so a RelativeArray PROPERTY is reflected as an ArrayPropertyInfo.
+	 * @tparam	T The element type.
+	 */
+	template<typename T>
+	class RelativeArray
+	{
+		public :
+			using value_type = T;
+			using iterator = T*;
+			using const_iterator = const T*;
+
+		public :
+			RelativeArray() : m_offset(0), m_size(0) {}
+
+		public :
+			void Set(const T* data, size_t size)
+			{
+				m_offset = (nullptr == data) ? 0 : reinterpret_cast<const char*>(data) - reinterpret_cast<const char*>(this);
+				m_size = (nullptr == data) ? 0 : static_cast<uint64_t>(size);
+			}
+
+			T* data()
+			{
+				return (0 == m_offset) ? nullptr : reinterpret_cast<T*>(reinterpret_cast<char*>(this) + m_offset);
+			}
+
+			const T* data() const
+			{
+				return (0 == m_offset) ? nullptr : reinterpret_cast<const T*>(reinterpret_cast<const char*>(this) + m_offset);
+			}
+
+			size_t size() const { return static_cast<size_t>(m_size); }
+			bool empty() const { return 0 == m_size; }
+
+			T* begin() { return data(); }
+			T* end() { return data() + m_size; }
+			const T* begin() const { return data(); }
+			const T* end() const { return data() + m_size; }
+
+			T& operator[](size_t index) { return data()[index]; }
+			const T& operator[](size_t index) const { return data()[index]; }
+
+		private :
+			int64_t m_offset;
+			uint64_t m_size;
+	};
+};
+
+#endif // __REFLECTION_ARCHIVE_H__
\ No newline at end of file
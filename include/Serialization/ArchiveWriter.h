@@ -0,0 +1,90 @@
+#ifndef __REFLECTION_ARCHIVEWRITER_H__
+#define __REFLECTION_ARCHIVEWRITER_H__
+
+#include <string>
+#include <vector>
+
+#include "Serialization/Archive.h"
+#include "Type/TypeInfo.h"
+
+namespace Reflection
+{
+	/**
+	 * @class	ArchiveWriter
+	 * @brief	Builds a memory-mappable archive image of trivially-copyable reflected types.
+	 * @details	Objects are allocated in a single growing image and identified by their offset in it.
+	 * 			Pointers returned by Get are invalidated by the next Allocate, but the RelativePtr and RelativeArray
+	 * 			fields linked through them are not, since they only store distances inside the image.
+	 * 			Padding bytes are zeroed, so the same content always produces the same file.
+	 */
+	class ArchiveWriter
+	{
+		public :
+			ArchiveWriter();
+
+			ArchiveWriter(const ArchiveWriter&) = delete;
+			ArchiveWriter& operator=(const ArchiveWriter&) = delete;
+
+		public :
+			/**
+			 * @brief	Allocates default constructed objects in the image.
+			 * @tparam	T The object type, trivially copyable.
+			 * @param	count The number of consecutive objects.
+			 * @return	size_t The offset of the first object.
+			 */
+			template<typename T>
+			size_t Allocate(size_t count = 1)
+			{
+				static_assert(std::is_trivially_copyable<T>::value, "Reflection::ArchiveWriter : Archived types must be trivially copyable.");
+				static_assert(alignof(T) <= ArchiveHeader::Alignment, "Reflection::ArchiveWriter : The alignment of the type is too large.");
+
+				const size_t offset = AllocateRaw(sizeof(T) * count, alignof(T));
+
+				T* objects = Get<T>(offset);
+				for (size_t index = 0; index < count; ++index)
+				{
+					new (objects + index) T();
+				}
+
+				return offset;
+			}
+
+			/**
+			 * @brief	Gets an object allocated in the image. The pointer is valid until the next Allocate.
+			 */
+			template<typename T>
+			T* Get(size_t offset)
+			{
+				return reinterpret_cast<T*>(m_image.data() + offset);
+			}
+
+			/**
+			 * @brief	Marks the object at the given offset as the root of the archive.
+			 */
+			template<typename T>
+			void SetRoot(size_t offset)
+			{
+				SetRoot(TypeInfo::Get<T>(), offset);
+			}
+
+			void SetRoot(const TypeInfo* type, size_t offset);
+
+			/**
+			 * @brief	Writes the image to a file.
+			 * @return	bool False if the file cannot be written or no root was set.
+			 */
+			bool Save(const std::string& path) const;
+
+			const void* GetData() const;
+			size_t GetSize() const;
+
+		private :
+			size_t AllocateRaw(size_t size, size_t alignment);
+			ArchiveHeader& GetHeader();
+
+		private :
+			std::vector<char> m_image;
+	};
+};
+
+#endif // __REFLECTION_ARCHIVEWRITER_H__
\ No newline at end of file
@@ -0,0 +1,102 @@
+#ifndef __REFLECTION_BINARYREADER_H__
+#define __REFLECTION_BINARYREADER_H__
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "Serialization/TypeSchema.h"
+
+namespace Reflection
+{
+	/**
+	 * @class	BinaryReader
+	 * @brief	Loads objects written by BinaryWriter into existing instances of the local types.
+	 * @details	When the layout fingerprint of the stored schema matches the local type, the image is copied in merged blocks
+	 * 			(a single memcpy for flat types) and only the strings and containers are decoded.
+	 * 			Otherwise the fields are loaded through the cached SchemaRemap of the (stored schema, local type) pair:
+	 * 			renamed owners, reordered and resized members are handled, and removed or unknown fields are skipped.
+	 * 			The load is a bulk restore: it writes the memory directly and does not fire the property write hooks.
+	 * 			Stored pointers are turned back into addresses by the object resolver callback; without one, pointer
+	 * 			properties keep their value.
+	 */
+	class BinaryReader
+	{
+		public :
+			/**
+			 * @brief	Gives the address of the stored object of an identifier seen as a type, nullptr if there is none.
+			 */
+			using ObjectResolveFunc = std::function<void*(uint32_t id, const TypeInfo* type)>;
+
+		public :
+			/**
+			 * @brief	Constructor for BinaryReader. Reads the header and the schema table.
+			 * @param	data The archive, which must outlive the reader.
+			 * @param	size The size of the archive.
+			 */
+			BinaryReader(const void* data, size_t size);
+
+			BinaryReader(const BinaryReader&) = delete;
+			BinaryReader& operator=(const BinaryReader&) = delete;
+
+		public :
+			/**
+			 * @brief	Reads the next object of the archive into an instance.
+			 * @return	bool False if the archive is invalid or truncated.
+			 */
+			bool Read(const TypeInfo* type, void* instance);
+
+			template<typename T>
+			bool Read(T& instance)
+			{
+				return Read(TypeInfo::Get<T>(), &instance);
+			}
+
+			/**
+			 * @brief	Skips the next object of the archive.
+			 */
+			bool Skip();
+
+			bool IsValid() const;
+			bool IsEnd() const;
+
+			const std::vector<TypeSchema>& GetSchemas() const;
+
+			/**
+			 * @brief	Sets the callback resolving the stored pointers, used by GraphReader.
+			 */
+			void SetObjectResolveFunc(ObjectResolveFunc resolve);
+
+		private :
+			struct Binding
+			{
+				const TypeInfo* type;
+				const TypeSchema* schema;
+				const SchemaRemap* remap;
+			};
+
+			const Binding* GetBinding(uint32_t schemaIndex, const TypeInfo* type);
+
+			bool ReadObject(uint32_t schemaIndex, const TypeInfo* type, void* instance);
+			bool ReadField(const SchemaField& source, const SchemaField* target, char* base);
+			bool ReadElements(const SchemaField& source, const ContainerPropertyInfo* container, void* address, uint64_t count);
+			bool ReadElement(const SchemaValue& source, const TypeInfo* target, void* address);
+			bool ReadString(std::string* target);
+			bool Advance(uint64_t size);
+
+			template<typename T>
+			bool Extract(T& value);
+
+		private :
+			const char* m_cursor;
+			const char* m_end;
+			bool m_valid;
+
+			std::vector<TypeSchema> m_schemas;
+			std::vector<std::vector<Binding>> m_bindings;
+
+			ObjectResolveFunc m_resolve;
+	};
+};
+
+#endif // __REFLECTION_BINARYREADER_H__
\ No newline at end of file
@@ -0,0 +1,94 @@
+#ifndef __REFLECTION_BINARYWRITER_H__
+#define __REFLECTION_BINARYWRITER_H__
+
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include "Serialization/TypeSchema.h"
+
+namespace Reflection
+{
+	/**
+	 * @class	BinaryWriter
+	 * @brief	Serializes reflected objects in a compact binary form, together with the schemas of their types.
+	 * @details	Each object is written as an image of its Primitive and Bytes leaves, copied in merged blocks,
+	 * 			followed by its strings and containers. The schemas let BinaryReader load the objects into a later
+	 * 			version of the types: a matching layout fingerprint is loaded with block copies,
+	 * 			any other layout through a SchemaRemap. Values are stored in native byte order.
+	 * 			Pointers to objects are stored as the identifiers returned by the object identifier callback,
+	 * 			or as 0 without one.
+	 */
+	class BinaryWriter
+	{
+		public :
+			static constexpr uint32_t MagicNumber = 0x424C4652; // "RFLB"
+			static constexpr uint32_t CurrentVersion = 2;
+
+			/**
+			 * @brief	Gives the identifier stored for a pointer to an object, 0 for none.
+			 */
+			using ObjectIdFunc = std::function<uint32_t(const TypeInfo* type, const void* object)>;
+
+		public :
+			BinaryWriter();
+
+			BinaryWriter(const BinaryWriter&) = delete;
+			BinaryWriter& operator=(const BinaryWriter&) = delete;
+
+		public :
+			/**
+			 * @brief	Appends an object, written with the schema of its runtime type.
+			 */
+			void Write(const TypeInfo* type, const void* instance);
+
+			template<typename T>
+			void Write(const T& instance)
+			{
+				Write(TypeInfo::Get<T>(), &instance);
+			}
+
+			/**
+			 * @brief	Gets the archive: the header, the schema table and the objects written so far.
+			 */
+			std::vector<char> GetBuffer() const;
+
+			void Clear();
+
+			/**
+			 * @brief	Sets the callback numbering the objects met through pointers, used by GraphWriter.
+			 */
+			void SetObjectIdFunc(ObjectIdFunc objectId);
+
+		private :
+			struct SchemaEntry
+			{
+				const TypeSchema* schema;
+				uint32_t index;
+			};
+
+			const SchemaEntry& GetSchema(const TypeInfo* type);
+
+			void WriteObject(const TypeSchema* schema, const void* instance);
+			void WriteField(const SchemaField& field, const void* address);
+			void WriteElement(const SchemaValue& value, const void* address);
+			void WriteBytes(const void* data, size_t size);
+
+			template<typename T>
+			void WriteValue(const T& value)
+			{
+				WriteBytes(&value, sizeof(T));
+			}
+
+		private :
+			std::vector<char> m_schemaTable;
+			std::vector<char> m_data;
+
+			std::unordered_map<const TypeInfo*, SchemaEntry> m_schemas;
+			uint32_t m_schemaCount;
+
+			ObjectIdFunc m_objectId;
+	};
+};
+
+#endif // __REFLECTION_BINARYWRITER_H__
\ No newline at end of file
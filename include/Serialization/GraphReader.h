@@ -0,0 +1,86 @@
+#ifndef __REFLECTION_GRAPHREADER_H__
+#define __REFLECTION_GRAPHREADER_H__
+
+#include <string>
+#include <vector>
+
+#include "Type/TypeInfo.h"
+
+namespace Reflection
+{
+	class Arena;
+
+	/**
+	 * @class	GraphReader
+	 * @brief	Loads an object graph written by GraphWriter into new objects allocated from an arena.
+	 * @details	The stored types are matched to the local types by name. Every object is allocated and constructed
+	 * 			before any content is read, in a single arena allocation per type, so the object table maps every
+	 * 			identifier to its object and the stored pointers are fixed up as they are decoded, through a cast
+	 * 			to the type of the pointer. The contents are loaded with BinaryReader, so a type whose layout changed
+	 * 			is loaded through its SchemaRemap. Objects of unknown or non-constructible types are skipped
+	 * 			and the pointers to them are set to nullptr.
+	 */
+	class GraphReader
+	{
+		public :
+			/**
+			 * @brief	Constructor for GraphReader. Reads the header, the type table and the object table.
+			 * @param	data The archive, which must outlive the reader.
+			 * @param	size The size of the archive.
+			 */
+			GraphReader(const void* data, size_t size);
+
+			GraphReader(const GraphReader&) = delete;
+			GraphReader& operator=(const GraphReader&) = delete;
+
+		public :
+			/**
+			 * @brief	Allocates, constructs and loads every object of the archive.
+			 * @details	The objects are destroyed when the arena is reset.
+			 * @return	bool False if the archive is invalid or truncated.
+			 */
+			bool Read(Arena& arena);
+
+			/**
+			 * @brief	Gets a root loaded by Read, seen as the given type.
+			 * @param	index The index of the root, in the order of the GraphWriter::Write calls.
+			 * @param	type  The type to cast the root to.
+			 * @return	void* The address of the root, or nullptr if it was not loaded or is not a type.
+			 */
+			void* GetRoot(size_t index, const TypeInfo* type) const;
+
+			template<typename T>
+			T* GetRoot(size_t index = 0) const
+			{
+				return static_cast<T*>(GetRoot(index, TypeInfo::Get<T>()));
+			}
+
+			size_t GetRootCount() const;
+			size_t GetObjectCount() const;
+			bool IsValid() const;
+
+		private :
+			struct Object
+			{
+				const TypeInfo* type;
+				void* address;
+			};
+
+			/**
+			 * @brief	Gets the object of an identifier (index plus one) seen as a type, nullptr if it has no such subobject.
+			 */
+			void* Resolve(uint32_t id, const TypeInfo* type) const;
+
+		private :
+			const char* m_binary;
+			size_t m_binarySize;
+			bool m_valid;
+
+			std::vector<std::string> m_typeNames;
+			std::vector<uint32_t> m_objectTypes;
+			std::vector<uint32_t> m_roots;
+			std::vector<Object> m_objects;
+	};
+};
+
+#endif // __REFLECTION_GRAPHREADER_H__
\ No newline at end of file
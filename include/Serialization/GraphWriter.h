@@ -0,0 +1,87 @@
+#ifndef __REFLECTION_GRAPHWRITER_H__
+#define __REFLECTION_GRAPHWRITER_H__
+
+#include <unordered_map>
+#include <vector>
+
+#include "PointerMap.h"
+#include "Serialization/BinaryWriter.h"
+
+namespace Reflection
+{
+	/**
+	 * @class	GraphWriter
+	 * @brief	Serializes the graph of objects reachable from a set of roots, every object once.
+	 * @details	Each object met through a pointer is given an identifier, its index in the archive, the first time
+	 * 			its address is seen, and pointers are stored as identifiers. Shared objects are therefore written once
+	 * 			and cycles terminate. Objects are written with the BinaryWriter encoding of their dynamic type, whose name
+	 * 			is kept in a type table so that GraphReader can allocate every object before reading the contents.
+	 * 			Objects are identified by address, so pointers inside another object are not supported.
+	 *
+	 * 			Layout : header, type table (names), type index of every object, root identifiers, BinaryWriter archive.
+	 */
+	class GraphWriter
+	{
+		public :
+			static constexpr uint32_t MagicNumber = 0x474C4652; // "RFLG"
+			static constexpr uint32_t CurrentVersion = 1;
+
+		public :
+			GraphWriter();
+
+			GraphWriter(const GraphWriter&) = delete;
+			GraphWriter& operator=(const GraphWriter&) = delete;
+
+		public :
+			/**
+			 * @brief	Adds a root, and writes it with every object reachable from it that has not been written yet.
+			 */
+			void Write(const TypeInfo* type, const void* root);
+
+			template<typename T>
+			void Write(const T& root)
+			{
+				Write(TypeInfo::Get<T>(), &root);
+			}
+
+			/**
+			 * @brief	Gets the archive holding the roots written so far.
+			 */
+			std::vector<char> GetBuffer() const;
+
+			/**
+			 * @brief	Gets the number of objects written, roots included.
+			 */
+			size_t GetObjectCount() const;
+
+			void Clear();
+
+		private :
+			struct Pending
+			{
+				const TypeInfo* type;
+				const void* object;
+			};
+
+			/**
+			 * @brief	Gets the identifier of an object, queuing the object if it is new.
+			 * @return	uint32_t The index of the object plus one.
+			 */
+			uint32_t GetObjectId(const TypeInfo* type, const void* object);
+
+		private :
+			BinaryWriter m_binary;
+
+			std::vector<char> m_typeTable;
+			std::unordered_map<const TypeInfo*, uint32_t> m_typeIndices;
+
+			PointerMap m_objectIds;
+			std::vector<uint32_t> m_objectTypes;
+			std::vector<Pending> m_pending;
+			size_t m_written;
+
+			std::vector<uint32_t> m_roots;
+	};
+};
+
+#endif // __REFLECTION_GRAPHWRITER_H__
\ No newline at end of file
@@ -0,0 +1,91 @@
+#ifndef __REFLECTION_JSONREADER_H__
+#define __REFLECTION_JSONREADER_H__
+
+#include <string>
+#include <string_view>
+
+#include "Arena.h"
+#include "Type/TypeInfo.h"
+
+namespace Reflection
+{
+	class ContainerPropertyInfo;
+
+	/**
+	 * @class	JsonReader
+	 * @brief	Parses JSON directly into existing reflected instances, without building a document tree.
+	 * @details	Object keys are matched against the property names, qualified ("Owner::name") or not.
+	 * 			Properties are expected in declaration order, so a key is usually matched with a single comparison.
+	 * 			Values are stored through PropertyInfo::SetRaw (or MarkWritten after an in-place update),
+	 * 			so dirty tracking and observers see the writes. Unknown keys and null values are skipped.
+	 * 			Strings are not copied into temporary buffers: std::string_view targets receive a view into the input,
+	 * 			std::string targets are assigned from it. Only strings with escapes are decoded,
+	 * 			into an arena owned by the reader; the views stay valid as long as the input and the reader.
+	 * 			Containers are cleared and refilled; fixed-size arrays are updated in place.
+	 * 			Reflected enums accept their names (flags separated by '|') as well as numbers.
+	 * 			Properties flagged Transient are skipped like unknown keys.
+	 */
+	class JsonReader
+	{
+		public :
+			explicit JsonReader(std::string_view input);
+
+			JsonReader(const JsonReader&) = delete;
+			JsonReader& operator=(const JsonReader&) = delete;
+
+		public :
+			/**
+			 * @brief	Reads the next JSON value of the input into an instance of a reflected type, or a primitive value.
+			 * @return	bool False on a syntax error; the instance may have been partially updated.
+			 */
+			bool Read(const TypeInfo* type, void* instance);
+
+			template<typename T>
+			bool Read(T& instance)
+			{
+				return Read(TypeInfo::Get<T>(), &instance);
+			}
+
+			/**
+			 * @brief	Gets the description of the last error, empty if none.
+			 */
+			const std::string& GetError() const;
+
+			/**
+			 * @brief	Gets the offset in the input of the last error, or of the next value to read.
+			 */
+			size_t GetOffset() const;
+
+		private :
+			bool ReadValue(const TypeInfo* type, void* value);
+			bool ReadObject(const TypeInfo* type, void* instance);
+			bool ReadProperty(const PropertyInfo* property, void* instance);
+			bool ReadContainer(const ContainerPropertyInfo* container, void* address);
+			bool ReadArray(const ContainerPropertyInfo* container, const TypeInfo* elementType, void* address);
+			bool ReadKeyed(const ContainerPropertyInfo* container, const TypeInfo* elementType, void* address);
+			bool ReadMap(const ContainerPropertyInfo* container, void* address);
+			bool ReadPrimitive(TypeInfo::Primitive primitive, void* value);
+			bool ReadEnum(const EnumInfo* enumInfo, TypeInfo::Primitive primitive, void* value);
+			bool ReadString(std::string_view& value);
+			bool ReadBool(bool& value);
+			bool SkipValue();
+
+			template<typename T>
+			bool ReadNumber(T& value);
+
+			void SkipWhitespace();
+			bool Consume(char expected);
+			bool ConsumeNull();
+			bool Fail(const char* message);
+
+		private :
+			const char* m_begin;
+			const char* m_cursor;
+			const char* m_end;
+
+			Arena m_strings;
+			std::string m_error;
+	};
+};
+
+#endif // __REFLECTION_JSONREADER_H__
\ No newline at end of file
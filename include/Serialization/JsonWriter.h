@@ -0,0 +1,104 @@
+#ifndef __REFLECTION_JSONWRITER_H__
+#define __REFLECTION_JSONWRITER_H__
+
+#include <functional>
+#include <string_view>
+
+#include "Type/TypeInfo.h"
+
+namespace Reflection
+{
+	class ContainerPropertyInfo;
+
+	/**
+	 * @class	JsonWriter
+	 * @brief	Streams reflected objects as compact JSON into a caller-provided buffer, without building a document tree.
+	 * @details	Objects are written by walking TypeInfo::GetPropertyList(), keyed by the qualified property names.
+	 * 			Arrays and sets become JSON arrays. Maps with std::string keys become JSON objects,
+	 * 			other maps become arrays of [key, value] pairs.
+	 * 			Reflected enums (GENERATE_ENUM) are written by name, flags as names separated by '|'.
+	 * 			Properties flagged Transient are not written.
+	 * 			Pointers, non-finite floats and values without a JSON form are written as null.
+	 * 			When the buffer is full it is handed to the flush callback and reused; without a callback
+	 * 			the writer stops and reports an overflow.
+	 */
+	class JsonWriter
+	{
+		public :
+			/**
+			 * @brief	Receives a full buffer. Returning false aborts the write.
+			 */
+			using FlushFunc = std::function<bool(const char* data, size_t size)>;
+
+		public :
+			/**
+			 * @brief	Constructor for JsonWriter.
+			 * @param	buffer   The memory the JSON is written into.
+			 * @param	capacity The size of the buffer, at least 64 bytes.
+			 * @param	flush    The callback emptying the buffer when it is full, or nullptr.
+			 */
+			JsonWriter(char* buffer, size_t capacity, FlushFunc flush = nullptr);
+
+			JsonWriter(const JsonWriter&) = delete;
+			JsonWriter& operator=(const JsonWriter&) = delete;
+
+		public :
+			/**
+			 * @brief	Writes an instance of a reflected type, or a primitive value.
+			 * @return	bool False if the buffer overflowed or the flush callback failed.
+			 */
+			bool Write(const TypeInfo* type, const void* instance);
+
+			template<typename T>
+			bool Write(const T& instance)
+			{
+				return Write(TypeInfo::Get<T>(), &instance);
+			}
+
+			/**
+			 * @brief	Hands the pending bytes to the flush callback.
+			 * @return	bool False if there is no callback or it failed.
+			 */
+			bool Flush();
+
+			/**
+			 * @brief	Gets the bytes written to the buffer and not flushed yet.
+			 */
+			std::string_view GetPending() const;
+
+			/**
+			 * @brief	Gets the total number of bytes written, flushed or not.
+			 */
+			size_t GetWrittenBytes() const;
+
+			bool IsOverflowed() const;
+
+		private :
+			void WriteValue(const TypeInfo* type, const void* value);
+			void WriteObject(const TypeInfo* type, const void* instance);
+			void WriteProperty(const PropertyInfo* property, const void* instance);
+			void WriteContainer(const ContainerPropertyInfo* container, const void* address);
+			void WriteEnum(const EnumInfo* enumInfo, TypeInfo::Primitive primitive, const void* value);
+			void WritePrimitive(TypeInfo::Primitive primitive, const void* value);
+			void WriteString(std::string_view value);
+			void WriteRaw(const char* data, size_t size);
+			void WriteChar(char value);
+
+			/**
+			 * @brief	Makes room for size contiguous bytes, flushing if needed.
+			 * @return	char* The write position, or nullptr on overflow.
+			 */
+			char* Reserve(size_t size);
+
+		private :
+			char* m_buffer;
+			size_t m_capacity;
+			size_t m_size;
+			size_t m_flushed;
+
+			FlushFunc m_flush;
+			bool m_overflowed;
+	};
+};
+
+#endif // __REFLECTION_JSONWRITER_H__
\ No newline at end of file
@@ -0,0 +1,85 @@
+#ifndef __REFLECTION_MAPPEDARCHIVE_H__
+#define __REFLECTION_MAPPEDARCHIVE_H__
+
+#include <string>
+
+#include "Serialization/Archive.h"
+#include "Type/TypeInfo.h"
+
+namespace Reflection
+{
+	/**
+	 * @class	MappedArchive
+	 * @brief	Read-only view of an archive written by ArchiveWriter, used in place without a parse step.
+	 * @details	Open maps the file into memory; Attach uses an image already in memory.
+	 * 			GetRoot only returns the root object if the layout fingerprint of the requested type
+	 * 			matches the one recorded by the writer, so a stale file is rejected instead of misread.
+	 * 			Properties of the archived objects are read directly through PropertyInfo offsets.
+	 * 			The relative offsets inside the image are trusted; archives should come from a trusted source.
+	 */
+	class MappedArchive
+	{
+		public :
+			MappedArchive();
+			~MappedArchive();
+
+			MappedArchive(const MappedArchive&) = delete;
+			MappedArchive& operator=(const MappedArchive&) = delete;
+
+		public :
+			/**
+			 * @brief	Maps an archive file read-only.
+			 * @return	bool False if the file cannot be mapped or is not a valid archive.
+			 */
+			bool Open(const std::string& path);
+
+			/**
+			 * @brief	Uses an archive image already in memory, without taking its ownership.
+			 * @param	data The image, aligned to ArchiveHeader::Alignment.
+			 * @param	size The size of the image.
+			 * @return	bool False if the image is not a valid archive.
+			 */
+			bool Attach(const void* data, size_t size);
+
+			void Close();
+
+			/**
+			 * @brief	Gets the root object of the archive.
+			 * @param	type The expected root type.
+			 * @return	const void* The root object, or nullptr if the archive was written with another layout.
+			 */
+			const void* GetRoot(const TypeInfo* type) const;
+
+			template<typename T>
+			const T* GetRoot() const
+			{
+				return static_cast<const T*>(GetRoot(TypeInfo::Get<T>()));
+			}
+
+			/**
+			 * @brief	Checks if a range of bytes lies inside the image.
+			 */
+			bool Contains(const void* address, size_t size) const;
+
+			const ArchiveHeader* GetHeader() const;
+			const void* GetData() const;
+			size_t GetSize() const;
+			bool IsOpen() const;
+
+		private :
+			bool Validate();
+
+		private :
+			const char* m_data;
+			size_t m_size;
+
+			void* m_mapping;
+			size_t m_mappingSize;
+
+			// Windows keeps the file and the file mapping objects open while the view is mapped.
+			void* m_fileHandle;
+			void* m_mappingHandle;
+	};
+};
+
+#endif // __REFLECTION_MAPPEDARCHIVE_H__
\ No newline at end of file
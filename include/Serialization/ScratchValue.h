@@ -0,0 +1,91 @@
+#ifndef __REFLECTION_SCRATCHVALUE_H__
+#define __REFLECTION_SCRATCHVALUE_H__
+
+#include <cstddef>
+#include <new>
+
+#include "Type/TypeInfo.h"
+
+namespace Reflection
+{
+	/**
+	 * @class	ScratchValue
+	 * @brief	A default constructed temporary of a reflected type, on the stack when it is small enough.
+	 * @details	Used by the readers to build set and map elements before inserting them.
+	 */
+	class ScratchValue
+	{
+		public :
+			explicit ScratchValue(const TypeInfo* type)
+				: m_type(type)
+				, m_address(nullptr)
+				, m_heap(false)
+				, m_constructed(false)
+			{
+				const size_t size = type->GetTypeSize();
+				const size_t alignment = type->GetTypeAlignment();
+
+				if ((size <= sizeof(m_storage)) && (alignment <= alignof(std::max_align_t)))
+				{
+					m_address = m_storage;
+				}
+				else
+				{
+					m_address = ::operator new(size, std::align_val_t(alignment));
+					m_heap = true;
+				}
+
+				m_constructed = m_type->Construct(m_address);
+			}
+
+			~ScratchValue()
+			{
+				if (m_constructed)
+				{
+					m_type->Destruct(m_address);
+				}
+
+				if (m_heap)
+				{
+					::operator delete(m_address, std::align_val_t(m_type->GetTypeAlignment()));
+				}
+			}
+
+			ScratchValue(const ScratchValue&) = delete;
+			ScratchValue& operator=(const ScratchValue&) = delete;
+
+		public :
+			/**
+			 * @brief	Destroys and default constructs the value again.
+			 */
+			void Reset()
+			{
+				if (m_constructed)
+				{
+					m_type->Destruct(m_address);
+				}
+
+				m_constructed = m_type->Construct(m_address);
+			}
+
+			bool IsValid() const
+			{
+				return m_constructed;
+			}
+
+			void* Get() const
+			{
+				return m_address;
+			}
+
+		private :
+			const TypeInfo* m_type;
+			void* m_address;
+			bool m_heap;
+			bool m_constructed;
+
+			alignas(std::max_align_t) unsigned char m_storage[128];
+	};
+};
+
+#endif // __REFLECTION_SCRATCHVALUE_H__
\ No newline at end of file
@@ -0,0 +1,211 @@
+#ifndef __REFLECTION_TYPESCHEMA_H__
+#define __REFLECTION_TYPESCHEMA_H__
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "Type/TypeInfo.h"
+
+namespace Reflection
+{
+	/**
+	 * @struct	SchemaValue
+	 * @brief	How a value is encoded by BinaryWriter.
+	 * @details	Primitive and Bytes values are raw bytes. String is a length and the characters.
+	 * 			Object is a nested reflected value encoded with its own schema. Pointer is a pointer to an object,
+	 * 			stored as the 32-bit identifier given by the archive (see GraphWriter), 0 for nullptr.
+	 * 			None values are not stored.
+	 */
+	struct SchemaValue
+	{
+		enum class Kind : uint8_t
+		{
+			None,
+			Primitive,
+			Bytes,
+			String,
+			Object,
+			Array,
+			Set,
+			Map,
+			Pointer,
+		};
+
+		Kind kind = Kind::None;
+		TypeInfo::Primitive primitive = TypeInfo::Primitive::None;
+		uint64_t size = 0;
+
+		/**
+		 * @brief	The hash of the type name for Bytes and for the target of a Pointer, the layout fingerprint for Object.
+		 */
+		uint64_t typeHash = 0;
+
+		/**
+		 * @brief	The index of the Object schema in the schema table of a binary archive.
+		 */
+		uint32_t schema = 0;
+
+		/**
+		 * @brief	The local type of an Object or of the target of a Pointer, nullptr for schemas read from an archive.
+		 */
+		const TypeInfo* type = nullptr;
+	};
+
+	/**
+	 * @struct	SchemaField
+	 * @brief	A leaf of the flattened layout of a type.
+	 * @details	Nested reflected values are flattened, so the name is a path ("Outer::m_inner.Inner::m_value")
+	 * 			and the offset is counted from the start of the outermost object.
+	 * 			key is used by maps, element by arrays, sets (value) and maps (mapped value).
+	 */
+	struct SchemaField
+	{
+		std::string name;
+		uint64_t offset = 0;
+
+		SchemaValue value;
+		SchemaValue key;
+		SchemaValue element;
+
+		/**
+		 * @brief	The local property of the leaf, nullptr for schemas read from an archive.
+		 */
+		const PropertyInfo* property = nullptr;
+	};
+
+	/**
+	 * @struct	SchemaRun
+	 * @brief	A block of bytes copied from a serialized object image into an instance.
+	 */
+	struct SchemaRun
+	{
+		uint64_t source;
+		uint64_t target;
+		uint64_t size;
+	};
+
+	/**
+	 * @class	TypeSchema
+	 * @brief	The serialized layout of a reflected type, identified by its layout fingerprint.
+	 * @details	An object is stored as an image of TypeInfo::GetTypeSize() bytes holding its Primitive and Bytes leaves
+	 * 			at their offsets, followed by its String and container leaves, in field order.
+	 * 			Pointers to objects are stored in the tail as Pointer leaves. Other pointers and unsupported leaves are not stored.
+	 */
+	class TypeSchema
+	{
+		public :
+			using SchemaIndexFunc = std::function<uint32_t(const TypeInfo* type)>;
+
+		public :
+			TypeSchema();
+
+			/**
+			 * @brief	Gets the schema of a local type, built on the first call and kept for the lifetime of the program.
+			 */
+			static const TypeSchema* Get(const TypeInfo* type);
+
+		public :
+			const std::string& GetName() const;
+			uint64_t GetFingerprint() const;
+			uint64_t GetSize() const;
+			const std::vector<SchemaField>& GetFields() const;
+
+			/**
+			 * @brief	Gets the Primitive and Bytes leaves merged into contiguous blocks.
+			 */
+			const std::vector<SchemaRun>& GetRuns() const;
+
+			/**
+			 * @brief	Gets the indices of the String, Pointer and container leaves, stored after the image.
+			 */
+			const std::vector<size_t>& GetTail() const;
+
+			/**
+			 * @brief	Checks if an image is a plain copy of the whole instance (trivially copyable, nothing skipped).
+			 */
+			bool IsFlat() const;
+
+			/**
+			 * @brief	Appends the schema to an archive.
+			 * @param	output      The archive bytes.
+			 * @param	schemaIndex Maps the types of the Object values to their index in the schema table.
+			 */
+			void Serialize(std::vector<char>& output, const SchemaIndexFunc& schemaIndex) const;
+
+			/**
+			 * @brief	Reads a schema written by Serialize.
+			 * @return	bool False if the input is truncated.
+			 */
+			bool Deserialize(const char*& cursor, const char* end);
+
+		private :
+			void AddFields(const TypeInfo* type, const std::string& prefix, size_t base);
+			void Finalize();
+
+		private :
+			std::string m_name;
+			uint64_t m_fingerprint;
+			uint64_t m_size;
+			bool m_flat;
+
+			std::vector<SchemaField> m_fields;
+			std::vector<SchemaRun> m_runs;
+			std::vector<size_t> m_tail;
+	};
+
+	/**
+	 * @class	SchemaRemap
+	 * @brief	The precomputed conversion of objects written with an old schema into a local type.
+	 * @details	Fields are matched by name, then by name without the owner qualifiers when unambiguous.
+	 * 			Matching Primitive and Bytes leaves become merged copy runs; numeric leaves whose kind changed are converted;
+	 * 			String and container leaves are decoded into the matching field or skipped.
+	 * 			Remaps are cached per (old fingerprint, local type) pair for the lifetime of the program.
+	 */
+	class SchemaRemap
+	{
+		public :
+			struct Conversion
+			{
+				uint64_t source;
+				TypeInfo::Primitive sourcePrimitive;
+				uint64_t target;
+				TypeInfo::Primitive targetPrimitive;
+			};
+
+			struct TailEntry
+			{
+				SchemaField source;
+				const SchemaField* target;
+			};
+
+		public :
+			static const SchemaRemap* Get(const TypeSchema* source, const TypeInfo* target);
+
+		public :
+			const std::vector<SchemaRun>& GetRuns() const;
+			const std::vector<Conversion>& GetConversions() const;
+			const std::vector<TailEntry>& GetTail() const;
+
+		private :
+			SchemaRemap(const TypeSchema* source, const TypeSchema* target);
+
+		private :
+			std::vector<SchemaRun> m_runs;
+			std::vector<Conversion> m_conversions;
+			std::vector<TailEntry> m_tail;
+	};
+
+	/**
+	 * @brief	Checks if a primitive kind is numeric or boolean, so ConvertPrimitive accepts it.
+	 */
+	bool IsNumeric(TypeInfo::Primitive primitive);
+
+	/**
+	 * @brief	Converts a numeric or boolean value between two primitive kinds.
+	 * @return	bool False if one of the kinds is not numeric, or if the value is NaN or out of the range of the target kind.
+	 */
+	bool ConvertPrimitive(TypeInfo::Primitive sourcePrimitive, const void* source, TypeInfo::Primitive targetPrimitive, void* target);
+};
+
+#endif // __REFLECTION_TYPESCHEMA_H__
\ No newline at end of file
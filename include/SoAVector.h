@@ -0,0 +1,342 @@
+#ifndef __REFLECTION_SOAVECTOR_H__
+#define __REFLECTION_SOAVECTOR_H__
+
+#include <cassert>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "Utils.h"
+#include "Type/TypeInfo.h"
+#include "Type/TypeCast.h"
+
+namespace Reflection
+{
+	class PropertyInfo;
+
+	/**
+	 * @struct	ColumnSpan
+	 * @brief	A contiguous view of the values of one column of a SoAVector.
+	 * @tparam	T The property type, possibly const qualified.
+	 */
+	template<typename T>
+	struct ColumnSpan
+	{
+		T* first;
+		size_t count;
+
+		T* begin() const { return first; }
+		T* end() const { return first + count; }
+		T* data() const { return first; }
+		size_t size() const { return count; }
+		bool empty() const { return 0 == count; }
+		T& operator[](size_t index) const { return first[index]; }
+	};
+
+	/**
+	 * @class	SoAStorage
+	 * @brief	Type-erased structure-of-arrays storage of a reflected type, one column per property.
+	 * @details	The columns are built from the registered properties of the row type, inherited ones included,
+	 * 			and are ordered by the offset of their property. Every column is a separate allocation aligned
+	 * 			on ColumnAlignment bytes. New rows take the values of a default constructed instance of the row type,
+	 * 			so the member initializers are kept. Trivially copyable values are moved with memcpy, the other ones
+	 * 			through their TypeInfo (Relocate when the columns grow). Only the reflected members of the row type are stored.
+	 */
+	class SoAStorage
+	{
+		public :
+			static constexpr size_t ColumnAlignment = 64;
+
+			struct Column
+			{
+				const PropertyInfo* property;
+				const TypeInfo* type;
+				size_t offset;
+				size_t size;
+				size_t alignment;
+				bool isTriviallyCopyable;
+				char* data;
+			};
+
+		public :
+			/**
+			 * @brief	Constructor for SoAStorage.
+			 * @param	rowType The reflected type of the rows. The storage is invalid and has no column
+			 * 			if a property type is not copyable and movable, or the values cannot be default constructed.
+			 */
+			explicit SoAStorage(const TypeInfo* rowType);
+			~SoAStorage();
+
+			SoAStorage(const SoAStorage&) = delete;
+			SoAStorage& operator=(const SoAStorage&) = delete;
+
+		public :
+			bool IsValid() const;
+			const TypeInfo* GetRowType() const;
+
+			size_t GetColumnCount() const;
+			const Column& GetColumn(size_t column) const;
+
+			/**
+			 * @brief	Finds the column of the property at the given offset of the row type.
+			 * @return	size_t The index of the column, or GetColumnCount() if no property lives at that offset.
+			 */
+			size_t FindColumn(size_t offset) const;
+
+			/**
+			 * @brief	Finds the column of a property by its qualified name (e.g. "Particle::m_Size").
+			 * @return	size_t The index of the column, or GetColumnCount() if the row type has no such property.
+			 */
+			size_t FindColumn(const std::string& propertyName) const;
+
+			void* GetElement(size_t column, size_t row)
+			{
+				return m_columns[column].data + row * m_columns[column].size;
+			}
+
+			const void* GetElement(size_t column, size_t row) const
+			{
+				return m_columns[column].data + row * m_columns[column].size;
+			}
+
+			size_t GetSize() const;
+			size_t GetCapacity() const;
+
+			void Reserve(size_t capacity);
+
+			/**
+			 * @brief	Grows with default rows or shrinks to the given number of rows.
+			 */
+			void Resize(size_t size);
+
+			/**
+			 * @brief	Appends a row copied from the properties of an instance of the row type.
+			 */
+			void PushBack(const void* object);
+
+			/**
+			 * @brief	Appends a row holding the values of a default constructed instance.
+			 */
+			void EmplaceBack();
+
+			void PopBack();
+
+			/**
+			 * @brief	Removes a row by moving the last row into its place, so the order of the rows is not kept.
+			 */
+			void SwapRemove(size_t row);
+
+			void Clear();
+
+			/**
+			 * @brief	Copies the values of a row into the properties of an instance of the row type.
+			 */
+			void Load(size_t row, void* object) const;
+
+			/**
+			 * @brief	Copies the properties of an instance of the row type into a row.
+			 */
+			void Store(size_t row, const void* object);
+
+		private :
+			void ConstructDefault(const Column& column, void* element) const;
+			static void CopyConstruct(const Column& column, void* element, const void* source);
+			static void CopyAssign(const Column& column, void* element, const void* source);
+			static void Destruct(const Column& column, void* element);
+
+			void Grow();
+
+		private :
+			const TypeInfo* m_rowType;
+			std::vector<Column> m_columns;
+			void* m_prototype;
+			size_t m_size;
+			size_t m_capacity;
+			bool m_isValid;
+	};
+
+	/**
+	 * @class	SoAVector
+	 * @brief	Structure-of-arrays container of a reflected type, laid out from its registered properties.
+	 * @details	Systems touching a few fields per pass sweep a contiguous column instead of striding over whole objects.
+	 * 			Columns are reached with GetColumn<&T::m_Member>() and rows through a proxy : soa[i].Get<&T::m_Member>().
+	 * 			The writes bypass the reflected setters, so write hooks (dirty tracking, observers) are not run.
+	 * 			A row type whose storage is invalid (see SoAStorage) aborts the construction, in every build.
+	 * @tparam	T The reflected row type.
+	 */
+	template<typename T>
+	class SoAVector
+	{
+		public :
+			/**
+			 * @class	RowProxy
+			 * @brief	Object-style access to the values of one row.
+			 */
+			template<bool IsConst>
+			class RowProxy
+			{
+				public :
+					using Storage = std::conditional_t<IsConst, const SoAStorage, SoAStorage>;
+
+					RowProxy(const SoAVector* owner, Storage* storage, size_t row)
+						: m_owner(owner)
+						, m_storage(storage)
+						, m_row(row)
+					{}
+
+					template<auto Member>
+					decltype(auto) Get() const
+					{
+						using Property = typename Utils::MemberTraits<decltype(Member)>::PropertyType;
+						using Value = std::conditional_t<IsConst, const Property, Property>;
+
+						return *static_cast<Value*>(m_storage->GetElement(m_owner->template GetColumnIndex<Member>(), m_row));
+					}
+
+					void Load(T& object) const
+					{
+						m_storage->Load(m_row, &object);
+					}
+
+					T ToObject() const
+					{
+						T object;
+						Load(object);
+						return object;
+					}
+
+					template<bool IsWritable = !IsConst, typename = std::enable_if_t<IsWritable>>
+					const RowProxy& operator=(const T& object) const
+					{
+						m_storage->Store(m_row, &object);
+						return *this;
+					}
+
+					size_t GetIndex() const
+					{
+						return m_row;
+					}
+
+				private :
+					const SoAVector* m_owner;
+					Storage* m_storage;
+					size_t m_row;
+			};
+
+			using Row = RowProxy<false>;
+			using ConstRow = RowProxy<true>;
+
+		public :
+			SoAVector()
+				: m_storage(TypeInfo::Get<T>())
+			{
+				// An invalid storage has no column, so every column access would read past the column list.
+				if (!m_storage.IsValid())
+				{
+					const std::string_view typeName = TypeInfo::Get<T>()->GetTypeName();
+
+					std::fprintf(stderr, "Reflection : SoAVector<%.*s> : a property cannot be stored by column (not copyable, relocatable or constructible).\n",
+						static_cast<int>(typeName.size()), typeName.data());
+					std::abort();
+				}
+			}
+
+			SoAVector(const SoAVector&) = delete;
+			SoAVector& operator=(const SoAVector&) = delete;
+
+		public :
+			/**
+			 * @brief	Gets the values of a property of every row.
+			 * @tparam	Member The member pointer of a PROPERTY of T, e.g. &Particle::m_Size.
+			 * @return	ColumnSpan The values, valid until the container grows.
+			 */
+			template<auto Member>
+			ColumnSpan<typename Utils::MemberTraits<decltype(Member)>::PropertyType> GetColumn()
+			{
+				using Property = typename Utils::MemberTraits<decltype(Member)>::PropertyType;
+
+				return { static_cast<Property*>(m_storage.GetElement(GetColumnIndex<Member>(), 0)), m_storage.GetSize() };
+			}
+
+			template<auto Member>
+			ColumnSpan<const typename Utils::MemberTraits<decltype(Member)>::PropertyType> GetColumn() const
+			{
+				using Property = typename Utils::MemberTraits<decltype(Member)>::PropertyType;
+
+				return { static_cast<const Property*>(m_storage.GetElement(GetColumnIndex<Member>(), 0)), m_storage.GetSize() };
+			}
+
+			/**
+			 * @brief	Gets the values of a property by its qualified name, for code that only knows the property at runtime.
+			 * @tparam	Property The property type.
+			 * @return	ColumnSpan The values, or an empty span if the property does not exist or has another type.
+			 */
+			template<typename Property>
+			ColumnSpan<Property> GetColumn(const std::string& propertyName)
+			{
+				const size_t column = m_storage.FindColumn(propertyName);
+
+				if ((m_storage.GetColumnCount() == column) || !IsSame(m_storage.GetColumn(column).type, TypeInfo::Get<Property>()))
+				{
+					return { nullptr, 0 };
+				}
+
+				return { static_cast<Property*>(m_storage.GetElement(column, 0)), m_storage.GetSize() };
+			}
+
+			Row operator[](size_t row)
+			{
+				return Row(this, &m_storage, row);
+			}
+
+			ConstRow operator[](size_t row) const
+			{
+				return ConstRow(this, &m_storage, row);
+			}
+
+			void PushBack(const T& object)
+			{
+				m_storage.PushBack(&object);
+			}
+
+			Row EmplaceBack()
+			{
+				m_storage.EmplaceBack();
+				return Row(this, &m_storage, m_storage.GetSize() - 1);
+			}
+
+			void PopBack() { m_storage.PopBack(); }
+			void SwapRemove(size_t row) { m_storage.SwapRemove(row); }
+			void Clear() { m_storage.Clear(); }
+			void Reserve(size_t capacity) { m_storage.Reserve(capacity); }
+			void Resize(size_t size) { m_storage.Resize(size); }
+
+			size_t GetSize() const { return m_storage.GetSize(); }
+			size_t GetCapacity() const { return m_storage.GetCapacity(); }
+			bool IsEmpty() const { return 0 == m_storage.GetSize(); }
+
+			const SoAStorage& GetStorage() const { return m_storage; }
+
+		private :
+			template<auto Member>
+			size_t GetColumnIndex() const
+			{
+				using Class = typename Utils::MemberTraits<decltype(Member)>::ClassType;
+				static_assert(std::is_base_of<Class, T>::value, "Reflection::SoAVector : The member does not belong to the row type.");
+
+				// Every SoAVector<T> builds the same columns, so the index is resolved once.
+				static const size_t column = m_storage.FindColumn(Utils::MemberOffset<T, Member>());
+				assert(column < m_storage.GetColumnCount() && "The member is not a reflected property.");
+
+				return column;
+			}
+
+		private :
+			SoAStorage m_storage;
+	};
+};
+
+#endif // __REFLECTION_SOAVECTOR_H__
\ No newline at end of file
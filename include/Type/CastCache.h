@@ -0,0 +1,143 @@
+#ifndef __REFLECTION_CASTCACHE_H__
+#define __REFLECTION_CASTCACHE_H__
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "Type/TypeInfo.h"
+
+namespace Reflection
+{
+	/**
+	 * @class	CastCache
+	 * @brief	Singleton remembering the result of a runtime cast for a (dynamic type, source type, target type) triple.
+	 * @details	An entry stores the answer, no subobject or the pointer adjustment, under a 64-bit key packing
+	 * 			the three type identifiers. A writer claims an empty slot with a compare-and-swap, writes the answer
+	 * 			and then publishes the key, so readers load the key and the answer without locks and never see
+	 * 			a partial entry. A triple missing from the table is resolved through TypeInfo::GetBaseOffset and added.
+	 * 			The table is sized from the number of registered types, and grows when a probe window is full while
+	 * 			it is half full; older tables are kept until the cache is destroyed, so a reader holding one stays valid.
+	 * 			The identifiers of unregistered types are never reused, so the entries are forgotten after every
+	 * 			unregistration instead of filling the table with dead keys.
+	 */
+	class CastCache
+	{
+		public :
+			static constexpr size_t MinCapacity = 1 << 12;
+			static constexpr size_t MaxCapacity = 1 << 20;
+			static constexpr size_t EntriesPerType = 8;
+			static constexpr size_t MaxProbe = 8;
+
+		private :
+			struct Entry
+			{
+				std::atomic<uint64_t> key;
+				std::atomic<int64_t> offset;
+			};
+
+			struct Table
+			{
+				size_t capacity;
+				uint32_t shift;
+				std::unique_ptr<Entry[]> entries;
+			};
+
+			// 21 bits per identifier, the dynamic one stored plus one so that 0 is an empty slot.
+			static constexpr uint32_t IdBits = 21;
+			static constexpr uint64_t IdLimit = (uint64_t(1) << IdBits) - 1;
+			static constexpr uint64_t BusyKey = ~uint64_t(0);
+			static constexpr int64_t NoSubobject = INT64_MIN;
+
+			CastCache();
+			~CastCache();
+
+		public :
+			static CastCache& GetHandle();
+
+		public :
+			/**
+			 * @brief	Gets the adjustment converting a sourceType pointer to a targetType pointer on an object of type runtimeType.
+			 * @details	A cached triple costs a hash and usually one slot read.
+			 * @param	runtimeType The dynamic type of the object.
+			 * @param	sourceType  The type the pointer currently points to.
+			 * @param	targetType  The type to cast to.
+			 * @param	offset      Receives the value to add to the address.
+			 * @return	bool False if the object has no unique sourceType or targetType subobject.
+			 */
+			bool Find(const TypeInfo* runtimeType, const TypeInfo* sourceType, const TypeInfo* targetType, ptrdiff_t& offset)
+			{
+				const uint64_t runtimeId = runtimeType->GetTypeId();
+				const uint64_t sourceId = sourceType->GetTypeId();
+				const uint64_t targetId = targetType->GetTypeId();
+
+				if ((IdLimit <= runtimeId) || (IdLimit <= sourceId) || (IdLimit <= targetId))
+				{
+					return Resolve(runtimeType, sourceType, targetType, offset);
+				}
+
+				const uint64_t key = ((runtimeId + 1) << (IdBits * 2)) | (sourceId << IdBits) | targetId;
+				const Table* table = m_table.load(std::memory_order_acquire);
+				const Entry& entry = table->entries[GetSlot(key, table->shift)];
+
+				if (key == entry.key.load(std::memory_order_acquire))
+				{
+					// The key is checked again : a slot cleared and refilled meanwhile must not pair the key with another answer.
+					const int64_t answer = entry.offset.load(std::memory_order_acquire);
+					if (key == entry.key.load(std::memory_order_relaxed))
+					{
+						offset = static_cast<ptrdiff_t>(answer);
+						return NoSubobject != answer;
+					}
+				}
+
+				return FindSlow(key, table, runtimeType, sourceType, targetType, offset);
+			}
+
+			/**
+			 * @brief	Forgets every entry, and grows the table if the registered types need a larger one.
+			 * @details	Called after every unregistration. Lookups running at the same time may still return a forgotten answer.
+			 */
+			void Clear();
+
+			/**
+			 * @brief	Gets the number of entries in the table.
+			 */
+			size_t GetSize() const;
+
+			/**
+			 * @brief	Gets the number of slots of the table.
+			 */
+			size_t GetCapacity() const;
+
+		private :
+			static size_t GetSlot(uint64_t key, uint32_t shift)
+			{
+				// Fibonacci hashing spreads the consecutive identifiers over the table.
+				return static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> shift);
+			}
+
+			bool FindSlow(uint64_t key, const Table* table, const TypeInfo* runtimeType, const TypeInfo* sourceType, const TypeInfo* targetType, ptrdiff_t& offset);
+			static bool Resolve(const TypeInfo* runtimeType, const TypeInfo* sourceType, const TypeInfo* targetType, ptrdiff_t& offset);
+
+			/**
+			 * @brief	Publishes an empty table of at least the given capacity. Called with the mutex locked.
+			 */
+			void Grow(size_t capacity);
+
+			static size_t GetRequiredCapacity();
+			static void OnUnregist(const TypeInfo* typeInfo);
+
+		private :
+			std::atomic<const Table*> m_table;
+			std::vector<std::unique_ptr<Table>> m_tables;
+			std::atomic<size_t> m_size;
+			std::atomic<uint64_t> m_clearedGeneration;
+			std::mutex m_mutex;
+	};
+};
+
+#endif // __REFLECTION_CASTCACHE_H__
\ No newline at end of file
@@ -0,0 +1,394 @@
+#ifndef __REFLECTION_ENUMINFO_H__
+#define __REFLECTION_ENUMINFO_H__
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+#include "Macro.h"
+
+namespace Reflection
+{
+	/**
+	 * @brief	A named value of a reflected enum.
+	 * @details	The value holds the bits of the enumerator converted to uint64_t, so the values of signed enums are sign extended.
+	 */
+	struct EnumEntry
+	{
+		uint64_t value = 0;
+		std::string_view name;
+	};
+
+	/**
+	 * @brief	The enumerators listed by GENERATE_ENUM / GENERATE_FLAGS, in declaration order.
+	 * @tparam	N The number of enumerators.
+	 */
+	template<size_t N>
+	struct EnumDeclaration
+	{
+		static constexpr size_t Count = N;
+
+		EnumEntry entries[N];
+		bool isFlags;
+
+		constexpr EnumDeclaration(const EnumEntry (&list)[N], bool flags)
+			: entries()
+			, isFlags(flags)
+		{
+			for (size_t index = 0; index < N; ++index)
+			{
+				entries[index] = list[index];
+			}
+		}
+	};
+
+	/**
+	 * @brief	Builds the sorted tables of EnumTable at compile time.
+	 * @details	Kept apart from EnumTable so the tables can be initialized from complete constexpr functions.
+	 * @tparam	T The enum type.
+	 */
+	template<typename T>
+	struct EnumSorter
+	{
+		static constexpr auto Declaration = ReflectionEnumEntries(static_cast<T*>(nullptr));
+		static constexpr size_t Count = decltype(Declaration)::Count;
+		static constexpr bool IsSigned = std::is_signed<std::underlying_type_t<T>>::value;
+
+		using EntryArray = std::array<EnumEntry, Count>;
+
+		struct SortedValues
+		{
+			EntryArray entries;
+			size_t count;
+		};
+
+		static constexpr bool Less(uint64_t lhs, uint64_t rhs)
+		{
+			return IsSigned ? (static_cast<int64_t>(lhs) < static_cast<int64_t>(rhs)) : (lhs < rhs);
+		}
+
+		static constexpr SortedValues SortByValue()
+		{
+			SortedValues sorted = { {}, 0 };
+
+			// Insertion sort, dropping the later names of a value so the first declared one is kept.
+			for (size_t index = 0; index < Count; ++index)
+			{
+				const EnumEntry entry = Declaration.entries[index];
+
+				size_t position = sorted.count;
+				while ((0 < position) && Less(entry.value, sorted.entries[position - 1].value))
+				{
+					--position;
+				}
+
+				if ((0 < position) && (sorted.entries[position - 1].value == entry.value))
+				{
+					continue;
+				}
+
+				for (size_t move = sorted.count; move > position; --move)
+				{
+					sorted.entries[move] = sorted.entries[move - 1];
+				}
+
+				sorted.entries[position] = entry;
+				++sorted.count;
+			}
+
+			return sorted;
+		}
+
+		static constexpr EntryArray SortByName()
+		{
+			EntryArray sorted = {};
+
+			for (size_t index = 0; index < Count; ++index)
+			{
+				const EnumEntry entry = Declaration.entries[index];
+
+				size_t position = index;
+				while ((0 < position) && (entry.name < sorted[position - 1].name))
+				{
+					sorted[position] = sorted[position - 1];
+					--position;
+				}
+
+				sorted[position] = entry;
+			}
+
+			return sorted;
+		}
+	};
+
+	/**
+	 * @class	EnumTable
+	 * @brief	The compile-time name / value tables of an enum declared with GENERATE_ENUM or GENERATE_FLAGS.
+	 * @details	ByValue holds the entries sorted by value (in the order of the underlying type), keeping the first declared
+	 * 			name of each value, so aliases do not change the name of a value. ByName holds every entry sorted by name.
+	 * 			When the values are contiguous the enum is dense, and the entry of a value is ByValue[value - min].
+	 * 			Only the first ValueCount entries of ByValue are used.
+	 * @tparam	T The enum type.
+	 */
+	template<typename T>
+	class EnumTable
+	{
+		private :
+			using Sorter = EnumSorter<T>;
+
+		public :
+			using Underlying = std::underlying_type_t<T>;
+			using EntryArray = typename Sorter::EntryArray;
+
+			static constexpr size_t DeclaredCount = Sorter::Count;
+			static constexpr bool IsSigned = Sorter::IsSigned;
+			static constexpr bool IsFlags = Sorter::Declaration.isFlags;
+
+		private :
+			static constexpr bool Less(uint64_t lhs, uint64_t rhs)
+			{
+				return Sorter::Less(lhs, rhs);
+			}
+
+			static constexpr typename Sorter::SortedValues s_sorted = Sorter::SortByValue();
+
+		public :
+			static constexpr EntryArray ByValue = s_sorted.entries;
+			static constexpr EntryArray ByName = Sorter::SortByName();
+			static constexpr size_t ValueCount = s_sorted.count;
+			static constexpr bool IsDense = (0 < ValueCount) && (ByValue[ValueCount - 1].value - ByValue[0].value == ValueCount - 1);
+
+			/**
+			 * @brief	Gets the name of a value, or an empty view if the value has no name.
+			 * @details	Dense enums index the table directly, sparse enums use a binary search.
+			 */
+			static constexpr std::string_view GetName(T value)
+			{
+				const uint64_t bits = static_cast<uint64_t>(value);
+
+				if constexpr (IsDense)
+				{
+					const uint64_t index = bits - ByValue[0].value;
+					return (index < ValueCount) ? ByValue[index].name : std::string_view();
+				}
+				else
+				{
+					size_t first = 0;
+					size_t last = ValueCount;
+
+					while (first < last)
+					{
+						const size_t middle = first + (last - first) / 2;
+
+						if (Less(ByValue[middle].value, bits))
+						{
+							first = middle + 1;
+						}
+						else
+						{
+							last = middle;
+						}
+					}
+
+					return ((first < ValueCount) && (ByValue[first].value == bits)) ? ByValue[first].name : std::string_view();
+				}
+			}
+
+			/**
+			 * @brief	Gets the value of a name with a binary search.
+			 * @return	bool False if no enumerator has this name.
+			 */
+			static constexpr bool GetValue(std::string_view name, T& value)
+			{
+				size_t first = 0;
+				size_t last = DeclaredCount;
+
+				while (first < last)
+				{
+					const size_t middle = first + (last - first) / 2;
+
+					if (ByName[middle].name < name)
+					{
+						first = middle + 1;
+					}
+					else
+					{
+						last = middle;
+					}
+				}
+
+				if ((first < DeclaredCount) && (ByName[first].name == name))
+				{
+					value = static_cast<T>(static_cast<Underlying>(ByName[first].value));
+					return true;
+				}
+
+				return false;
+			}
+	};
+
+	/**
+	 * @class	EnumInfo
+	 * @brief	The runtime view of the tables of a reflected enum, returned by TypeInfo::GetEnumInfo.
+	 * @details	Values are passed as the bits of the enumerator converted to uint64_t, as in EnumEntry.
+	 * 			Nothing allocates : names are views of the string literals of the declaration,
+	 * 			and flag masks are formatted into a caller-provided buffer.
+	 */
+	class EnumInfo
+	{
+		public :
+			template<typename T>
+			struct Tag
+			{};
+
+			/**
+			 * @brief	Constructor for EnumInfo, referencing the static tables of EnumTable<T>.
+			 * @tparam	T The enum type.
+			 */
+			template<typename T>
+			explicit EnumInfo(Tag<T>)
+				: m_byValue(EnumTable<T>::ByValue.data())
+				, m_byName(EnumTable<T>::ByName.data())
+				, m_valueCount(EnumTable<T>::ValueCount)
+				, m_nameCount(EnumTable<T>::DeclaredCount)
+				, m_size(sizeof(T))
+				, m_isSigned(EnumTable<T>::IsSigned)
+				, m_isDense(EnumTable<T>::IsDense)
+				, m_isFlags(EnumTable<T>::IsFlags)
+			{}
+
+		public :
+			/**
+			 * @brief	Gets the name of a value, or an empty view if the value has no name.
+			 * @details	O(1) for dense enums, a binary search for sparse ones.
+			 */
+			std::string_view GetName(uint64_t value) const;
+
+			/**
+			 * @brief	Gets the value of a name with a binary search.
+			 * @return	bool False if no enumerator has this name.
+			 */
+			bool GetValue(std::string_view name, uint64_t& value) const;
+
+			/**
+			 * @brief	Formats a flag mask as names separated by '|', like "Read|Write".
+			 * @details	A value with its own name (including 0) is written as that name. Otherwise the named values
+			 * 			contained in the mask are written in ascending order, and the bits left are appended in hexadecimal.
+			 * 			As with snprintf, the output is truncated to capacity - 1 characters and null-terminated.
+			 * @param	value    The mask.
+			 * @param	buffer   The output buffer, may be nullptr when capacity is 0.
+			 * @param	capacity The size of the buffer.
+			 * @return	size_t The length of the full text, excluding the terminator.
+			 */
+			size_t FormatFlags(uint64_t value, char* buffer, size_t capacity) const;
+
+			/**
+			 * @brief	Parses names separated by '|' into a flag mask. Numbers are also accepted as tokens.
+			 * @return	bool False if a token is neither a name nor a number.
+			 */
+			bool ParseFlags(std::string_view text, uint64_t& value) const;
+
+			/**
+			 * @brief	Reads the value of an enum instance, sign extended for signed enums.
+			 */
+			uint64_t Read(const void* instance) const;
+
+			/**
+			 * @brief	Writes a value into an enum instance, truncated to the size of the enum.
+			 */
+			void Write(void* instance, uint64_t value) const;
+
+			const EnumEntry* GetEntries() const;
+			size_t GetEntryCount() const;
+
+			bool IsDense() const;
+			bool IsFlags() const;
+			bool IsSigned() const;
+
+		private :
+			const EnumEntry*	m_byValue;
+			const EnumEntry*	m_byName;
+			const size_t		m_valueCount;
+			const size_t		m_nameCount;
+			const size_t		m_size;
+			const bool			m_isSigned;
+			const bool			m_isDense;
+			const bool			m_isFlags;
+	};
+
+	/**
+	 * @brief	Gets the name of an enumerator of an enum declared with GENERATE_ENUM or GENERATE_FLAGS.
+	 * @return	std::string_view The name, or an empty view if the value has no name.
+	 */
+	template<typename T>
+	constexpr std::string_view EnumToString(T value)
+	{
+		return EnumTable<T>::GetName(value);
+	}
+
+	/**
+	 * @brief	Gets the enumerator of a name of an enum declared with GENERATE_ENUM or GENERATE_FLAGS.
+	 * @return	bool False if no enumerator has this name, value is left unchanged.
+	 */
+	template<typename T>
+	constexpr bool EnumFromString(std::string_view name, T& value)
+	{
+		return EnumTable<T>::GetValue(name, value);
+	}
+
+	/**
+	 * @brief	Reached only when ParseEnumName meets an unknown name. Not constexpr, so a constant evaluation fails to compile.
+	 */
+	inline void UnknownEnumName()
+	{}
+
+	/**
+	 * @brief	Converts an enumerator name written in a macro, such as the flags of PROPERTY and METHOD.
+	 * @details	Meant for constant evaluation : an unknown name fails to compile instead of being ignored.
+	 * @param	name The name of an enumerator, or an empty name for 0.
+	 * @return	T The enumerator.
+	 */
+	template<typename T>
+	constexpr T ParseEnumName(std::string_view name)
+	{
+		T value = static_cast<T>(0);
+
+		if (!name.empty() && !EnumFromString(name, value))
+		{
+			UnknownEnumName();
+		}
+
+		return value;
+	}
+};
+
+#define __REFLECTION_ENUM_ENTRY__( Enum, Name ) Reflection::EnumEntry{ static_cast<uint64_t>(Enum::Name), #Name },
+
+#define __REFLECTION_ENUM_DECLARATION__( Enum, Flags, ... ) \
+	constexpr auto ReflectionEnumEntries(Enum*) \
+	{ \
+		constexpr Reflection::EnumEntry entries[] = { __REFLECTION_FOR_EACH__(__REFLECTION_ENUM_ENTRY__, Enum, __VA_ARGS__) }; \
+		return Reflection::EnumDeclaration<sizeof(entries) / sizeof(entries[0])>(entries, Flags); \
+	} \
+
+/**
+ * @def		GENERATE_ENUM( Enum, ... )
+ * @brief	Registers the enumerators of an enum, for TypeInfo::GetEnumInfo, EnumToString and EnumFromString.
+ * @details	Declares the function returning the enumerator list, found through argument-dependent lookup,
+ * 			so it must be placed in the namespace of the enum. For an enum declared inside a class,
+ * 			place it in the class with a friend prefix : friend GENERATE_ENUM(State, Idle, Running).
+ * 			The sorted tables are built at compile time by EnumTable. At most 64 enumerators can be listed.
+ * @param	Enum The enum type.
+ * @param	...  The names of the enumerators.
+ */
+#define GENERATE_ENUM( Enum, ... ) __REFLECTION_ENUM_DECLARATION__(Enum, false, __VA_ARGS__)
+
+/**
+ * @def		GENERATE_FLAGS( Enum, ... )
+ * @brief	GENERATE_ENUM for bitmask enums. The serializers write their values as names separated by '|'.
+ */
+#define GENERATE_FLAGS( Enum, ... ) __REFLECTION_ENUM_DECLARATION__(Enum, true, __VA_ARGS__)
+
+#endif // __REFLECTION_ENUMINFO_H__
\ No newline at end of file
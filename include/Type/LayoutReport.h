@@ -0,0 +1,75 @@
+#ifndef __REFLECTION_LAYOUTREPORT_H__
+#define __REFLECTION_LAYOUTREPORT_H__
+
+#include <cstddef>
+#include <vector>
+
+namespace Reflection
+{
+	class TypeInfo;
+	class PropertyInfo;
+
+	/**
+	 * @brief	The cache line size the layout analysis is computed for.
+	 */
+	constexpr size_t LayoutCacheLineSize = 64;
+
+	/**
+	 * @struct	LayoutField
+	 * @brief	A reflected property placed in the memory layout of its type.
+	 */
+	struct LayoutField
+	{
+		const PropertyInfo* property;
+		size_t offset;
+		size_t size;
+		size_t alignment;
+
+		// Bytes between the end of what precedes the field and the field itself.
+		size_t paddingBefore;
+
+		// True if the field covers more cache lines than its size requires, for an instance starting on a line.
+		bool isSplit;
+	};
+
+	/**
+	 * @struct	LayoutReport
+	 * @brief	The cache efficiency of a reflected type, computed by TypeInfo::AnalyzeLayout.
+	 * @details	The analysis only sees the reflected members. The vtable pointer of a polymorphic type and 
+	 * 			the subobjects of secondary bases are accounted for, but an unreflected member is counted as padding.
+	 */
+	struct LayoutReport
+	{
+		const TypeInfo* type;
+		size_t size;
+		size_t alignment;
+
+		// Bytes covered by no reflected property, vtable pointer or base subobject, and the part of them at the end.
+		size_t paddingBytes;
+		size_t tailPadding;
+
+		// Cache lines touched by one instance starting on a line, and the fields straddling two of them.
+		size_t cacheLines;
+		size_t splitCount;
+
+		// Fraction of the fields straddling two cache lines when instances are stored contiguously, as in a std::vector.
+		double arraySplitRate;
+
+		// The fields ordered by offset.
+		std::vector<LayoutField> fields;
+
+		// The properties declared by the type itself, by decreasing alignment then size, and the size this order would give.
+		std::vector<const PropertyInfo*> suggestedOrder;
+		size_t suggestedSize;
+
+		/**
+		 * @brief	Checks if reordering the declared properties would shrink the type.
+		 */
+		bool CanShrink() const
+		{
+			return suggestedSize < size;
+		}
+	};
+};
+
+#endif // __REFLECTION_LAYOUTREPORT_H__
\ No newline at end of file
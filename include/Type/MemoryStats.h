@@ -0,0 +1,43 @@
+#ifndef __REFLECTION_MEMORYSTATS_H__
+#define __REFLECTION_MEMORYSTATS_H__
+
+#include <cstddef>
+
+namespace Reflection
+{
+	/**
+	 * @struct	MemoryStats
+	 * @brief	The memory held by the reflection metadata, reported by TypeManager::GetMemoryStats.
+	 * @details	Counts the metadata objects and the heap buffers they own, without the overhead of the allocator.
+	 * 			The properties and methods are counted in the type that declares them, not in the types inheriting them.
+	 */
+	struct MemoryStats
+	{
+		size_t typeCount;
+		size_t propertyCount;
+		size_t methodCount;
+		size_t nameCount;
+
+		// The TypeInfo objects with their property lists, name tables and layout caches.
+		size_t typeBytes;
+
+		// The PropertyInfo objects and the thunk tables shared by the container properties.
+		size_t propertyBytes;
+
+		// The MethodInfo objects and their call thunks.
+		size_t methodBytes;
+
+		// The name pool : arena blocks and hash table.
+		size_t nameBytes;
+
+		// The bytes of every name request, duplicates included, i.e. what one string per metadata object would hold.
+		size_t requestedNameBytes;
+
+		// The lookup tables of the registry snapshot.
+		size_t registryBytes;
+
+		size_t totalBytes;
+	};
+};
+
+#endif // __REFLECTION_MEMORYSTATS_H__
\ No newline at end of file
@@ -0,0 +1,74 @@
+#ifndef __REFLECTION_REFERENCEGRAPH_H__
+#define __REFLECTION_REFERENCEGRAPH_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "Utils.h"
+#include "Type/TypeInfo.h"
+
+namespace Reflection
+{
+	/**
+	 * @brief	How VisitReferences walks the graph.
+	 * @details	Sequential walks depth first from a worklist on the calling thread.
+	 * 			Parallel walks the graph level by level, every level being split over the JobSystem.
+	 */
+	enum class TraversalMode : uint8_t
+	{
+		Sequential,
+		Parallel,
+	};
+
+	using ReferenceVisitFunc = void(*)(void* context, const TypeInfo* type, void* object);
+
+	/**
+	 * @brief	Calls visit once on every object reachable from root through pointer properties.
+	 * @details	Pointers are followed in properties and in the elements, keys and mapped values of containers, including the
+	 * 			pointers nested in value properties. Every object is reported with its most derived type and the address
+	 * 			of the complete object, even when reached through a secondary base, so shared objects are visited once and cycles terminate. The visited addresses are kept in a PointerSet.
+	 * 			In Parallel mode visit is called concurrently from several threads, in no particular order.
+	 * 			The graph must not be modified during the traversal.
+	 * @param	type    The type of the root object.
+	 * @param	root    The address of the root object.
+	 * @param	context The context passed to visit.
+	 * @param	visit   The function called on every object, root included.
+	 * @param	mode    The traversal mode.
+	 * @return	size_t The number of visited objects.
+	 */
+	size_t VisitReferences(const TypeInfo* type, void* root, void* context, ReferenceVisitFunc visit, TraversalMode mode = TraversalMode::Sequential);
+
+	/**
+	 * @brief	Calls visitor(const TypeInfo* type, void* object) on every object reachable from root, see above.
+	 */
+	template<typename Visitor>
+	size_t VisitReferences(const TypeInfo* type, void* root, Visitor&& visitor, TraversalMode mode = TraversalMode::Sequential)
+	{
+		using VisitorType = std::remove_reference_t<Visitor>;
+
+		ReferenceVisitFunc visit = [](void* context, const TypeInfo* objectType, void* object)
+		{
+			(*static_cast<VisitorType*>(context))(objectType, object);
+		};
+
+		return VisitReferences(type, root, const_cast<void*>(static_cast<const void*>(&visitor)), visit, mode);
+	}
+
+	/**
+	 * @brief	Calls visitor(const TypeInfo* type, void* object) on every object reachable from root, see above.
+	 */
+	template<typename T, typename Visitor>
+	size_t VisitReferences(T* root, Visitor&& visitor, TraversalMode mode = TraversalMode::Sequential)
+	{
+		if (nullptr == root)
+		{
+			return 0;
+		}
+
+		using Type = Utils::RemoveConst_t<T>;
+		return VisitReferences(TypeInfo::Get<Type>(), const_cast<Type*>(root), std::forward<Visitor>(visitor), mode);
+	}
+};
+
+#endif // __REFLECTION_REFERENCEGRAPH_H__
\ No newline at end of file
@@ -3,6 +3,8 @@
 
 #include "Utils.h"
 #include "Type/TypeInfo.h"
+#include "Type/CastCache.h"
+#include "Type/TypeStats.h"
 
 namespace Reflection
 {
@@ -24,6 +26,19 @@ namespace Reflection
 	 */
 	bool IsChild(const TypeInfo* parentType, const TypeInfo* childType);
 
+	/**
+	 * @brief	Computes the pointer adjustment converting a sourceType pointer to a targetType pointer.
+	 * @details	Both types are looked up as bases of the dynamic type of the object, so upcasts, downcasts
+	 * 			and cross casts between the bases of a class are handled alike. The answer is kept in the CastCache,
+	 * 			so a repeated triple costs one hashed lookup.
+	 * @param	runtimeType The dynamic type of the object.
+	 * @param	sourceType  The type the pointer currently points to.
+	 * @param	targetType  The type to cast to.
+	 * @param	offset      Receives the value to add to the address.
+	 * @return	bool False if the object has no unique sourceType or targetType subobject.
+	 */
+	bool GetCastOffset(const TypeInfo* runtimeType, const TypeInfo* sourceType, const TypeInfo* targetType, ptrdiff_t& offset);
+
 	/**
 	 * @brief	Checks if the TypeInfo of the two template types T and U are identical.
 	 * @tparam	T The first type to compare.
@@ -52,6 +67,8 @@ namespace Reflection
 	 * @brief	Performs safe casting between pointer types using the reflection system.
 	 * @details	This function checks for inheritance and actual runtime type to ensure casting safety,
 	 * 			primarily enhancing and replacing dynamic_cast functionality.
+	 * 			With several reflected bases, the address is adjusted to the target subobject,
+	 * 			including casts between two bases of the same object.
 	 * @tparam	T The target pointer type to cast to (Output Type, e.g., ObjectA*).
 	 * @tparam	U The input pointer type provided (Input Type, e.g., ObjectB*).
 	 * @param	pointer The address of the object to be cast.
@@ -77,28 +94,35 @@ namespace Reflection
 
 		// [Stage 1: Compile-time / Static Casting Check]
 	    // Check if the Pure Types are identical or if the cast is a safe compile-time upcast (UType -> TType).
-		if (IsSame<TType, UType>() || IsChild<TType, UType>())
+		// Decided at compile time, so the static_cast is only instantiated for the conversions it supports.
+		if constexpr (Utils::IsSame<TType, UType>::value || Utils::IsBase<TType, UType>::value)
 		{
+			REFLECTION_COUNT(CastSuccess);
 			return static_cast<T>(pointer);
 		}
 
 		// [Stage 2: Runtime / Dynamic Casting Check]
     	// The static check failed, now perform a dynamic check against the actual runtime object type.
 
-		// Get TypeInfo for the target type (T)
-		const TypeInfo* outputType = TypeInfo::Get<TType>();
+		// Get TypeInfo for the target type (T) and the static type (U) of the pointer.
+		const TypeInfo* outputType = TypeInfo::Get<Utils::RemoveConst_t<TType>>();
+		const TypeInfo* sourceType = TypeInfo::Get<Utils::RemoveConst_t<UType>>();
 		
 		// Get the TypeInfo of the actual instance that the pointer is pointing to.
 		const TypeInfo* inputType = pointer->GetTypeInfo();
 
-		// Check if the actual instance type (inputType) is the same as the target type (outputType)
-    	// OR if the actual instance type is a child of the target type (safe downcasting).
-		if (IsSame(outputType, inputType) || IsChild(outputType, inputType))
+		// Check if the actual instance has a unique target subobject, and move the address from the source subobject to it.
+		ptrdiff_t offset = 0;
+		if (CastCache::GetHandle().Find(inputType, sourceType, outputType, offset))
 		{
-			return static_cast<T>(pointer);
+			using Byte = Utils::Conditional_t<Utils::IsConst<TType>::value, const char, char>;
+
+			REFLECTION_COUNT(CastSuccess);
+			return reinterpret_cast<T>(reinterpret_cast<Byte*>(pointer) + offset);
 		}
 
 		// All validation failed, return nullptr.		
+		REFLECTION_COUNT(CastFailure);
 		return nullptr;
 	}
 };
@@ -3,16 +3,35 @@
 
 #include <typeinfo>
 #include <unordered_map>
+#include <vector>
+#include <array>
 #include <string>
+#include <mutex>
+#include <atomic>
+#include <new>
 #include <iostream>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <utility>
 
 #include "Utils.h"
 #include "Macro.h"
+#include "NamePool.h"
+#include "NameTable.h"
+#include "Type/EnumInfo.h"
+#include "Property/PropertyFlag.h"
 
 namespace Reflection
 {
 	class PropertyInfo;
+	class ContainerPropertyInfo;
 	class MethodInfo;
+	class Arena;
+	class PropertyDiff;
+	class PropertyMask;
+	struct PropertyChange;
+	struct LayoutReport;
 
 	/**
 	 * @class	TypeInfo
@@ -23,16 +42,160 @@ namespace Reflection
 	{
 		public :
 			/**
-			 * @brief	Template struct for initializing TypeInfo instances.
-			 * @tparam	T The type for which to create TypeInfo.
+			 * @brief	Flat table of the properties by qualified name ("Owner::m_member"), inherited ones included.
 			 */
-			using PropertyMap = std::unordered_map<std::string, const PropertyInfo*>;
+			using PropertyMap = NameTable<PropertyInfo>;
 
 			/**
-			 * @brief	Template struct for initializing TypeInfo instances.
-			 * @tparam	T The type for which to create TypeInfo.
+			 * @brief	Flat table of the methods by qualified name ("Owner::Method"), inherited ones included.
+			 */
+			using MethodMap = NameTable<MethodInfo>;
+
+			/**
+			 * @brief	Ordered list of the properties, the super type's properties first and then in declaration order.
+			 * @details	This is the same order as the compile-time list visited by ForEachProperty.
+			 */
+			using PropertyList = std::vector<const PropertyInfo*>;
+
+			/**
+			 * @brief	A contiguous view of properties, such as the properties having a given PropertyFlag.
+			 */
+			struct PropertyRange
+			{
+				const PropertyInfo* const* first;
+				const PropertyInfo* const* last;
+
+				const PropertyInfo* const* begin() const { return first; }
+				const PropertyInfo* const* end() const { return last; }
+				size_t size() const { return static_cast<size_t>(last - first); }
+				bool empty() const { return first == last; }
+				const PropertyInfo* operator[](size_t index) const { return first[index]; }
+			};
+
+			/**
+			 * @brief	Function pointer types for comparing and hashing values via Type Erasure.
+			 * @details	Generated in the constructor when T provides operator== or a std::hash specialization.
+			 */
+			using EqualFunc = bool(*)(const void* lhs, const void* rhs);
+			using HashFunc = size_t(*)(const void* instance);
+
+			/**
+			 * @brief	Function pointer types for the lifecycle of values via Type Erasure.
+			 * @details	Generated in the constructor from the special members T provides. 
+			 * 			A nullptr means the operation is not available for T (e.g. abstract or non-copyable types),
+			 * 			or not needed (DestructFunc of trivially destructible types).
+			 */
+			using ConstructFunc = void(*)(void* instance);
+			using DestructFunc = void(*)(void* instance);
+			using CopyConstructFunc = void(*)(void* instance, const void* other);
+			using CopyAssignFunc = void(*)(void* instance, const void* other);
+			using RelocateFunc = void(*)(void* instance, void* other);
+			using RuntimeTypeFunc = const TypeInfo* (*)(const void* instance);
+
+			/**
+			 * @brief	Function pointer type returning the dirty mask of a tracked instance (GENERATE_TRACKED).
+			 */
+			using DirtyMaskFunc = PropertyMask* (*)(void* instance);
+
+			/**
+			 * @brief	A precomputed step of the structural comparison of a reflected type.
+			 * @details	Adjacent trivially-copyable properties, including the ones of nested reflected values,
+			 * 			are merged into a single byte run (type == nullptr) which is compared with memcmp 
+			 * 			and hashed in one pass. The other properties are handled by their own TypeInfo 
+			 * 			or, for containers, element by element through the ContainerPropertyInfo.
+			 */
+			struct Segment
+			{
+				size_t offset;
+				size_t size;
+				const TypeInfo* type;
+				const ContainerPropertyInfo* container;
+			};
+
+			using SegmentList = std::vector<Segment>;
+
+			/**
+			 * @brief	A pointer held by a reflected type, directly or through a container.
+			 * @details	When container is nullptr, the pointer property of the given pointer type lives at offset.
+			 * 			Otherwise the container at offset holds pointers in its elements (values, keys or mapped values).
+			 */
+			struct Reference
+			{
+				size_t offset;
+				const TypeInfo* type;
+				const ContainerPropertyInfo* container;
+			};
+
+			using ReferenceList = std::vector<Reference>;
+
+			/**
+			 * @brief	A property prepared for Diff and ApplyDiff, ordered by offset.
+			 * @details	Bitwise comparable fields (container == nullptr and IsBitwiseComparable, so no padding inside) record
+			 * 			the bytes of the run of adjacent bitwise comparable fields starting at them, so an unchanged run is
+			 * 			skipped with a single memcmp. runLength is 0 for the other fields.
 			 */
-			using MethodMap = std::unordered_map<std::string, const MethodInfo*>;
+			struct Field
+			{
+				size_t ordinal;
+				size_t offset;
+				size_t size;
+				const TypeInfo* type;
+				const ContainerPropertyInfo* container;
+				size_t runLength;
+				size_t runSize;
+			};
+
+			using FieldList = std::vector<Field>;
+
+			/**
+			 * @brief	A reflected base class and the offset of its subobject in an instance of the derived class.
+			 */
+			struct BaseType
+			{
+				const TypeInfo* type;
+				ptrdiff_t offset;
+			};
+
+			using BaseList = std::vector<BaseType>;
+
+			/**
+			 * @brief	A direct or indirect reflected base, in the table sorted by type hash used by the casts.
+			 * @details	A base reached through two paths (a non-virtual diamond) has no single subobject,
+			 * 			so its offset is AmbiguousOffset.
+			 */
+			struct Ancestor
+			{
+				size_t typeHash;
+				const TypeInfo* type;
+				ptrdiff_t offset;
+			};
+
+			using AncestorList = std::vector<Ancestor>;
+
+			static constexpr ptrdiff_t AmbiguousOffset = PTRDIFF_MIN;
+
+			/**
+			 * @brief	The built-in value kind of a type, used by the serializers to read and write leaf values.
+			 * @details	Integers are classified by size and signedness, so int and long map to the same kind on LP64.
+			 * 			Enums have the kind of their underlying type. Every other type is None.
+			 */
+			enum class Primitive : uint8_t
+			{
+				None,
+				Bool,
+				Int8,
+				Int16,
+				Int32,
+				Int64,
+				UInt8,
+				UInt16,
+				UInt32,
+				UInt64,
+				Float,
+				Double,
+				String,
+				StringView,
+			};
 
 		public:
 			/**
@@ -51,11 +214,13 @@ namespace Reflection
 			struct Initializer
 			{
 				const TypeInfo* superType;
+				const BaseList baseTypes;
 				const size_t typeHash;
-				const std::string typeName;
+				const std::string_view typeName;
 
-				Initializer(const std::string& name)
+				Initializer(std::string_view name)
 					: superType(nullptr)
+					, baseTypes()
 					, typeHash(typeid(T).hash_code())
 					, typeName(name)
 				{}
@@ -63,22 +228,39 @@ namespace Reflection
 
 			/**
 			 * @brief	Template struct specialization for types with a SuperType defined.
+			 * @details	The reflected bases are the ones listed by GENERATE(Class, Bases...), or the SuperType alone.
 			 * @tparam	T The type for which to create TypeInfo.
 			 */
 			template<typename T>
 			struct Initializer<T, ValidSuper<T>>
 			{
 				const TypeInfo* superType;
+				const BaseList baseTypes;
 				const size_t typeHash;
-				const std::string typeName;
+				const std::string_view typeName;
 
-				Initializer(const std::string& name)
+				Initializer(std::string_view name)
 					: superType(T::SuperType::GetStaticTypeInfo())
+					, baseTypes(MakeBaseList<Utils::RemoveConst_t<T>>(typename T::BaseTypes{}))
 					, typeHash(typeid(T).hash_code())
 					, typeName(name)
 				{}
 			};
 
+			template<typename T, typename... Bases>
+			static BaseList MakeBaseList(Utils::TypeList<Bases...>)
+			{
+				if constexpr (0 == sizeof...(Bases))
+				{
+					using Super = typename T::SuperType;
+					return BaseList{ BaseType{ Super::GetStaticTypeInfo(), Utils::BaseOffset<T, Super>() } };
+				}
+				else
+				{
+					return BaseList{ BaseType{ Bases::GetStaticTypeInfo(), Utils::BaseOffset<T, Bases>() }... };
+				}
+			}
+
 		public :
 			/**
 			 * @brief	Retrieves the TypeInfo instance for a given type T (Self-Registration API).
@@ -88,15 +270,14 @@ namespace Reflection
 			 * 			the TypeManager at static initialization time (Lazy Initialization).
 			 * 			The function guarantees **runtime immutability** by always returning 
 			 * 			a constant pointer (`const TypeInfo*`) to the single, static instance.
+			 * 			The name is interned in the NamePool, so the TypeInfo does not own a copy of it.
 			 * @tparam	T The type for which to retrieve the TypeInfo.
 			 * @return	const TypeInfo* A pointer to the unique, read-only TypeInfo instance.
 			 */
 			template<typename T>
 			static const TypeInfo* Get()
 			{
-				static std::string className = Utils::GetName(__CLASSNAME__);
-				static TypeInfo::Initializer<T> initializer(className);
-				static TypeInfo typeInfo(initializer);
+				static TypeInfo typeInfo(TypeInfo::Initializer<T>(NamePool::GetHandle().Intern(Utils::GetName(__CLASSNAME__))));
 
 				return &typeInfo;
 			}
@@ -110,41 +291,168 @@ namespace Reflection
 			template<typename T>
 			explicit TypeInfo(const Initializer<T>& initializer)
 				: m_properties()
+				, m_propertyList()
 				, m_methods()
+				, m_rebasedProperties()
 				, m_typeName(initializer.typeName)
 				, m_typeHash(initializer.typeHash)
+				, m_typeId(AllocateTypeId())
 				, m_superType(initializer.superType)
+				, m_baseTypes(initializer.baseTypes)
+				, m_ancestors()
 				, m_pureType(this)
+				, m_pointeeType(nullptr)
+				, m_typeSize(Utils::ObjectTraits<T>::size)
+				, m_typeAlignment(Utils::ObjectTraits<T>::alignment)
+				, m_isTriviallyCopyable(Utils::ObjectTraits<T>::isTriviallyCopyable)
+				, m_isPointer(Utils::IsPointer<T>::value)
+				, m_isPolymorphic(Utils::ObjectTraits<T>::isPolymorphic)
+				, m_primitive(GetPrimitive<T>())
+				, m_equalFunc(nullptr)
+				, m_hashFunc(nullptr)
+				, m_constructFunc(nullptr)
+				, m_destructFunc(nullptr)
+				, m_copyConstructFunc(nullptr)
+				, m_copyAssignFunc(nullptr)
+				, m_relocateFunc(nullptr)
+				, m_runtimeTypeFunc(nullptr)
+				, m_dirtyMaskFunc(nullptr)
+				, m_enumInfo(nullptr)
+				, m_container(nullptr)
+				, m_layoutFlag()
+				, m_segments()
+				, m_references()
+				, m_fields()
+				, m_fieldIndices()
+				, m_layoutFingerprint(0)
+				, m_flagListFlag()
+				, m_flagProperties()
+				, m_flagOffsets()
 			{
 				if constexpr (Utils::IsPointer<T>::value || Utils::IsReference<T>::value || Utils::IsConst<T>::value)
 				{
 					m_pureType = TypeInfo::Get<Utils::PureType_t<T>>();
 				}
 
-				if (nullptr != m_superType)
+				if constexpr (Utils::HasPointee<T>::value)
 				{
-					for (const auto& [name, propertyInfo] : m_superType->GetProperties())
+					m_pointeeType = TypeInfo::Get<typename T::PointeeType>();
+				}
+
+				if constexpr (std::is_object<T>::value && Utils::HasEqual<T>::value)
+				{
+					m_equalFunc = [](const void* lhs, const void* rhs) -> bool
 					{
-						AddProperty(propertyInfo);
-					}
+						return *static_cast<const T*>(lhs) == *static_cast<const T*>(rhs);
+					};
+				}
 
-					for (const auto& [name, methodInfo] : m_superType->GetMethods())
+				if constexpr (std::is_object<T>::value && Utils::HasHash<T>::value)
+				{
+					m_hashFunc = [](const void* instance) -> size_t
 					{
-						AddMethod(methodInfo);
-					}
+						return std::hash<T>{}(*static_cast<const T*>(instance));
+					};
 				}
 
+				if constexpr (std::is_object<T>::value && std::is_default_constructible<T>::value)
+				{
+					m_constructFunc = [](void* instance)
+					{
+						new (instance) T();
+					};
+				}
+
+				if constexpr (std::is_object<T>::value && std::is_destructible<T>::value && !std::is_trivially_destructible<T>::value)
+				{
+					m_destructFunc = [](void* instance)
+					{
+						static_cast<T*>(instance)->~T();
+					};
+				}
+
+				if constexpr (std::is_object<T>::value && Utils::IsCopyable<T>::value)
+				{
+					m_copyConstructFunc = [](void* instance, const void* other)
+					{
+						new (instance) T(*static_cast<const T*>(other));
+					};
+
+					m_copyAssignFunc = [](void* instance, const void* other)
+					{
+						*static_cast<T*>(instance) = *static_cast<const T*>(other);
+					};
+				}
+
+				if constexpr (std::is_object<T>::value && std::is_move_constructible<T>::value && std::is_destructible<T>::value)
+				{
+					m_relocateFunc = [](void* instance, void* other)
+					{
+						new (instance) T(std::move(*static_cast<T*>(other)));
+						static_cast<T*>(other)->~T();
+					};
+				}
+
+				if constexpr (Utils::HasRuntimeType<T>::value)
+				{
+					m_runtimeTypeFunc = [](const void* instance) -> const TypeInfo*
+					{
+						return static_cast<const T*>(instance)->GetTypeInfo();
+					};
+				}
+
+				if constexpr (Utils::HasDirtyMask<T>::value)
+				{
+					m_dirtyMaskFunc = [](void* instance) -> PropertyMask*
+					{
+						return &static_cast<T*>(instance)->GetDirtyMask();
+					};
+				}
+
+				if constexpr (std::is_enum<T>::value && Utils::HasEnumEntries<T>::value)
+				{
+					static const EnumInfo enumInfo(EnumInfo::Tag<T>{});
+					m_enumInfo = &enumInfo;
+				}
+
+				BuildAncestors();
+				InheritBases();
+
 				Regist();
 			}
 
+			/**
+			 * @brief	Destructor for TypeInfo.
+			 * @details	A type of a plugin module still registered when the plugin is unloaded is unregistered here,
+			 * 			so the registry never keeps a pointer to it.
+			 */
+			~TypeInfo();
+
 			bool operator==(const TypeInfo& other) const;
 
 		public :
 			const PropertyMap& GetProperties() const;
+			const PropertyList& GetPropertyList() const;
 			const MethodMap& GetMethods() const;
 
-			const PropertyInfo* GetProperty(const std::string& name) const;
-			const MethodInfo* GetMethod(const std::string& name) const;
+			const PropertyInfo* GetProperty(std::string_view name) const;
+			const MethodInfo* GetMethod(std::string_view name) const;
+
+			/**
+			 * @brief	Gets the properties having a flag, in the order of GetPropertyList().
+			 * @details	The lists of every flag are built on the first call into one contiguous array,
+			 * 			so serializers iterate exactly the properties they need without testing flags per object.
+			 * 			Must be called after the static initialization phase.
+			 * @param	flag A single PropertyFlag. Masks of several flags get an empty range.
+			 * @return	PropertyRange The properties, valid for the lifetime of the TypeInfo.
+			 */
+			PropertyRange GetPropertiesWith(PropertyFlag flag) const;
+
+			/**
+			 * @brief	Gets the properties not having a flag (e.g. the non-Transient ones), in the order of GetPropertyList().
+			 * @param	flag A single PropertyFlag, or None for every property. Masks of several flags get an empty range.
+			 */
+			PropertyRange GetPropertiesWithout(PropertyFlag flag) const;
 
 			/**
 			 * @brief	[Internal Use Only] Registers a property into this TypeInfo instance.
@@ -163,11 +471,298 @@ namespace Reflection
 			 */
 			void AddMethod(const MethodInfo* method);
 
-			const std::string& GetTypeName() const;
+			/**
+			 * @brief	Gets the name of the type, interned in the NamePool and null-terminated.
+			 */
+			std::string_view GetTypeName() const;
 			size_t GetTypeHash() const;
+
+			/**
+			 * @brief	Gets the dense identifier of this TypeInfo, given in construction order from 0.
+			 * @details	Suited to index tables, like the CastCache. Qualified variants (const T, T*) have their own identifiers.
+			 * 			Defined here because the runtime casts read it on every call.
+			 */
+			uint32_t GetTypeId() const
+			{
+				return m_typeId;
+			}
+
+			/**
+			 * @brief	Gets the number of type identifiers given so far.
+			 */
+			static uint32_t GetTypeIdCount();
+
 			const TypeInfo* GetSuperType() const;
 			const TypeInfo* GetPureType() const;
 
+			/**
+			 * @brief	Gets the direct reflected bases in declaration order, the SuperType first.
+			 */
+			const BaseList& GetBaseTypes() const;
+
+			/**
+			 * @brief	Checks if a type is a direct or indirect reflected base of this type.
+			 */
+			bool IsDerivedFrom(const TypeInfo* baseType) const;
+
+			/**
+			 * @brief	Gets the offset of a base subobject in an instance of this type.
+			 * @details	The offsets of every direct and indirect base are computed when the type is registered,
+			 * 			so this is a binary search in a small table.
+			 * @param	baseType The base type, or this type itself (offset 0).
+			 * @param	offset   Receives the address of the base subobject minus the address of the instance.
+			 * @return	bool False if baseType is not a base of this type, or is reached through several paths.
+			 */
+			bool GetBaseOffset(const TypeInfo* baseType, ptrdiff_t& offset) const;
+
+			size_t GetTypeSize() const;
+			size_t GetTypeAlignment() const;
+			bool IsTriviallyCopyable() const;
+			bool IsPointer() const;
+			bool IsPolymorphic() const;
+			Primitive GetPrimitive() const;
+
+			/**
+			 * @brief	Gets the name / value tables of an enum declared with GENERATE_ENUM or GENERATE_FLAGS.
+			 * @return	const EnumInfo* The tables, or nullptr if the type is not a reflected enum.
+			 */
+			const EnumInfo* GetEnumInfo() const;
+
+			/**
+			 * @brief	Gets the description of this type as a container, when it is the element of another container.
+			 * @details	Set for the value types of arrays and the mapped types of maps, so nested containers such as
+			 * 			std::vector<std::vector<int>> can be walked element by element (e.g. by PropertyPath "m_grid[1][2]").
+			 * 			The description is ownerless, at offset 0 of the element.
+			 * @return	const ContainerPropertyInfo* The description, or nullptr if the type is not used as a container element.
+			 */
+			const ContainerPropertyInfo* GetContainer() const;
+
+			/**
+			 * @brief	[Internal Use Only] Sets the description returned by GetContainer. Called during static initialization.
+			 */
+			void SetContainer(const ContainerPropertyInfo* container);
+
+			/**
+			 * @brief	Gets the bytes of this TypeInfo and of its lists and tables, not counting its properties and methods.
+			 * @details	The lazily built caches (segments, fields, flag lists) are counted once built. Used by TypeManager::GetMemoryStats.
+			 */
+			size_t GetMetadataBytes() const;
+
+		public :
+			/**
+			 * @brief	Compares two instances of this type structurally.
+			 * @details	Reflected types are compared property by property, following nested reflected values 
+			 * 			and containers. Runs of adjacent trivially-copyable properties are compared bitwise with memcmp,
+			 * 			so floating point fields follow bitwise semantics (e.g. -0.0f differs from 0.0f).
+			 * 			Pointer properties are compared by address. 
+			 * 			Types without properties are compared bitwise when trivially copyable, or with their operator==.
+			 * 			Otherwise they are opaque (see IsComparable) : two distinct instances are never equal, so a change
+			 * 			to such a member is always reported by Diff instead of being dropped.
+			 * 			Must be called after the static initialization phase.
+			 * @param	lhs The address of the first instance.
+			 * @param	rhs The address of the second instance.
+			 * @return	bool True if both instances are structurally equal.
+			 */
+			bool Equals(const void* lhs, const void* rhs) const;
+
+			/**
+			 * @brief	Computes a content hash of an instance of this type.
+			 * @details	Follows the same structure as Equals, so structurally equal instances have the same hash.
+			 * 			Runs of adjacent trivially-copyable properties are hashed in one pass with Utils::HashBytes.
+			 * @param	instance The address of the instance.
+			 * @param	seed     The initial hash value.
+			 * @return	size_t The hash value.
+			 */
+			size_t Hash(const void* instance, size_t seed = 0) const;
+
+			/**
+			 * @brief	Checks if Equals can find two distinct instances of this type equal.
+			 * @details	False for the opaque types : no reflected property, not trivially copyable and no operator==.
+			 */
+			bool IsComparable() const;
+
+			/**
+			 * @brief	Checks if Equals and Hash of this type reduce to a single memcmp / HashBytes over the whole instance.
+			 * @details	Containers use this to compare and hash contiguous elements in one pass.
+			 * @return	bool True if the whole instance is compared bitwise.
+			 */
+			bool IsBitwiseComparable() const;
+
+			/**
+			 * @brief	Gets a 64-bit fingerprint of the memory layout of this type.
+			 * @details	Hashes the size and alignment of the type and, for every property, its name, offset
+			 * 			and the fingerprint of its type (element types for containers). Primitive types are identified
+			 * 			by their kind and size rather than their name, so the value is stable across compilers.
+			 * 			Two types with the same fingerprint can be reinterpreted from each other's bytes.
+			 * @return	uint64_t The fingerprint, computed on the first call.
+			 */
+			uint64_t GetLayoutFingerprint() const;
+
+			/**
+			 * @brief	Gets the precomputed comparison segments of this type.
+			 * @details	The list is built on the first call, once the properties have been registered.
+			 * @return	const SegmentList& The segments ordered by offset.
+			 */
+			const SegmentList& GetSegments() const;
+
+			/**
+			 * @brief	Gets the pointers held by this type, including the ones of nested reflected values.
+			 * @details	Built together with the segments on the first call.
+			 * @return	const ReferenceList& The references ordered by offset.
+			 */
+			const ReferenceList& GetReferences() const;
+
+			/**
+			 * @brief	Gets the properties of this type prepared for Diff, built together with the segments.
+			 * @return	const FieldList& The fields ordered by offset.
+			 */
+			const FieldList& GetFields() const;
+
+			/**
+			 * @brief	Analyzes how cache efficient the memory layout of this type is.
+			 * @details	Reports the padding bytes, the fields straddling 64-byte cache lines and an order of the declared
+			 * 			properties by decreasing alignment that minimizes the padding. Only reflected members are seen,
+			 * 			so an unreflected member is reported as padding. Must be called after the static initialization phase.
+			 * @return	LayoutReport The report, computed on every call.
+			 */
+			LayoutReport AnalyzeLayout() const;
+
+		public :
+			/**
+			 * @brief	Computes which properties differ between two instances of this type.
+			 * @details	Properties are identified by their ordinal in GetPropertyList(). Runs of adjacent 
+			 * 			bitwise comparable properties are compared with one memcmp, and only a differing run 
+			 * 			is compared field by field; other values are compared with Equals, so padding is never compared.
+			 * 			Containers also record element-level changes. The new value of every changed property
+			 * 			is copied into the diff, so rhs does not have to outlive it.
+			 * 			Types without properties have no ordinals, so their diff is always empty.
+			 * @param	lhs  The address of the old instance.
+			 * @param	rhs  The address of the new instance.
+			 * @param	diff The diff to fill. It is cleared first and can be reused across calls.
+			 * @return	bool True if any property differs.
+			 */
+			bool Diff(const void* lhs, const void* rhs, PropertyDiff& diff) const;
+
+			/**
+			 * @brief	Computes which properties differ between two instances of this type into a new PropertyDiff.
+			 */
+			PropertyDiff Diff(const void* lhs, const void* rhs) const;
+
+			/**
+			 * @brief	Applies a diff computed by Diff, copying only the changed properties and elements.
+			 * @details	The values are read from the diff. Bitwise comparable properties are copied with memcpy.
+			 * 			A property whose type cannot be copied has no stored value and is left unchanged.
+			 * @param	instance The address of the instance to update, equal to the lhs of Diff.
+			 * @param	diff     The diff computed by Diff.
+			 */
+			void ApplyDiff(void* instance, const PropertyDiff& diff) const;
+
+		public :
+			/**
+			 * @brief	Default constructs an instance of this type in the given memory.
+			 * @return	bool False if the type is not default constructible.
+			 */
+			bool Construct(void* instance) const;
+
+			/**
+			 * @brief	Destroys an instance of this type without releasing its memory.
+			 */
+			void Destruct(void* instance) const;
+
+			/**
+			 * @brief	Copy constructs an instance of this type in the given memory.
+			 * @return	bool False if the type is not copyable.
+			 */
+			bool CopyConstruct(void* instance, const void* other) const;
+
+			/**
+			 * @brief	Copy assigns an instance of this type. Trivially-copyable types are copied with memcpy.
+			 * @return	bool False if the type is not copyable.
+			 */
+			bool CopyAssign(void* instance, const void* other) const;
+
+			/**
+			 * @brief	Move constructs an instance of this type in the given memory, then destroys the moved-from instance.
+			 * @details	Used to move values between storages without a deep copy. Trivially-copyable types are copied with memcpy.
+			 * @return	bool False if the type is not move constructible.
+			 */
+			bool Relocate(void* instance, void* other) const;
+
+			bool IsConstructible() const;
+			bool IsCopyable() const;
+			bool IsRelocatable() const;
+			bool IsTriviallyDestructible() const;
+			DestructFunc GetDestructFunc() const;
+
+			/**
+			 * @brief	Gets the dynamic TypeInfo of an instance through its virtual GetTypeInfo().
+			 * @details	Only a dynamic type sharing the address of the instance is returned, so an object reached
+			 * 			through a secondary base is handled as that base.
+			 * @param	instance The address of an instance of this type.
+			 * @return	const TypeInfo* The dynamic TypeInfo, or this TypeInfo if the type is not polymorphic.
+			 */
+			const TypeInfo* GetRuntimeType(const void* instance) const;
+
+			/**
+			 * @brief	Gets the dynamic TypeInfo of the complete object an instance belongs to.
+			 * @details	Unlike GetRuntimeType, an instance reached through a secondary base resolves to the most derived type.
+			 * @param	instance The address of an instance of this type.
+			 * @param	offset Receives the offset of the instance in the complete object, 0 if the type is not polymorphic.
+			 * @return	const TypeInfo* The most derived TypeInfo, whose object starts at instance - offset.
+			 */
+			const TypeInfo* GetCompleteType(const void* instance, ptrdiff_t& offset) const;
+
+			/**
+			 * @brief	Deep clones an instance of this type into the given arena.
+			 * @details	The clone is allocated with the dynamic type of the source. Property values are copied through
+			 * 			the precomputed segments, so runs of trivially-copyable properties are copied in bulk.
+			 * 			Pointer properties to reflected objects are followed and their targets are cloned once,
+			 * 			so shared references and cycles are remapped to the matching clones. A pointer inside an object
+			 * 			already cloned, such as a pointer to a member of the same object, is remapped into that clone
+			 * 			instead of cloning its target again. Other pointers are remapped
+			 * 			when they point inside a cloned object and copied as is otherwise.
+			 * 			Containers are copy assigned, then the pointers of their elements are fixed in place;
+			 * 			sets and maps keyed by pointers are rebuilt with a reserved capacity instead.
+			 * 			Limitation : only the objects and the scratch copies of a rebuild come from the arena. The buffers of
+			 * 			the cloned containers and strings are allocated by their own allocator (the global heap for the std
+			 * 			containers) when they are copied, and freed by the object destructors the arena runs.
+			 * 			Every object is released together with the arena (Arena::Reset or its destructor).
+			 * @param	source The address of the instance to clone.
+			 * @param	arena  The arena the clones are allocated from.
+			 * @return	void* The address of the clone, or nullptr if the type cannot be constructed.
+			 */
+			void* Clone(const void* source, Arena& arena) const;
+
+		public :
+			/**
+			 * @brief	Checks if the instances of this type track their reflected writes (GENERATE_TRACKED).
+			 */
+			bool IsTracked() const;
+
+			/**
+			 * @brief	Gets the dirty mask of an instance of this type.
+			 * @param	instance The address of an instance of this type (not of a derived type).
+			 * @return	PropertyMask* The mask of the properties written since the last ConsumeDirty, or nullptr if the type is not tracked.
+			 */
+			PropertyMask* GetDirtyMask(void* instance) const;
+
+			/**
+			 * @brief	Moves the dirty mask of an instance into the output mask and clears it.
+			 * @details	The output keeps its storage, so consuming every frame does not allocate.
+			 * @param	instance The address of an instance of this type.
+			 * @param	dirty    The mask receiving the ordinals written since the last call.
+			 * @return	bool True if any property was written.
+			 */
+			bool ConsumeDirty(void* instance, PropertyMask& dirty) const;
+
+			/**
+			 * @brief	Observes the reflected writes of every property of this type, on instances of this type or derived types.
+			 * @details	Notifications are delivered in batches by ObserverManager::Flush.
+			 * @return	size_t The handle to pass to Unsubscribe.
+			 */
+			size_t Subscribe(std::function<void(const PropertyChange* changes, size_t count)> observer) const;
+			void Unsubscribe(size_t handle) const;
+
 		private:
 			/**
 			 * @brief	Registers the TypeInfo instance with the global TypeManager.
@@ -175,14 +770,132 @@ namespace Reflection
 			 */
 			void Regist();
 
+			static uint32_t AllocateTypeId();
+
+			template<typename T>
+			static constexpr Primitive GetPrimitive()
+			{
+				if constexpr (Utils::IsSame<T, bool>::value)
+				{
+					return Primitive::Bool;
+				}
+				else if constexpr (std::is_integral<T>::value)
+				{
+					constexpr bool isSigned = std::is_signed<T>::value;
+
+					if constexpr (1 == sizeof(T))
+					{
+						return isSigned ? Primitive::Int8 : Primitive::UInt8;
+					}
+					else if constexpr (2 == sizeof(T))
+					{
+						return isSigned ? Primitive::Int16 : Primitive::UInt16;
+					}
+					else if constexpr (4 == sizeof(T))
+					{
+						return isSigned ? Primitive::Int32 : Primitive::UInt32;
+					}
+					else
+					{
+						return isSigned ? Primitive::Int64 : Primitive::UInt64;
+					}
+				}
+				else if constexpr (Utils::IsSame<T, float>::value)
+				{
+					return Primitive::Float;
+				}
+				else if constexpr (Utils::IsSame<T, double>::value)
+				{
+					return Primitive::Double;
+				}
+				else if constexpr (Utils::IsSame<T, std::string>::value)
+				{
+					return Primitive::String;
+				}
+				else if constexpr (Utils::IsSame<T, std::string_view>::value)
+				{
+					return Primitive::StringView;
+				}
+				else if constexpr (std::is_enum<T>::value)
+				{
+					return GetPrimitive<std::underlying_type_t<T>>();
+				}
+				else
+				{
+					return Primitive::None;
+				}
+			}
+
+			void BuildAncestors();
+
+			/**
+			 * @brief	Inherits the properties and methods of the reflected bases.
+			 * @details	The primary base shares the address of the instance, so its properties and methods are inherited as is.
+			 * 			The properties of the other bases are copied with their offsets shifted by the offset of the base, and
+			 * 			owned by this type. Their methods are not inherited, as the call would need the adjusted instance.
+			 * 			A primary base not at offset 0 (a non-polymorphic base listed before a polymorphic one, or after an
+			 * 			unreflected one) would misplace every inherited property, so the registration is aborted, in every build.
+			 */
+			void InheritBases();
+			const Ancestor* FindAncestor(const TypeInfo* baseType) const;
+
+			void BuildLayout() const;
+			void BuildFlagLists() const;
+			PropertyRange GetFlagList(PropertyFlag flag, size_t side) const;
+			void BuildFields() const;
+			uint64_t ComputeFingerprint(std::vector<const TypeInfo*>& visiting) const;
+
+			bool EqualsValue(const void* lhs, const void* rhs) const;
+			size_t HashValue(const void* instance, size_t seed) const;
+
 		private :
 			PropertyMap			m_properties;
+			PropertyList		m_propertyList;
 			MethodMap			m_methods;
 
-			const std::string	m_typeName;
+			// The shifted copies of the properties of the secondary bases, deleted with the type.
+			std::vector<const PropertyInfo*>	m_rebasedProperties;
+
+			const std::string_view	m_typeName;
 			const size_t		m_typeHash;
+			const uint32_t		m_typeId;
 			const TypeInfo*		m_superType;
+			const BaseList		m_baseTypes;
+			AncestorList		m_ancestors;
 			const TypeInfo*		m_pureType;
+			// The target of a relative pointer, folded into its layout fingerprint.
+			const TypeInfo*		m_pointeeType;
+
+			const size_t		m_typeSize;
+			const size_t		m_typeAlignment;
+			const bool			m_isTriviallyCopyable;
+			const bool			m_isPointer;
+			const bool			m_isPolymorphic;
+			const Primitive		m_primitive;
+
+			EqualFunc			m_equalFunc;
+			HashFunc			m_hashFunc;
+			ConstructFunc		m_constructFunc;
+			DestructFunc		m_destructFunc;
+			CopyConstructFunc	m_copyConstructFunc;
+			CopyAssignFunc		m_copyAssignFunc;
+			RelocateFunc		m_relocateFunc;
+			RuntimeTypeFunc		m_runtimeTypeFunc;
+			DirtyMaskFunc		m_dirtyMaskFunc;
+			const EnumInfo*		m_enumInfo;
+			const ContainerPropertyInfo*	m_container;
+
+			mutable std::once_flag	m_layoutFlag;
+			mutable SegmentList		m_segments;
+			mutable ReferenceList	m_references;
+			mutable FieldList		m_fields;
+			mutable std::vector<size_t>	m_fieldIndices;
+			mutable std::atomic<uint64_t>	m_layoutFingerprint;
+
+			// The properties with flag i are [m_flagOffsets[2i], m_flagOffsets[2i + 1]), the ones without it follow.
+			mutable std::once_flag	m_flagListFlag;
+			mutable PropertyList	m_flagProperties;
+			mutable std::array<size_t, PropertyFlagCount * 2 + 1>	m_flagOffsets;
 	};
 };
 
@@ -3,6 +3,13 @@
 
 #include "Macro.h"
 #include "Type/TypeInfo.h"
+#include "Property/PropertyMask.h"
+
+namespace Reflection
+{
+	template<typename T>
+	struct StaticPropertyList;
+};
 
 /**
  * @def		GENERATE( Class )
@@ -18,11 +25,21 @@
  * 				enabling retrieval of the correct child `TypeInfo` even from a `BasePtr`.
  * 			4. **Automatic Registration**: Instantiates a static `s_typeInfo` variable, 
  * 				forcing the class to be registered with the `TypeManager` at **Static Initialization Time**.
+ * 			5. **Static Property List**: Seeds the compile-time property counter used by the `PROPERTY` macro, 
+ * 				and befriends `StaticPropertyList` so private properties can be visited by `ForEachProperty`.
+ * 			A class with several reflected bases lists them after its name, e.g. GENERATE(Turret, Actor, IDamageable).
+ * 			The first one is the SuperType, whose properties and methods are inherited. The properties of the other bases
+ * 			are inherited too, shifted to their subobjects, but not their methods. Every listed base is recorded
+ * 			with the offset of its subobject, so Reflection::Cast adjusts the pointer to the other bases.
+ * 			The SuperType must be at offset 0 in the class (checked at registration in every build, which aborts otherwise),
+ * 			so an unreflected or non-polymorphic base cannot come before it. Virtual bases are not supported and fail to compile.
  * @param	Class The name of the current class (e.g., Monster).
+ * @param	...   The reflected bases of the class, if it has more than one.
  */
-#define GENERATE( Class ) \
+#define GENERATE( Class, ... ) \
 	public : \
-		using SuperType = typename Reflection::Utils::TypeDetector<Class>::Type; \
+		using BaseTypes = Reflection::Utils::TypeList<__VA_ARGS__>; \
+		using SuperType = typename Reflection::Utils::SuperDetector<Class, BaseTypes>::Type; \
 		using ThisType = Class; \
 \
 		static const Reflection::TypeInfo* GetStaticTypeInfo() \
@@ -35,8 +52,68 @@
 		{ \
 			return GetStaticTypeInfo(); \
 		} \
+\
+		static Reflection::Utils::Counter<0> StaticPropertyCounter(Reflection::Utils::Rank<0>); \
+\
+		template<typename> \
+		friend struct Reflection::StaticPropertyList; \
+\
+	private : \
+		static inline const Reflection::TypeInfo* s_typeInfo __STATIC_USED__ = GetStaticTypeInfo();\
+
+/**
+ * @def		GENERATE_POD( Class )
+ * @brief	GENERATE for types that must stay trivially copyable, such as the objects of a MappedArchive.
+ * @details	GetTypeInfo() is not virtual, so the type gets no vtable and its bytes can be copied or mapped from a file.
+ * 			GetTypeInfo() always returns the static type, even through a base pointer.
+ * @param	Class The name of the current class.
+ */
+#define GENERATE_POD( Class ) \
+	public : \
+		using BaseTypes = Reflection::Utils::TypeList<>; \
+		using SuperType = typename Reflection::Utils::TypeDetector<Class>::Type; \
+		using ThisType = Class; \
+\
+		static const Reflection::TypeInfo* GetStaticTypeInfo() \
+		{ \
+			static const Reflection::TypeInfo* typeInfo = Reflection::TypeInfo::Get<Class>(); \
+			return typeInfo; \
+		} \
+\
+		const Reflection::TypeInfo* GetTypeInfo() const \
+		{ \
+			return GetStaticTypeInfo(); \
+		} \
+\
+		static Reflection::Utils::Counter<0> StaticPropertyCounter(Reflection::Utils::Rank<0>); \
+\
+		template<typename> \
+		friend struct Reflection::StaticPropertyList; \
 \
 	private : \
 		static inline const Reflection::TypeInfo* s_typeInfo __STATIC_USED__ = GetStaticTypeInfo();\
 
+/**
+ * @def		GENERATE_TRACKED( Class )
+ * @brief	GENERATE with per-instance dirty tracking of the reflected writes.
+ * @details	Adds a PropertyMask member holding the ordinals of the properties written through
+ * 			PropertyInfo::Set / SetRaw since the last Reflection::ConsumeDirty call.
+ * 			Derived classes inherit the tracking, so it should be declared once, at the root of the hierarchy :
+ * 			only the properties declared by tracked classes are tracked, so the writes to the properties of an
+ * 			untracked base stay free on the instances of that base. Types declared with the plain GENERATE pay no tracking cost.
+ * 			Threads may write different properties of one object concurrently (the first PropertyMask::InlineBits are
+ * 			set atomically), but ConsumeDirty must not run concurrently with the writers.
+ * @param	Class The name of the current class.
+ * @param	...   The reflected bases of the class, as for GENERATE.
+ */
+#define GENERATE_TRACKED( Class, ... ) \
+	GENERATE( Class, __VA_ARGS__ ) \
+\
+	public : \
+		Reflection::PropertyMask& GetDirtyMask() { return m_reflectionDirtyMask; } \
+		const Reflection::PropertyMask& GetDirtyMask() const { return m_reflectionDirtyMask; } \
+\
+	private : \
+		Reflection::PropertyMask m_reflectionDirtyMask; \
+
 #endif // __REFLECTIONTYPE_MACRO_H__
\ No newline at end of file
@@ -1,8 +1,17 @@
 #ifndef __REFLECTION_TYPEMANAGER_H__
 #define __REFLECTION_TYPEMANAGER_H__
 
-#include <unordered_map>
+#include <atomic>
+#include <cstdint>
 #include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "NameTable.h"
+#include "Type/MemoryStats.h"
+#include "Type/TypeStats.h"
 
 namespace Reflection
 {
@@ -12,11 +21,124 @@ namespace Reflection
 	 * @class	TypeManager
 	 * @brief	Singleton class that manages type registrations and retrievals in the reflection system.
 	 * 			Provides functionality to register types and access their TypeInfo instances.
+	 * @details	Types are registered into modules. The types of the program belong to MainModule; the types of a plugin
+	 * 			are registered inside a ModuleScope around the loading of the plugin, and removed in one batch by
+	 * 			UnregistModule before it is unloaded.
+	 * 			Lookups read an immutable snapshot of the registry without locking. A change publishes a new snapshot,
+	 * 			rebuilt lazily after registrations so that the static initialization registers each type in constant time.
+	 * 			Readers announce the epoch they entered with a ReadGuard; unregistration waits until every reader
+	 * 			that may still see the removed types has left, then reclaims the old snapshots, so a reader holding a
+	 * 			ReadGuard never sees freed metadata.
 	 */
 	class TypeManager
 	{
-		private : 
+		public :
 			using TypeMap = std::unordered_map<size_t, const TypeInfo*>;
+			using NameMap = NameTable<TypeInfo>;
+			using ModuleId = uint32_t;
+
+			/**
+			 * @brief	Called with every type of an unregistered batch, once no reader can see it, to drop the caches keyed by it.
+			 */
+			using UnregistFunc = void(*)(const TypeInfo* typeInfo);
+
+			static constexpr ModuleId MainModule = 0;
+
+			/**
+			 * @class	ModuleScope
+			 * @brief	Attributes the types registered by the calling thread to a module while it is alive.
+			 * @details	Wrap the loading of a plugin (dlopen / LoadLibrary) with it, so the types registered by its static
+			 * 			initialization are unregistered together. Scopes nest.
+			 */
+			class ModuleScope
+			{
+				public :
+					explicit ModuleScope(ModuleId module);
+					~ModuleScope();
+
+					ModuleScope(const ModuleScope&) = delete;
+					ModuleScope& operator=(const ModuleScope&) = delete;
+
+				private :
+					ModuleId m_previous;
+			};
+
+			/**
+			 * @class	ReadGuard
+			 * @brief	Keeps the metadata reached through the registry alive while it is alive.
+			 * @details	Entering costs a thread-local access and an atomic store. Guards nest. The TypeInfo pointers found while
+			 * 			holding a guard must not be used after it is released if their module may be unregistered meanwhile;
+			 * 			the types of MainModule are never reclaimed.
+			 */
+			class ReadGuard
+			{
+				public :
+					ReadGuard();
+					~ReadGuard();
+
+					ReadGuard(const ReadGuard&) = delete;
+					ReadGuard& operator=(const ReadGuard&) = delete;
+			};
+
+			/**
+			 * @class	TypeMapView
+			 * @brief	The map of the registered types, kept alive by the ReadGuard the view holds.
+			 * @details	Returned by GetTypeMap. Later registrations publish new snapshots without freeing this one, and
+			 * 			unregistrations wait for the view to be released. Keep it on the thread that created it.
+			 */
+			class TypeMapView
+			{
+				public :
+					explicit TypeMapView(const TypeManager& typeManager);
+
+					TypeMapView(const TypeMapView&) = delete;
+					TypeMapView& operator=(const TypeMapView&) = delete;
+
+				public :
+					TypeMap::const_iterator begin() const { return m_types.begin(); }
+					TypeMap::const_iterator end() const { return m_types.end(); }
+					size_t size() const { return m_types.size(); }
+					bool empty() const { return m_types.empty(); }
+
+					const TypeMap& GetTypes() const { return m_types; }
+
+				private :
+					ReadGuard m_guard;
+					const TypeMap& m_types;
+			};
+
+		private :
+			struct Snapshot
+			{
+				TypeMap types;
+				NameMap names;
+				uint64_t generation;
+			};
+
+			struct Retired
+			{
+				const Snapshot* snapshot;
+				uint64_t epoch;
+			};
+
+			struct Registration
+			{
+				const TypeInfo* type;
+				ModuleId module;
+			};
+
+			struct Module
+			{
+				std::string name;
+				std::vector<const TypeInfo*> types;
+			};
+
+			struct alignas(64) ReaderRecord
+			{
+				std::atomic<uint64_t> epoch;
+				std::atomic<bool> isUsed;
+				ReaderRecord* next;
+			};
 
 			TypeManager();
 			~TypeManager();
@@ -26,20 +148,123 @@ namespace Reflection
 
 		public:
 			/**
-			 * @brief	Regist some type info.
+			 * @brief	Regist some type info, in the module of the calling thread's ModuleScope if any.
 			 * @param	The type info's pointer
 			 */
 			void Regist(const TypeInfo* typeInfo);
 
+			/**
+			 * @brief	Removes a type, then waits until no reader can see it.
+			 * @details	Must not be called while the calling thread holds a ReadGuard.
+			 */
+			void Unregist(const TypeInfo* typeInfo);
+
+			/**
+			 * @brief	Creates a module to register the types of a plugin into.
+			 * @param	name The name of the module, for diagnostics.
+			 * @return	ModuleId The identifier of the module, which can be reused after UnregistModule to reload the plugin.
+			 */
+			ModuleId CreateModule(const std::string& name);
+
+			/**
+			 * @brief	Removes every type of a module in one batch, then waits until no reader can see them.
+			 * @details	Once it returns, the module can be unloaded. Must not be called while the calling thread holds a ReadGuard.
+			 * @return	size_t The number of removed types.
+			 */
+			size_t UnregistModule(ModuleId module);
+
+			/**
+			 * @brief	Gets the module a type is registered in, MainModule for the unregistered types.
+			 */
+			ModuleId GetModule(const TypeInfo* typeInfo) const;
+
+			/**
+			 * @brief	Registers a function called for the types removed by Unregist and UnregistModule.
+			 */
+			void AddUnregistListener(UnregistFunc listener);
+
 			/**
 			 * @brief	Get the type info's that registed this instance.
-			 * @return	The type info's map
+			 * @details	The map is the current snapshot, valid as long as the returned view is alive.
+			 * @return	TypeMapView The type info's map
+			 */
+			TypeMapView GetTypeMap() const;
+
+			/**
+			 * @brief	Finds a registered type by name, nullptr if there is none.
+			 * @details	The lookup holds a ReadGuard. Hold one around the call as well to keep using the type if its module
+			 * 			may be unregistered meanwhile.
+			 */
+			const TypeInfo* FindType(std::string_view name) const;
+
+			/**
+			 * @brief	Finds a registered type by hash, nullptr if there is none.
+			 * @details	The lookup holds a ReadGuard, like FindType by name.
+			 */
+			const TypeInfo* FindType(size_t typeHash) const;
+
+			/**
+			 * @brief	Gets the generation of the registry, incremented whenever the set of registered types changes.
+			 * @details	Caches derived from the registry can compare it to rebuild themselves. The read holds a ReadGuard.
+			 */
+			uint64_t GetGeneration() const;
+
+			/**
+			 * @brief	Takes a snapshot of the reflection counters of every thread.
+			 * @details	The counters are only compiled in with REFLECTION_STATS (TypeStats::IsEnabled()); otherwise the snapshot is all zeros.
+			 * @return	TypeStats The counts since the start of the program or the last ResetStats.
+			 */
+			TypeStats GetStats() const;
+
+			/**
+			 * @brief	Restarts the reflection counters from zero and forgets the missed names.
+			 */
+			void ResetStats();
+
+			/**
+			 * @brief	Measures the memory held by the metadata of every registered type and by the name pool.
+			 * @details	Walks the registry, so it costs a pass over every type, property and method. Call it while
+			 * 			no other thread registers types, since the lazily built caches of the types are read.
+			 * @return	MemoryStats The counts and bytes.
 			 */
-			const TypeMap& GetTypeMap() const;
+			MemoryStats GetMemoryStats() const;
 
 		private :
-			TypeMap m_typeMap;
-			std::mutex m_mutex;
+			const Snapshot* GetSnapshot() const;
+
+			/**
+			 * @brief	Publishes a snapshot of the registrations and retires the previous one. Called with the mutex locked.
+			 */
+			void Publish() const;
+
+			/**
+			 * @brief	Frees the retired snapshots that no reader entered early enough to see. Called with the mutex locked.
+			 * @details	Does not wait, so the snapshots retired by registrations are reclaimed without an unregistration.
+			 */
+			void Reclaim() const;
+
+			/**
+			 * @brief	Waits until every reader has entered an epoch after the last publication, then frees the retired snapshots.
+			 */
+			void Synchronize(std::vector<const TypeInfo*>& removed);
+
+			void EnterRead();
+			void ExitRead();
+
+		private :
+			std::unordered_map<size_t, Registration> m_registrations;
+			std::vector<Module> m_modules;
+			std::vector<UnregistFunc> m_listeners;
+
+			mutable std::atomic<const Snapshot*> m_snapshot;
+			mutable std::atomic<bool> m_isDirty;
+			mutable std::vector<Retired> m_retired;
+			mutable uint64_t m_generation;
+			mutable std::mutex m_mutex;
+
+			mutable std::atomic<uint64_t> m_epoch;
+			std::atomic<ReaderRecord*> m_readers;
+			std::mutex m_synchronizeMutex;
 	};
 };
 
@@ -0,0 +1,116 @@
+#ifndef __REFLECTION_TYPESTATS_H__
+#define __REFLECTION_TYPESTATS_H__
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @def		REFLECTION_COUNT( Event )
+ * @brief	Counts an event of the reflection hot paths, on the counters of the calling thread.
+ * @details	Compiled only when REFLECTION_STATS is defined (CMake option REFLECTION_STATS),
+ * 			otherwise the macro expands to nothing and the instrumented code is unchanged.
+ * @param	Event The name of a TypeStats::Counter value.
+ */
+/**
+ * @def		REFLECTION_COUNT_MISS( Event, Name )
+ * @brief	REFLECTION_COUNT for failed name lookups, also recording the name that failed to resolve.
+ */
+#if defined(REFLECTION_STATS)
+	#define REFLECTION_COUNT( Event ) ::Reflection::TypeStats::Increment(::Reflection::TypeStats::Counter::Event)
+	#define REFLECTION_COUNT_MISS( Event, Name ) ::Reflection::TypeStats::RecordMiss(::Reflection::TypeStats::Counter::Event, Name)
+#else
+	#define REFLECTION_COUNT( Event ) ((void)0)
+	#define REFLECTION_COUNT_MISS( Event, Name ) ((void)0)
+#endif
+
+namespace Reflection
+{
+	/**
+	 * @class	TypeStats
+	 * @brief	A snapshot of the reflection counters, taken by TypeManager::GetStats.
+	 * @details	Every thread counts into its own block, written without atomic read-modify-write operations,
+	 * 			so counting does not contend between threads. The blocks of exited threads are folded into a shared total.
+	 * 			Only the first MaxMissedNames distinct missed names are recorded; later ones are still counted.
+	 */
+	class TypeStats
+	{
+		public :
+			enum class Counter : uint8_t
+			{
+				PropertyLookupHit,
+				PropertyLookupMiss,
+				MethodLookupHit,
+				MethodLookupMiss,
+				CastSuccess,
+				CastFailure,
+				GetTypeMismatch,
+				SetTypeMismatch,
+				InvokeFailure,
+
+				Count,
+			};
+
+			static constexpr size_t CounterCount = static_cast<size_t>(Counter::Count);
+			static constexpr size_t MaxMissedNames = 64;
+
+			using CounterArray = std::array<uint64_t, CounterCount>;
+			using MissedNameList = std::vector<std::pair<std::string, uint64_t>>;
+
+		public :
+			TypeStats();
+			TypeStats(const CounterArray& counters, MissedNameList missedNames);
+
+		public :
+			/**
+			 * @brief	Checks if the counters are compiled in (REFLECTION_STATS).
+			 */
+			static constexpr bool IsEnabled()
+			{
+#if defined(REFLECTION_STATS)
+				return true;
+#else
+				return false;
+#endif
+			}
+
+			/**
+			 * @brief	[Internal Use Only] Adds one to a counter of the calling thread. Use REFLECTION_COUNT.
+			 */
+			static void Increment(Counter counter);
+
+			/**
+			 * @brief	[Internal Use Only] Counts a failed lookup and records its name. Use REFLECTION_COUNT_MISS.
+			 */
+			static void RecordMiss(Counter counter, const std::string& name);
+
+			static const char* GetCounterName(Counter counter);
+
+			/**
+			 * @brief	[Internal Use Only] Sums the counters of every thread since the last Reset. Use TypeManager::GetStats.
+			 */
+			static TypeStats Capture();
+
+			/**
+			 * @brief	[Internal Use Only] Restarts the counters from zero. Use TypeManager::ResetStats.
+			 */
+			static void Reset();
+
+		public :
+			uint64_t Get(Counter counter) const;
+			const CounterArray& GetCounters() const;
+
+			/**
+			 * @brief	Gets the names that failed to resolve with their number of misses, most missed first.
+			 */
+			const MissedNameList& GetMissedNames() const;
+
+		private :
+			CounterArray m_counters;
+			MissedNameList m_missedNames;
+	};
+};
+
+#endif // __REFLECTION_TYPESTATS_H__
\ No newline at end of file
@@ -0,0 +1,374 @@
+#ifndef __REFLECTION_TYPESWITCH_H__
+#define __REFLECTION_TYPESWITCH_H__
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Utils.h"
+#include "Type/TypeInfo.h"
+
+namespace Reflection
+{
+	/**
+	 * @brief	Picks the handler of a single dispatch for an object of type runtimeType seen as a sourceType.
+	 * @details	A target matches when the object has a unique subobject of that type. The first match
+	 * 			that no other match derives from wins, so the most derived handler is chosen whatever the order.
+	 * @param	runtimeType The dynamic type of the object.
+	 * @param	sourceType  The static type of the pointer.
+	 * @param	targets     The parameter types of the handlers.
+	 * @param	count       The number of handlers.
+	 * @param	offset      Receives the adjustment from the sourceType pointer to the chosen target.
+	 * @return	size_t The index of the chosen handler, or count if none matches.
+	 */
+	size_t ResolveDispatch(const TypeInfo* runtimeType, const TypeInfo* sourceType, const TypeInfo* const* targets, size_t count, ptrdiff_t& offset);
+
+	/**
+	 * @brief	Picks the handler of a double dispatch for a pair of objects.
+	 * @details	A handler matches when both objects match its parameter types. The first match wins that no other match
+	 * 			is at least as derived on both sides and more derived on one.
+	 * @return	size_t The index of the chosen handler, or count if none matches.
+	 */
+	size_t ResolvePairDispatch(const TypeInfo* lhsType, const TypeInfo* lhsSource, const TypeInfo* rhsType, const TypeInfo* rhsSource,
+							const TypeInfo* const* lhsTargets, const TypeInfo* const* rhsTargets, size_t count,
+							ptrdiff_t& lhsOffset, ptrdiff_t& rhsOffset);
+
+	/**
+	 * @class	DispatchTable
+	 * @brief	The jump table of a set of handler types, indexed by the dense identifier of the dynamic type.
+	 * @details	Each entry packs the handler index and the pointer adjustment in one word, resolved by ResolveDispatch
+	 * 			the first time a type is seen. Readers load the table and the entry without locks. When new types
+	 * 			appear the table grows under a mutex; older blocks are kept until the table is destroyed,
+	 * 			so a reader holding one stays valid.
+	 */
+	class DispatchTable
+	{
+		private :
+			struct Block
+			{
+				size_t capacity;
+				std::unique_ptr<std::atomic<uint64_t>[]> entries;
+			};
+
+		public :
+			DispatchTable(const TypeInfo* sourceType, const TypeInfo* const* targets, size_t count);
+			~DispatchTable();
+
+			DispatchTable(const DispatchTable&) = delete;
+			DispatchTable& operator=(const DispatchTable&) = delete;
+
+		public :
+			/**
+			 * @brief	Gets the handler of an object of type runtimeType.
+			 * @param	runtimeType The dynamic type of the object.
+			 * @param	offset      Receives the adjustment from the source pointer to the handler parameter.
+			 * @return	size_t The index of the handler, or the handler count if none matches.
+			 */
+			size_t Find(const TypeInfo* runtimeType, ptrdiff_t& offset)
+			{
+				const uint32_t typeId = runtimeType->GetTypeId();
+				const Block* block = m_block.load(std::memory_order_acquire);
+
+				if (typeId < block->capacity)
+				{
+					const uint64_t entry = block->entries[typeId].load(std::memory_order_relaxed);
+					if (0 != entry)
+					{
+						offset = static_cast<ptrdiff_t>(static_cast<int64_t>(entry) >> 16);
+						return static_cast<size_t>(entry & 0xFFFF) - 1;
+					}
+				}
+
+				return FindSlow(runtimeType, offset);
+			}
+
+		private :
+			size_t FindSlow(const TypeInfo* runtimeType, ptrdiff_t& offset);
+
+		private :
+			const TypeInfo* m_sourceType;
+			const TypeInfo* const* m_targets;
+			const size_t m_count;
+
+			std::atomic<const Block*> m_block;
+			std::vector<std::unique_ptr<Block>> m_blocks;
+			std::mutex m_growMutex;
+	};
+
+	/**
+	 * @class	PairDispatchTable
+	 * @brief	The table of a double dispatch, keyed by the identifiers of both dynamic types.
+	 * @details	Built like the CastCache : a key word and an answer word per slot, claimed with a compare-and-swap
+	 * 			and published with a release store, read without locks. Pairs that do not fit the table, or whose
+	 * 			offsets do not fit an answer word, are resolved on every call.
+	 */
+	class PairDispatchTable
+	{
+		public :
+			static constexpr size_t Capacity = 1 << 10;
+			static constexpr size_t MaxProbe = 8;
+
+		private :
+			struct Entry
+			{
+				std::atomic<uint64_t> key;
+				std::atomic<uint64_t> answer;
+			};
+
+		public :
+			PairDispatchTable(const TypeInfo* lhsSource, const TypeInfo* rhsSource, const TypeInfo* const* lhsTargets, const TypeInfo* const* rhsTargets, size_t count);
+			~PairDispatchTable();
+
+			PairDispatchTable(const PairDispatchTable&) = delete;
+			PairDispatchTable& operator=(const PairDispatchTable&) = delete;
+
+		public :
+			/**
+			 * @brief	Gets the handler of a pair of objects.
+			 * @return	size_t The index of the handler, or the handler count if none matches.
+			 */
+			size_t Find(const TypeInfo* lhsType, const TypeInfo* rhsType, ptrdiff_t& lhsOffset, ptrdiff_t& rhsOffset);
+
+		private :
+			size_t Resolve(const TypeInfo* lhsType, const TypeInfo* rhsType, ptrdiff_t& lhsOffset, ptrdiff_t& rhsOffset) const;
+
+		private :
+			const TypeInfo* m_lhsSource;
+			const TypeInfo* m_rhsSource;
+			const TypeInfo* const* m_lhsTargets;
+			const TypeInfo* const* m_rhsTargets;
+			const size_t m_count;
+
+			std::unique_ptr<Entry[]> m_entries;
+	};
+
+	/**
+	 * @brief	The parameter type of a handler, e.g. Turret for [](Turret& turret) {}.
+	 */
+	template<typename Handler, size_t Index = 0>
+	using HandlerTarget = std::remove_cv_t<std::remove_reference_t<typename Utils::CallableTraits<Handler>::template Argument<Index>>>;
+
+	/**
+	 * @brief	Gets the shared DispatchTable of a source type and a list of handler types.
+	 */
+	template<typename Source, typename... Targets>
+	DispatchTable& GetDispatchTable()
+	{
+		static const TypeInfo* const targets[] = { TypeInfo::Get<Targets>()... };
+		static DispatchTable table(TypeInfo::Get<Source>(), targets, sizeof...(Targets));
+
+		return table;
+	}
+
+	/**
+	 * @brief	Gets the shared PairDispatchTable of two source types and a list of handler parameter pairs.
+	 */
+	template<typename LhsSource, typename RhsSource, typename LhsTargets, typename RhsTargets>
+	struct PairDispatch;
+
+	template<typename LhsSource, typename RhsSource, typename... LhsTargets, typename... RhsTargets>
+	struct PairDispatch<LhsSource, RhsSource, Utils::TypeList<LhsTargets...>, Utils::TypeList<RhsTargets...>>
+	{
+		static PairDispatchTable& GetTable()
+		{
+			static const TypeInfo* const lhsTargets[] = { TypeInfo::Get<LhsTargets>()... };
+			static const TypeInfo* const rhsTargets[] = { TypeInfo::Get<RhsTargets>()... };
+			static PairDispatchTable table(TypeInfo::Get<LhsSource>(), TypeInfo::Get<RhsSource>(), lhsTargets, rhsTargets, sizeof...(LhsTargets));
+
+			return table;
+		}
+	};
+
+	/**
+	 * @class	TypeSwitch
+	 * @brief	Calls the handler matching the dynamic type of an object, replacing chains of Reflection::Cast.
+	 * @details	Each handler takes a reference to a reflected type, e.g. [](Turret& turret) {}. The most derived
+	 * 			handler the object converts to is called with the adjusted reference, so a handler for a base type
+	 * 			serves as a fallback. The choice is made once per dynamic type in a DispatchTable shared by every
+	 * 			switch with the same source and handler types; afterwards a dispatch is one table read and one
+	 * 			indirect call. Handlers are called through a const reference.
+	 * @tparam	Handlers The handler types.
+	 */
+	template<typename... Handlers>
+	class TypeSwitch
+	{
+		static_assert(0 < sizeof...(Handlers), "Reflection::TypeSwitch : At least one handler is required.");
+		static_assert((... && (1 == Utils::CallableTraits<Handlers>::arity)), "Reflection::TypeSwitch : Every handler takes one parameter.");
+		static_assert((... && std::is_reference<typename Utils::CallableTraits<Handlers>::template Argument<0>>::value),
+					"Reflection::TypeSwitch : Every handler takes its parameter by reference.");
+
+		private :
+			using HandlerTuple = std::tuple<Handlers...>;
+			using Thunk = void(*)(const HandlerTuple& handlers, void* address);
+
+		public :
+			explicit TypeSwitch(Handlers... handlers)
+				: m_handlers(std::move(handlers)...)
+			{}
+
+		public :
+			/**
+			 * @brief	Calls the handler matching the dynamic type of an object.
+			 * @tparam	Source The static type of the object, a reflected type. If const, the handlers must take const references.
+			 * @param	object The object, which may be nullptr.
+			 * @return	bool False if the object is nullptr or no handler matches.
+			 */
+			template<typename Source>
+			bool operator()(Source* object) const
+			{
+				static_assert(!Utils::IsConst<Source>::value || (... && std::is_const<std::remove_reference_t<typename Utils::CallableTraits<Handlers>::template Argument<0>>>::value),
+							"Reflection::TypeSwitch : A const object needs handlers taking const references.");
+
+				if (nullptr == object)
+				{
+					return false;
+				}
+
+				DispatchTable& table = GetDispatchTable<Utils::RemoveConst_t<Source>, HandlerTarget<Handlers>...>();
+
+				ptrdiff_t offset = 0;
+				const size_t index = table.Find(object->GetTypeInfo(), offset);
+
+				if (sizeof...(Handlers) <= index)
+				{
+					return false;
+				}
+
+				void* address = const_cast<char*>(reinterpret_cast<const char*>(object)) + offset;
+				GetThunks(std::index_sequence_for<Handlers...>())[index](m_handlers, address);
+
+				return true;
+			}
+
+		private :
+			template<size_t Index>
+			static void Call(const HandlerTuple& handlers, void* address)
+			{
+				using Parameter = std::remove_reference_t<typename Utils::CallableTraits<std::tuple_element_t<Index, HandlerTuple>>::template Argument<0>>;
+				std::get<Index>(handlers)(*static_cast<Parameter*>(address));
+			}
+
+			template<size_t... Indices>
+			static const Thunk* GetThunks(std::index_sequence<Indices...>)
+			{
+				static constexpr Thunk thunks[] = { &Call<Indices>... };
+				return thunks;
+			}
+
+		private :
+			HandlerTuple m_handlers;
+	};
+
+	/**
+	 * @class	PairTypeSwitch
+	 * @brief	Double dispatch : calls the handler matching the dynamic types of two objects,
+	 * 			e.g. [](Ship& ship, Asteroid& asteroid) {} for a collision matrix.
+	 * @details	The handler is chosen once per pair of dynamic types in a PairDispatchTable (see ResolvePairDispatch).
+	 * 			Handlers are not symmetric : a (Ship, Asteroid) handler does not match an (Asteroid, Ship) pair.
+	 * @tparam	Handlers The handler types, each taking two references.
+	 */
+	template<typename... Handlers>
+	class PairTypeSwitch
+	{
+		static_assert(0 < sizeof...(Handlers), "Reflection::PairTypeSwitch : At least one handler is required.");
+		static_assert((... && (2 == Utils::CallableTraits<Handlers>::arity)), "Reflection::PairTypeSwitch : Every handler takes two parameters.");
+		static_assert((... && (std::is_reference<typename Utils::CallableTraits<Handlers>::template Argument<0>>::value
+							&& std::is_reference<typename Utils::CallableTraits<Handlers>::template Argument<1>>::value)),
+					"Reflection::PairTypeSwitch : Every handler takes its parameters by reference.");
+
+		private :
+			using HandlerTuple = std::tuple<Handlers...>;
+			using Thunk = void(*)(const HandlerTuple& handlers, void* lhs, void* rhs);
+
+		public :
+			explicit PairTypeSwitch(Handlers... handlers)
+				: m_handlers(std::move(handlers)...)
+			{}
+
+		public :
+			/**
+			 * @brief	Calls the handler matching the dynamic types of both objects.
+			 * @return	bool False if an object is nullptr or no handler matches.
+			 */
+			template<typename LhsSource, typename RhsSource>
+			bool operator()(LhsSource* lhs, RhsSource* rhs) const
+			{
+				static_assert(!Utils::IsConst<LhsSource>::value || (... && std::is_const<std::remove_reference_t<typename Utils::CallableTraits<Handlers>::template Argument<0>>>::value),
+							"Reflection::PairTypeSwitch : A const object needs handlers taking const references.");
+				static_assert(!Utils::IsConst<RhsSource>::value || (... && std::is_const<std::remove_reference_t<typename Utils::CallableTraits<Handlers>::template Argument<1>>>::value),
+							"Reflection::PairTypeSwitch : A const object needs handlers taking const references.");
+
+				if ((nullptr == lhs) || (nullptr == rhs))
+				{
+					return false;
+				}
+
+				using Dispatch = PairDispatch<Utils::RemoveConst_t<LhsSource>, Utils::RemoveConst_t<RhsSource>,
+											Utils::TypeList<HandlerTarget<Handlers, 0>...>, Utils::TypeList<HandlerTarget<Handlers, 1>...>>;
+
+				ptrdiff_t lhsOffset = 0;
+				ptrdiff_t rhsOffset = 0;
+				const size_t index = Dispatch::GetTable().Find(lhs->GetTypeInfo(), rhs->GetTypeInfo(), lhsOffset, rhsOffset);
+
+				if (sizeof...(Handlers) <= index)
+				{
+					return false;
+				}
+
+				void* lhsAddress = const_cast<char*>(reinterpret_cast<const char*>(lhs)) + lhsOffset;
+				void* rhsAddress = const_cast<char*>(reinterpret_cast<const char*>(rhs)) + rhsOffset;
+				GetThunks(std::index_sequence_for<Handlers...>())[index](m_handlers, lhsAddress, rhsAddress);
+
+				return true;
+			}
+
+		private :
+			template<size_t Index>
+			static void Call(const HandlerTuple& handlers, void* lhs, void* rhs)
+			{
+				using Traits = Utils::CallableTraits<std::tuple_element_t<Index, HandlerTuple>>;
+				using LhsParameter = std::remove_reference_t<typename Traits::template Argument<0>>;
+				using RhsParameter = std::remove_reference_t<typename Traits::template Argument<1>>;
+
+				std::get<Index>(handlers)(*static_cast<LhsParameter*>(lhs), *static_cast<RhsParameter*>(rhs));
+			}
+
+			template<size_t... Indices>
+			static const Thunk* GetThunks(std::index_sequence<Indices...>)
+			{
+				static constexpr Thunk thunks[] = { &Call<Indices>... };
+				return thunks;
+			}
+
+		private :
+			HandlerTuple m_handlers;
+	};
+
+	/**
+	 * @brief	Calls the handler matching the dynamic type of an object, see TypeSwitch.
+	 * @return	bool False if the object is nullptr or no handler matches.
+	 */
+	template<typename Source, typename... Handlers>
+	bool Visit(Source* object, Handlers&&... handlers)
+	{
+		return TypeSwitch<std::decay_t<Handlers>...>(std::forward<Handlers>(handlers)...)(object);
+	}
+
+	/**
+	 * @brief	Calls the handler matching the dynamic types of two objects, see PairTypeSwitch.
+	 * @return	bool False if an object is nullptr or no handler matches.
+	 */
+	template<typename LhsSource, typename RhsSource, typename... Handlers>
+	bool VisitPair(LhsSource* lhs, RhsSource* rhs, Handlers&&... handlers)
+	{
+		return PairTypeSwitch<std::decay_t<Handlers>...>(std::forward<Handlers>(handlers)...)(lhs, rhs);
+	}
+};
+
+#endif // __REFLECTION_TYPESWITCH_H__
\ No newline at end of file
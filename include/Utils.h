@@ -2,6 +2,17 @@
 #define __REFLECTION_UTILS_H__
 
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <functional>
+#include <tuple>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 
 namespace Reflection
 {
@@ -84,6 +95,98 @@ namespace Reflection
 			using Type = typename T::ThisType;
 		};
 
+		/**
+		 * @brief	A list of types, such as the reflected bases declared with GENERATE(Class, Bases...).
+		 * @tparam	Types The types of the list.
+		 */
+		template<typename... Types>
+		struct TypeList
+		{
+			static constexpr size_t size = sizeof...(Types);
+		};
+
+		/**
+		 * @brief	Selects the primary reflected base of a class.
+		 * @details	The first declared base when GENERATE lists them, otherwise the reflected base found by TypeDetector.
+		 * 			TypeDetector finds nothing when two bases are reflected, because the lookup of ThisType is ambiguous.
+		 * @tparam	T    The class.
+		 * @tparam	List The TypeList of the declared bases.
+		 */
+		template<typename T, typename List>
+		struct SuperDetector
+		{
+			using Type = typename TypeDetector<T>::Type;
+		};
+
+		template<typename T, typename First, typename... Rest>
+		struct SuperDetector<T, TypeList<First, Rest...>>
+		{
+			using Type = First;
+		};
+
+		/**
+		 * @brief	Gets the parameter types of a function pointer or of a callable object with a single,
+		 * 			non-template operator(), such as a lambda without auto parameters.
+		 * @tparam	T The callable type.
+		 */
+		template<typename T>
+		struct CallableTraits : CallableTraits<decltype(&T::operator())>
+		{};
+
+		template<typename Return, typename... Args>
+		struct CallableTraits<Return(*)(Args...)>
+		{
+			using ReturnType = Return;
+			using Arguments = std::tuple<Args...>;
+
+			template<size_t Index>
+			using Argument = std::tuple_element_t<Index, Arguments>;
+
+			static constexpr size_t arity = sizeof...(Args);
+		};
+
+		template<typename Class, typename Return, typename... Args>
+		struct CallableTraits<Return(Class::*)(Args...)> : CallableTraits<Return(*)(Args...)>
+		{};
+
+		template<typename Class, typename Return, typename... Args>
+		struct CallableTraits<Return(Class::*)(Args...) const> : CallableTraits<Return(*)(Args...)>
+		{};
+
+		/**
+		 * @brief	Checks whether Base is a virtual base of Derived.
+		 * @details	A Base pointer can be cast down to Derived with static_cast only if Base is a non-virtual, unambiguous base.
+		 * @tparam	Derived The derived class.
+		 * @tparam	Base    The base class.
+		 */
+		template<typename Derived, typename Base, typename = void>
+		struct IsVirtualBaseOf : std::is_base_of<Base, Derived>
+		{};
+
+		template<typename Derived, typename Base>
+		struct IsVirtualBaseOf<Derived, Base, std::void_t<decltype(static_cast<Derived*>(std::declval<Base*>()))>> : std::false_type
+		{};
+
+		/**
+		 * @brief	Gets the offset of the Base subobject inside a Derived object.
+		 * @details	The conversion of a non-virtual base adds a constant, so it is applied to a dummy aligned address
+		 * 			instead of an object, like the member offsets of PROPERTY. The offset of a virtual base depends on the
+		 * 			most derived object, so virtual bases are rejected at compile time.
+		 * @tparam	Derived The derived class.
+		 * @tparam	Base    A non-virtual base of Derived.
+		 * @return	ptrdiff_t The address of the Base subobject minus the address of the Derived object.
+		 */
+		template<typename Derived, typename Base>
+		ptrdiff_t BaseOffset()
+		{
+			static_assert(!IsVirtualBaseOf<Derived, Base>::value, "Reflection::GENERATE : Virtual bases are not supported.");
+
+			constexpr uintptr_t address = 0x10000;
+
+			Derived* derived = reinterpret_cast<Derived*>(address);
+			return reinterpret_cast<char*>(static_cast<Base*>(derived)) - reinterpret_cast<char*>(derived);
+		}
+
 		/**
 		 * @brief	Removes pointer qualifiers from a type.
 		 * @tparam	T The type to process.
@@ -411,6 +514,252 @@ namespace Reflection
 		template<typename T>
 		constexpr bool IsMap = HasIterator<T>::value && HasKey<T>::value && HasMapped<T>::value;
 
+		/**
+		 * @brief	Compile-time checks for the optional container operations used by ContainerPropertyInfo.
+		 * @details	Both the STL naming (size, data, find) and the wtr naming (Size, Data, Find) are detected.
+		 * 			When none is available, the ContainerPropertyInfo falls back to iteration.
+		 * @tparam	T The container type to check.
+		 */
+		template<typename T, typename = void>
+		struct HasStdSize
+		{
+			static constexpr bool value = false;
+		};
+
+		template<typename T>
+		struct HasStdSize<T, typename TypeWrapper<decltype(std::declval<const T&>().size())>::Type>
+		{
+			static constexpr bool value = true;
+		};
+
+		template<typename T, typename = void>
+		struct HasSize
+		{
+			static constexpr bool value = false;
+		};
+
+		template<typename T>
+		struct HasSize<T, typename TypeWrapper<decltype(std::declval<const T&>().Size())>::Type>
+		{
+			static constexpr bool value = true;
+		};
+
+		template<typename T, typename = void>
+		struct HasStdData
+		{
+			static constexpr bool value = false;
+		};
+
+		template<typename T>
+		struct HasStdData<T, typename TypeWrapper<decltype(std::declval<const T&>().data())>::Type>
+		{
+			static constexpr bool value = true;
+		};
+
+		template<typename T, typename = void>
+		struct HasData
+		{
+			static constexpr bool value = false;
+		};
+
+		template<typename T>
+		struct HasData<T, typename TypeWrapper<decltype(std::declval<const T&>().Data())>::Type>
+		{
+			static constexpr bool value = true;
+		};
+
+		template<typename T, typename = void>
+		struct HasStdFind
+		{
+			static constexpr bool value = false;
+		};
+
+		template<typename T>
+		struct HasStdFind<T, typename TypeWrapper<decltype(std::declval<const T&>().find(std::declval<const typename KeyTraits<T>::KeyType&>()) == std::declval<const T&>().end())>::Type>
+		{
+			static constexpr bool value = true;
+		};
+
+		template<typename T, typename = void>
+		struct HasFind
+		{
+			static constexpr bool value = false;
+		};
+
+		template<typename T>
+		struct HasFind<T, typename TypeWrapper<decltype(std::declval<const T&>().Find(std::declval<const typename KeyTraits<T>::KeyType&>()) == std::declval<const T&>().end())>::Type>
+		{
+			static constexpr bool value = true;
+		};
+
+		/**
+		 * @brief	Compile-time checks for the optional container mutations used by ContainerPropertyInfo.
+		 * @details	As with the lookups above, both the STL naming and the wtr naming are detected.
+		 * @tparam	T The container type to check.
+		 */
+		template<typename T, typename = void>
+		struct HasStdClear
+		{
+			static constexpr bool value = false;
+		};
+
+		template<typename T>
+		struct HasStdClear<T, typename TypeWrapper<decltype(std::declval<T&>().clear())>::Type>
+		{
+			static constexpr bool value = true;
+		};
+
+		template<typename T, typename = void>
+		struct HasClear
+		{
+			static constexpr bool value = false;
+		};
+
+		template<typename T>
+		struct HasClear<T, typename TypeWrapper<decltype(std::declval<T&>().Clear())>::Type>
+		{
+			static constexpr bool value = true;
+		};
+
+		template<typename T, typename = void>
+		struct HasStdReserve
+		{
+			static constexpr bool value = false;
+		};
+
+		template<typename T>
+		struct HasStdReserve<T, typename TypeWrapper<decltype(std::declval<T&>().reserve(size_t(0)))>::Type>
+		{
+			static constexpr bool value = true;
+		};
+
+		template<typename T, typename = void>
+		struct HasReserve
+		{
+			static constexpr bool value = false;
+		};
+
+		template<typename T>
+		struct HasReserve<T, typename TypeWrapper<decltype(std::declval<T&>().Reserve(size_t(0)))>::Type>
+		{
+			static constexpr bool value = true;
+		};
+
+		template<typename T, typename = void>
+		struct HasStdPushBack
+		{
+			static constexpr bool value = false;
+		};
+
+		template<typename T>
+		struct HasStdPushBack<T, typename TypeWrapper<decltype(std::declval<T&>().push_back(std::declval<const typename ValueTraits<T>::ValueType&>()))>::Type>
+		{
+			static constexpr bool value = true;
+		};
+
+		template<typename T, typename = void>
+		struct HasPushBack
+		{
+			static constexpr bool value = false;
+		};
+
+		template<typename T>
+		struct HasPushBack<T, typename TypeWrapper<decltype(std::declval<T&>().PushBack(std::declval<const typename ValueTraits<T>::ValueType&>()))>::Type>
+		{
+			static constexpr bool value = true;
+		};
+
+		template<typename T, typename = void>
+		struct HasStdInsert
+		{
+			static constexpr bool value = false;
+		};
+
+		template<typename T>
+		struct HasStdInsert<T, typename TypeWrapper<decltype(std::declval<T&>().insert(std::declval<const typename ValueTraits<T>::ValueType&>()))>::Type>
+		{
+			static constexpr bool value = true;
+		};
+
+		template<typename T, typename = void>
+		struct HasInsert
+		{
+			static constexpr bool value = false;
+		};
+
+		template<typename T>
+		struct HasInsert<T, typename TypeWrapper<decltype(std::declval<T&>().Insert(std::declval<const typename ValueTraits<T>::ValueType&>()))>::Type>
+		{
+			static constexpr bool value = true;
+		};
+
+		template<typename T, typename = void>
+		struct HasStdErase
+		{
+			static constexpr bool value = false;
+		};
+
+		template<typename T>
+		struct HasStdErase<T, typename TypeWrapper<decltype(std::declval<T&>().erase(std::declval<const typename KeyTraits<T>::KeyType&>()))>::Type>
+		{
+			static constexpr bool value = true;
+		};
+
+		template<typename T, typename = void>
+		struct HasErase
+		{
+			static constexpr bool value = false;
+		};
+
+		template<typename T>
+		struct HasErase<T, typename TypeWrapper<decltype(std::declval<T&>().Erase(std::declval<const typename KeyTraits<T>::KeyType&>()))>::Type>
+		{
+			static constexpr bool value = true;
+		};
+
+		template<typename T, typename = void>
+		struct HasStdResize
+		{
+			static constexpr bool value = false;
+		};
+
+		template<typename T>
+		struct HasStdResize<T, typename TypeWrapper<decltype(std::declval<T&>().resize(size_t(0)))>::Type>
+		{
+			static constexpr bool value = true;
+		};
+
+		template<typename T, typename = void>
+		struct HasResize
+		{
+			static constexpr bool value = false;
+		};
+
+		template<typename T>
+		struct HasResize<T, typename TypeWrapper<decltype(std::declval<T&>().Resize(size_t(0)))>::Type>
+		{
+			static constexpr bool value = true;
+		};
+
+		/**
+		 * @brief	Compile-time check for copy construction and assignment.
+		 * @details	Containers and pairs declare unconstrained copy operations, so their elements are checked as well.
+		 * @tparam	T The type to check.
+		 */
+		template<typename T, typename = void>
+		struct IsCopyable
+		{
+			static constexpr bool value = std::is_copy_constructible<T>::value && std::is_copy_assignable<T>::value;
+		};
+
+		template<typename T>
+		struct IsCopyable<T, IsEnabled_t<HasIterator<T>::value>>
+		{
+			static constexpr bool value = std::is_copy_constructible<T>::value 
+				&& std::is_copy_assignable<T>::value 
+				&& std::is_copy_constructible<typename ValueTraits<T>::ValueType>::value;
+		};
+
 		template<typename T>
 		struct MemberTraits;
 
@@ -421,6 +770,112 @@ namespace Reflection
 			using PropertyType = Property;
 		};
 
+		/**
+		 * @brief	Gets the offset of a data member inside a Class object.
+		 * @details	Like BaseOffset, the member is taken from a dummy aligned address instead of a null pointer.
+		 * 			The member of a virtual base has no constant offset, so virtual bases are rejected at compile time.
+		 * @tparam	Class  The class holding the member, directly or through a non-virtual base.
+		 * @tparam	Member The member pointer, e.g. &Particle::m_Size.
+		 * @return	size_t The address of the member minus the address of the Class object.
+		 */
+		template<typename Class, auto Member>
+		size_t MemberOffset()
+		{
+			using Owner = typename MemberTraits<decltype(Member)>::ClassType;
+			static_assert(!IsVirtualBaseOf<Class, Owner>::value, "Reflection::MemberOffset : Members of virtual bases are not supported.");
+
+			constexpr uintptr_t address = 0x10000;
+
+			const Class* object = reinterpret_cast<const Class*>(address);
+			return static_cast<size_t>(reinterpret_cast<const char*>(&(object->*Member)) - reinterpret_cast<const char*>(object));
+		}
+
+		/**
+		 * @brief	Upper bound of the compile-time property counter generated by the PROPERTY macro.
+		 * @details	Overload resolution on Rank<MaxStaticProperty> picks the highest counter declared
+		 * 			so far in the class, so a class cannot register more static properties than this.
+		 */
+		constexpr size_t MaxStaticProperty = 256;
+
+		/**
+		 * @brief	Overload ranking helper. Rank<N> converts to every Rank<M> with M < N,
+		 * 			preferring the closest one.
+		 * @tparam	N The rank value.
+		 */
+		template<size_t N>
+		struct Rank : Rank<N - 1>
+		{};
+
+		/**
+		 * @brief	Terminal specialization of Rank.
+		 */
+		template<>
+		struct Rank<0>
+		{};
+
+		/**
+		 * @brief	Compile-time counter value returned by the StaticPropertyCounter overloads.
+		 * @tparam	N The counter value.
+		 */
+		template<size_t N>
+		struct Counter
+		{
+			static constexpr size_t value = N;
+		};
+
+		/**
+		 * @brief	Tag type used to select the StaticPropertyEntry overload of a given index.
+		 * @tparam	N The property index.
+		 */
+		template<size_t N>
+		struct Index
+		{};
+
+		/**
+		 * @brief	Compile-time check for the dirty mask declared by GENERATE_TRACKED.
+		 * @tparam	T The type to check.
+		 */
+		template<typename T, typename = void>
+		struct HasDirtyMask
+		{
+			static constexpr bool value = false;
+		};
+
+		template<typename T>
+		struct HasDirtyMask<T, typename TypeWrapper<decltype(std::declval<T&>().GetDirtyMask())>::Type>
+		{
+			static constexpr bool value = true;
+		};
+
+		/**
+		 * @brief	Compile-time check for the enumerator list declared by GENERATE_ENUM / GENERATE_FLAGS.
+		 * @details	The list is found through argument-dependent lookup, in the namespace or the class of the enum.
+		 * @tparam	T The type to check.
+		 */
+		template<typename T, typename = void>
+		struct HasEnumEntries
+		{
+			static constexpr bool value = false;
+		};
+
+		template<typename T>
+		struct HasEnumEntries<T, typename TypeWrapper<decltype(ReflectionEnumEntries(static_cast<T*>(nullptr)))>::Type>
+		{
+			static constexpr bool value = true;
+		};
+
+		template<typename T, typename = void>
+		struct HasPointee
+		{
+			static constexpr bool value = false;
+		};
+
+		template<typename T>
+		struct HasPointee<T, typename TypeWrapper<typename T::PointeeType>::Type>
+		{
+			static constexpr bool value = true;
+		};
+
 		template<typename T, typename = void>
 		struct HasRuntimeType
 		{
@@ -432,8 +887,198 @@ namespace Reflection
 		{
 			static constexpr bool value = true;
 		};
-		
-		const std::string GetName(const std::string& rawClassName);
+
+		/**
+		 * @brief	Memory traits of a type. Non-object types (void, functions, references) report a zero size.
+		 * @tparam	T The type to inspect.
+		 */
+		template<typename T, bool = std::is_object<T>::value>
+		struct ObjectTraits
+		{
+			static constexpr size_t size = 0;
+			static constexpr size_t alignment = 0;
+			static constexpr bool isTriviallyCopyable = false;
+			static constexpr bool isPolymorphic = false;
+		};
+
+		/**
+		 * @brief	Memory traits specialization for object types.
+		 * @tparam	T The type to inspect.
+		 */
+		template<typename T>
+		struct ObjectTraits<T, true>
+		{
+			static constexpr size_t size = sizeof(T);
+			static constexpr size_t alignment = alignof(T);
+			static constexpr bool isTriviallyCopyable = std::is_trivially_copyable<T>::value;
+			static constexpr bool isPolymorphic = std::is_polymorphic<T>::value;
+		};
+
+		template<typename T, typename = void>
+		struct IsPair
+		{
+			static constexpr bool value = false;
+		};
+
+		template<typename T>
+		struct IsPair<T, typename TypeWrapper<typename T::first_type, typename T::second_type>::Type>
+		{
+			static constexpr bool value = true;
+		};
+
+		template<typename T, typename = void>
+		struct HasEqualOperator
+		{
+			static constexpr bool value = false;
+		};
+
+		template<typename T>
+		struct HasEqualOperator<T, typename TypeWrapper<decltype(std::declval<const T&>() == std::declval<const T&>())>::Type>
+		{
+			static constexpr bool value = true;
+		};
+
+		/**
+		 * @brief	Compile-time check for a usable operator==.
+		 * @details	Containers and pairs declare an unconstrained operator== that fails only when instantiated,
+		 * 			so containers are checked through their elements and pairs member by member.
+		 * @tparam	T The type to check.
+		 */
+		template<typename T, bool = IsPair<T>::value, bool = HasIterator<T>::value>
+		struct HasEqual
+		{
+			static constexpr bool value = HasEqualOperator<T>::value;
+		};
+
+		/**
+		 * @brief	Specialization of HasEqual for containers (including strings), checking the element type.
+		 * @tparam	T The container type to check.
+		 */
+		template<typename T>
+		struct HasEqual<T, false, true>
+		{
+			static constexpr bool value = HasEqualOperator<T>::value && HasEqual<RemoveConst_t<typename ValueTraits<T>::ValueType>>::value;
+		};
+
+		/**
+		 * @brief	Specialization of HasEqual for pair types.
+		 * @tparam	T The pair type to check.
+		 */
+		template<typename T, bool Iterable>
+		struct HasEqual<T, true, Iterable>
+		{
+			static constexpr bool value = HasEqual<RemoveConst_t<typename T::first_type>>::value && HasEqual<typename T::second_type>::value;
+		};
+
+		/**
+		 * @brief	Compile-time check for an enabled std::hash specialization.
+		 * @tparam	T The type to check.
+		 */
+		template<typename T, typename = void>
+		struct HasHash
+		{
+			static constexpr bool value = false;
+		};
+
+		template<typename T>
+		struct HasHash<T, typename TypeWrapper<decltype(std::hash<T>{}(std::declval<const T&>()))>::Type>
+		{
+			static constexpr bool value = true;
+		};
+
+		/**
+		 * @brief	Gets the key of a container element, the first member for the pairs of a map.
+		 * @tparam	T The element type.
+		 * @param	value The element.
+		 * @return	The key of the element.
+		 */
+		template<typename T>
+		const auto& GetKey(const T& value)
+		{
+			if constexpr (IsPair<T>::value)
+			{
+				return value.first;
+			}
+			else
+			{
+				return value;
+			}
+		}
+
+		/**
+		 * @brief	Gets the index of the lowest set bit.
+		 * @param	value A non-zero value.
+		 * @return	size_t The number of trailing zero bits.
+		 */
+		inline size_t CountTrailingZeros(uint64_t value)
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			return static_cast<size_t>(__builtin_ctzll(value));
+#else
+			size_t count = 0;
+			while (0 == (value & 1))
+			{
+				value >>= 1;
+				++count;
+			}
+
+			return count;
+#endif
+		}
+
+		/**
+		 * @brief	ORs bits into a plain word atomically, for words that are also copied as plain values.
+		 * @details	Relaxed : it only guarantees that concurrent ORs into the same word are all kept.
+		 */
+		inline void AtomicOr(uint64_t& word, uint64_t bits)
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			__atomic_fetch_or(&word, bits, __ATOMIC_RELAXED);
+#elif defined(_MSC_VER)
+			_InterlockedOr64(reinterpret_cast<volatile long long*>(&word), static_cast<long long>(bits));
+#else
+			word |= bits;
+#endif
+		}
+
+		/**
+		 * @brief	Counts the set bits of a value.
+		 */
+		inline size_t PopCount(uint64_t value)
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			return static_cast<size_t>(__builtin_popcountll(value));
+#else
+			size_t count = 0;
+			for (; 0 != value; value &= value - 1)
+			{
+				++count;
+			}
+
+			return count;
+#endif
+		}
+
+		/**
+		 * @brief	Hashes a run of bytes.
+		 * @details	Consumes the input 16 bytes at a time on two independent 64-bit lanes,
+		 * 			so runs of trivially-copyable fields are hashed word by word instead of field by field.
+		 * @param	data The address of the first byte.
+		 * @param	size The number of bytes.
+		 * @param	seed The initial hash value.
+		 * @return	size_t The hash value.
+		 */
+		size_t HashBytes(const void* data, size_t size, size_t seed);
+
+		/**
+		 * @brief	Combines a hash value into a seed in an order-dependent way.
+		 * @param	seed  The accumulated hash value.
+		 * @param	value The hash value to combine.
+		 * @return	size_t The combined hash value.
+		 */
+		size_t HashCombine(size_t seed, size_t value);
+
+		const std::string GetName(std::string_view rawClassName);
 	};
 };
 #endif // __REFLECTION_UTILS_H__
\ No newline at end of file
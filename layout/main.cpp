@@ -0,0 +1,184 @@
+#include <Reflection.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+namespace
+{
+	struct Options
+	{
+		std::vector<const char*> libraries;
+		std::string filter;
+		size_t minPadding;
+		bool isVerbose;
+	};
+
+	void PrintUsage(const char* program)
+	{
+		std::printf("Usage : %s [--filter <text>] [--min-padding <bytes>] [--brief] [library ...]\n", program);
+		std::printf("  Reports the size, padding, cache line splits and a smaller field order of every reflected type.\n");
+		std::printf("  When libraries are given, they are loaded and only the types they register are reported.\n");
+	}
+
+	bool ParseOptions(int argc, char* argv[], Options& options)
+	{
+		for (int index = 1; index < argc; ++index)
+		{
+			const char* argument = argv[index];
+
+			if ((0 == std::strcmp(argument, "--filter")) && (index + 1 < argc))
+			{
+				options.filter = argv[++index];
+			}
+			else if ((0 == std::strcmp(argument, "--min-padding")) && (index + 1 < argc))
+			{
+				options.minPadding = static_cast<size_t>(std::strtoull(argv[++index], nullptr, 10));
+			}
+			else if (0 == std::strcmp(argument, "--brief"))
+			{
+				options.isVerbose = false;
+			}
+			else if ('-' == argument[0])
+			{
+				return false;
+			}
+			else
+			{
+				options.libraries.push_back(argument);
+			}
+		}
+
+		return true;
+	}
+
+	void* OpenLibrary(const char* path)
+	{
+#if defined(_WIN32)
+		return static_cast<void*>(LoadLibraryA(path));
+#else
+		return dlopen(path, RTLD_NOW | RTLD_LOCAL);
+#endif
+	}
+
+	void PrintReport(const Reflection::LayoutReport& report, bool isVerbose)
+	{
+		std::printf("%s\n", report.type->GetTypeName().data());
+		std::printf("  size %zu, align %zu, padding %zu (tail %zu), %zu cache line(s), %zu split field(s), %.1f%% split in arrays\n",
+			report.size, report.alignment, report.paddingBytes, report.tailPadding, report.cacheLines, report.splitCount, report.arraySplitRate * 100.0);
+
+		if (isVerbose)
+		{
+			std::printf("  %8s %8s %6s %8s  %s\n", "offset", "size", "align", "padding", "property");
+
+			for (const Reflection::LayoutField& field : report.fields)
+			{
+				std::printf("  %8zu %8zu %6zu %8zu  %s%s\n", field.offset, field.size, field.alignment, field.paddingBefore,
+					field.property->GetPropertyName().data(), field.isSplit ? "  [split]" : "");
+			}
+		}
+
+		if (report.CanShrink())
+		{
+			std::printf("  suggested order (size %zu) :", report.suggestedSize);
+
+			for (const Reflection::PropertyInfo* property : report.suggestedOrder)
+			{
+				std::printf(" %s", property->GetPropertyName().data());
+			}
+
+			std::printf("\n");
+		}
+
+		std::printf("\n");
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	Options options{ {}, {}, 0, true };
+
+	if (!ParseOptions(argc, argv, options))
+	{
+		PrintUsage(argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	Reflection::TypeManager& typeManager = Reflection::TypeManager::GetHandle();
+
+	// The libraries stay loaded until the process exits, so their metadata remains valid.
+	std::unordered_set<Reflection::TypeManager::ModuleId> modules;
+	for (const char* path : options.libraries)
+	{
+		const Reflection::TypeManager::ModuleId module = typeManager.CreateModule(path);
+		Reflection::TypeManager::ModuleScope scope(module);
+
+		if (nullptr == OpenLibrary(path))
+		{
+			std::fprintf(stderr, "Failed to load %s\n", path);
+			return EXIT_FAILURE;
+		}
+
+		modules.insert(module);
+	}
+
+	std::vector<Reflection::LayoutReport> reports;
+	{
+		Reflection::TypeManager::ReadGuard guard;
+
+		for (const auto& [hash, type] : typeManager.GetTypeMap())
+		{
+			if (type->GetPropertyList().empty() || (!modules.empty() && (0 == modules.count(typeManager.GetModule(type)))))
+			{
+				continue;
+			}
+
+			if (!options.filter.empty() && (std::string::npos == type->GetTypeName().find(options.filter)))
+			{
+				continue;
+			}
+
+			Reflection::LayoutReport report = type->AnalyzeLayout();
+			if (options.minPadding <= report.paddingBytes)
+			{
+				reports.push_back(std::move(report));
+			}
+		}
+	}
+
+	// The fattest types first.
+	std::sort(reports.begin(), reports.end(), [](const Reflection::LayoutReport& lhs, const Reflection::LayoutReport& rhs)
+	{
+		if (lhs.paddingBytes != rhs.paddingBytes)
+		{
+			return lhs.paddingBytes > rhs.paddingBytes;
+		}
+
+		return (lhs.size != rhs.size) ? (lhs.size > rhs.size) : (lhs.type->GetTypeName() < rhs.type->GetTypeName());
+	});
+
+	size_t paddingBytes = 0;
+	size_t shrinkable = 0;
+
+	for (const Reflection::LayoutReport& report : reports)
+	{
+		PrintReport(report, options.isVerbose);
+
+		paddingBytes += report.paddingBytes;
+		shrinkable += report.CanShrink() ? 1 : 0;
+	}
+
+	std::printf("%zu type(s), %zu padding byte(s), %zu type(s) can shrink\n", reports.size(), paddingBytes, shrinkable);
+
+	return EXIT_SUCCESS;
+}
\ No newline at end of file
@@ -0,0 +1,672 @@
+#include "ArchetypeStore.h"
+
+#include "Utils.h"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+namespace Reflection
+{
+	namespace
+	{
+		size_t AlignUp(const size_t value, const size_t alignment)
+		{
+			return (value + alignment - 1) / alignment * alignment;
+		}
+
+		Archetype* FindEdge(const std::vector<std::pair<uint32_t, Archetype*>>& edges, const uint32_t typeId)
+		{
+			for (const auto& [edgeTypeId, archetype] : edges)
+			{
+				if (edgeTypeId == typeId)
+				{
+					return archetype;
+				}
+			}
+
+			return nullptr;
+		}
+	}
+
+	void TypeSet::Insert(const TypeInfo* type)
+	{
+		const uint32_t typeId = type->GetTypeId();
+		const size_t word = typeId / 64;
+
+		if (m_words.size() <= word)
+		{
+			m_words.resize(word + 1, 0);
+		}
+
+		m_words[word] |= uint64_t(1) << (typeId % 64);
+	}
+
+	void TypeSet::Erase(const TypeInfo* type)
+	{
+		const uint32_t typeId = type->GetTypeId();
+		const size_t word = typeId / 64;
+
+		if (m_words.size() <= word)
+		{
+			return;
+		}
+
+		m_words[word] &= ~(uint64_t(1) << (typeId % 64));
+
+		while (!m_words.empty() && (0 == m_words.back()))
+		{
+			m_words.pop_back();
+		}
+	}
+
+	bool TypeSet::ContainsAll(const TypeSet& other) const
+	{
+		if (m_words.size() < other.m_words.size())
+		{
+			return false;
+		}
+
+		for (size_t index = 0; index < other.m_words.size(); ++index)
+		{
+			if (0 != (other.m_words[index] & ~m_words[index]))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	bool TypeSet::Intersects(const TypeSet& other) const
+	{
+		const size_t count = std::min(m_words.size(), other.m_words.size());
+
+		for (size_t index = 0; index < count; ++index)
+		{
+			if (0 != (m_words[index] & other.m_words[index]))
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	bool TypeSet::IsEmpty() const
+	{
+		return m_words.empty();
+	}
+
+	size_t TypeSet::GetHash() const
+	{
+		return Utils::HashBytes(m_words.data(), m_words.size() * sizeof(uint64_t), 0);
+	}
+
+	bool TypeSet::operator==(const TypeSet& other) const
+	{
+		return m_words == other.m_words;
+	}
+
+	bool TypeSet::operator!=(const TypeSet& other) const
+	{
+		return m_words != other.m_words;
+	}
+
+	Archetype::Archetype(std::vector<const TypeInfo*> types)
+		: m_typeSet()
+		, m_columns()
+		, m_columnIndices()
+		, m_chunks()
+		, m_chunkCapacity(1)
+		, m_chunkSize(ChunkBytes)
+		, m_chunkAlignment(ColumnAlignment)
+		, m_size(0)
+		, m_addEdges()
+		, m_removeEdges()
+	{
+		std::sort(types.begin(), types.end(), [](const TypeInfo* lhs, const TypeInfo* rhs)
+		{
+			return lhs->GetTypeId() < rhs->GetTypeId();
+		});
+
+		size_t rowBytes = sizeof(Entity);
+		uint32_t maxTypeId = 0;
+
+		for (const TypeInfo* type : types)
+		{
+			m_typeSet.Insert(type);
+			m_columns.push_back({ type, 0, type->GetTypeSize(), type->IsTriviallyCopyable(), type->IsTriviallyDestructible() });
+			m_chunkAlignment = std::max(m_chunkAlignment, type->GetTypeAlignment());
+
+			rowBytes += type->GetTypeSize();
+			maxTypeId = std::max(maxTypeId, type->GetTypeId());
+		}
+
+		const auto layout = [this](const size_t capacity)
+		{
+			size_t offset = capacity * sizeof(Entity);
+
+			for (Column& column : m_columns)
+			{
+				offset = AlignUp(offset, std::max(ColumnAlignment, column.type->GetTypeAlignment()));
+				column.offset = offset;
+				offset += capacity * column.size;
+			}
+
+			return offset;
+		};
+
+		// The largest capacity whose aligned columns still fit in a chunk.
+		size_t capacity = std::max<size_t>(1, ChunkBytes / rowBytes);
+		while ((1 < capacity) && (ChunkBytes < layout(capacity)))
+		{
+			--capacity;
+		}
+
+		m_chunkCapacity = capacity;
+		m_chunkSize = std::max(ChunkBytes, layout(capacity));
+
+		if (!m_columns.empty())
+		{
+			m_columnIndices.assign(maxTypeId + 1, static_cast<uint32_t>(m_columns.size()));
+
+			for (size_t column = 0; column < m_columns.size(); ++column)
+			{
+				m_columnIndices[m_columns[column].type->GetTypeId()] = static_cast<uint32_t>(column);
+			}
+		}
+	}
+
+	Archetype::~Archetype()
+	{
+		for (size_t row = 0; row < m_size; ++row)
+		{
+			DestructRow(row);
+		}
+
+		for (Chunk& chunk : m_chunks)
+		{
+			::operator delete(chunk.data, std::align_val_t(m_chunkAlignment));
+		}
+	}
+
+	const TypeSet& Archetype::GetTypeSet() const
+	{
+		return m_typeSet;
+	}
+
+	size_t Archetype::GetColumnCount() const
+	{
+		return m_columns.size();
+	}
+
+	const Archetype::Column& Archetype::GetColumn(size_t column) const
+	{
+		return m_columns[column];
+	}
+
+	size_t Archetype::GetSize() const
+	{
+		return m_size;
+	}
+
+	size_t Archetype::GetChunkCapacity() const
+	{
+		return m_chunkCapacity;
+	}
+
+	size_t Archetype::GetChunkCount() const
+	{
+		return m_chunks.size();
+	}
+
+	const Archetype::Chunk& Archetype::GetChunk(size_t chunk) const
+	{
+		return m_chunks[chunk];
+	}
+
+	size_t Archetype::AppendRow(Entity entity)
+	{
+		const size_t row = m_size;
+		const size_t chunkIndex = row / m_chunkCapacity;
+
+		// Emptied chunks are kept, so an archetype that shrinks and grows again does not reallocate.
+		if (m_chunks.size() == chunkIndex)
+		{
+			m_chunks.push_back({ static_cast<char*>(::operator new(m_chunkSize, std::align_val_t(m_chunkAlignment))), 0 });
+		}
+
+		Chunk& chunk = m_chunks[chunkIndex];
+		reinterpret_cast<Entity*>(chunk.data)[chunk.count] = entity;
+
+		++chunk.count;
+		++m_size;
+
+		return row;
+	}
+
+	Entity Archetype::EraseRow(size_t row)
+	{
+		const size_t last = m_size - 1;
+		Entity moved{ Entity::InvalidIndex, 0 };
+
+		size_t lastIndex = 0;
+		char* lastData = LocateRow(last, lastIndex);
+
+		if (row != last)
+		{
+			size_t index = 0;
+			char* data = LocateRow(row, index);
+
+			for (size_t column = 0; column < m_columns.size(); ++column)
+			{
+				RelocateValue(column, GetComponentAt(data, index, column), GetComponentAt(lastData, lastIndex, column));
+			}
+
+			moved = reinterpret_cast<Entity*>(lastData)[lastIndex];
+			reinterpret_cast<Entity*>(data)[index] = moved;
+		}
+
+		--m_chunks[last / m_chunkCapacity].count;
+		--m_size;
+
+		return moved;
+	}
+
+	void Archetype::DestructRow(size_t row)
+	{
+		size_t index = 0;
+		char* data = LocateRow(row, index);
+
+		for (size_t column = 0; column < m_columns.size(); ++column)
+		{
+			DestructValue(column, GetComponentAt(data, index, column));
+		}
+	}
+
+	void Archetype::RelocateValue(size_t column, void* target, void* source) const
+	{
+		// Most components are plain data, moved without the call through the TypeInfo.
+		if (m_columns[column].isTriviallyCopyable)
+		{
+			std::memcpy(target, source, m_columns[column].size);
+		}
+		else
+		{
+			m_columns[column].type->Relocate(target, source);
+		}
+	}
+
+	void Archetype::DestructValue(size_t column, void* value) const
+	{
+		if (!m_columns[column].isTriviallyDestructible)
+		{
+			m_columns[column].type->Destruct(value);
+		}
+	}
+
+	ArchetypeQuery::ArchetypeQuery()
+		: m_include()
+		, m_exclude()
+		, m_matches()
+		, m_scanned(0)
+		, m_store(nullptr)
+	{}
+
+	ArchetypeQuery& ArchetypeQuery::With(const TypeInfo* type)
+	{
+		if (!m_include.Contains(type))
+		{
+			m_include.Insert(type);
+			Reset();
+		}
+
+		return *this;
+	}
+
+	ArchetypeQuery& ArchetypeQuery::Without(const TypeInfo* type)
+	{
+		if (!m_exclude.Contains(type))
+		{
+			m_exclude.Insert(type);
+			Reset();
+		}
+
+		return *this;
+	}
+
+	bool ArchetypeQuery::Matches(const Archetype& archetype) const
+	{
+		return archetype.GetTypeSet().ContainsAll(m_include) && !archetype.GetTypeSet().Intersects(m_exclude);
+	}
+
+	void ArchetypeQuery::Reset()
+	{
+		m_matches.clear();
+		m_scanned = 0;
+	}
+
+	ArchetypeStore::ArchetypeStore()
+		: m_archetypes()
+		, m_archetypeMap()
+		, m_records()
+		, m_freeIndices()
+		, m_emptyArchetype(nullptr)
+		, m_entityCount(0)
+	{
+		m_emptyArchetype = FindArchetype({});
+	}
+
+	ArchetypeStore::~ArchetypeStore() = default;
+
+	Entity ArchetypeStore::CreateEntity()
+	{
+		uint32_t index = 0;
+
+		if (m_freeIndices.empty())
+		{
+			index = static_cast<uint32_t>(m_records.size());
+			m_records.push_back({ nullptr, 0, 1 });
+		}
+		else
+		{
+			index = m_freeIndices.back();
+			m_freeIndices.pop_back();
+		}
+
+		Record& record = m_records[index];
+		const Entity entity{ index, record.generation };
+
+		record.archetype = m_emptyArchetype;
+		record.row = static_cast<uint32_t>(m_emptyArchetype->AppendRow(entity));
+
+		++m_entityCount;
+
+		return entity;
+	}
+
+	bool ArchetypeStore::DestroyEntity(Entity entity)
+	{
+		Record* record = FindRecord(entity);
+		if (nullptr == record)
+		{
+			return false;
+		}
+
+		Archetype* archetype = record->archetype;
+		archetype->DestructRow(record->row);
+
+		const Entity moved = archetype->EraseRow(record->row);
+		if (moved.IsValid())
+		{
+			m_records[moved.index].row = record->row;
+		}
+
+		record->archetype = nullptr;
+		++record->generation;
+
+		m_freeIndices.push_back(entity.index);
+		--m_entityCount;
+
+		return true;
+	}
+
+	bool ArchetypeStore::IsAlive(Entity entity) const
+	{
+		return nullptr != FindRecord(entity);
+	}
+
+	size_t ArchetypeStore::GetEntityCount() const
+	{
+		return m_entityCount;
+	}
+
+	void* ArchetypeStore::AddComponent(Entity entity, const TypeInfo* type)
+	{
+		Record* record = FindRecord(entity);
+		if ((nullptr == record) || (nullptr == type))
+		{
+			return nullptr;
+		}
+
+		const size_t column = record->archetype->FindColumn(type);
+		if (column != record->archetype->GetColumnCount())
+		{
+			return record->archetype->GetComponent(column, record->row);
+		}
+
+		if (!type->IsConstructible() || !type->IsRelocatable())
+		{
+			return nullptr;
+		}
+
+		Archetype* target = GetAddTarget(record->archetype, type);
+		MoveEntity(entity, *record, target);
+
+		void* component = target->GetComponent(target->FindColumn(type), record->row);
+		type->Construct(component);
+
+		return component;
+	}
+
+	void* ArchetypeStore::AddComponent(Entity entity, const TypeInfo* type, const void* value)
+	{
+		Record* record = FindRecord(entity);
+		if ((nullptr == record) || (nullptr == type) || (nullptr == value))
+		{
+			return nullptr;
+		}
+
+		const size_t column = record->archetype->FindColumn(type);
+		if (column != record->archetype->GetColumnCount())
+		{
+			void* component = record->archetype->GetComponent(column, record->row);
+			return type->CopyAssign(component, value) ? component : nullptr;
+		}
+
+		if (!type->IsCopyable() || !type->IsRelocatable())
+		{
+			return nullptr;
+		}
+
+		Archetype* target = GetAddTarget(record->archetype, type);
+		MoveEntity(entity, *record, target);
+
+		void* component = target->GetComponent(target->FindColumn(type), record->row);
+		type->CopyConstruct(component, value);
+
+		return component;
+	}
+
+	bool ArchetypeStore::RemoveComponent(Entity entity, const TypeInfo* type)
+	{
+		Record* record = FindRecord(entity);
+		if ((nullptr == record) || (nullptr == type) || !record->archetype->GetTypeSet().Contains(type))
+		{
+			return false;
+		}
+
+		MoveEntity(entity, *record, GetRemoveTarget(record->archetype, type));
+
+		return true;
+	}
+
+	void* ArchetypeStore::GetComponent(Entity entity, const TypeInfo* type) const
+	{
+		const Record* record = FindRecord(entity);
+		if ((nullptr == record) || (nullptr == type))
+		{
+			return nullptr;
+		}
+
+		const size_t column = record->archetype->FindColumn(type);
+
+		return (column != record->archetype->GetColumnCount()) ? record->archetype->GetComponent(column, record->row) : nullptr;
+	}
+
+	bool ArchetypeStore::HasComponent(Entity entity, const TypeInfo* type) const
+	{
+		const Record* record = FindRecord(entity);
+
+		return (nullptr != record) && (nullptr != type) && record->archetype->GetTypeSet().Contains(type);
+	}
+
+	const Archetype* ArchetypeStore::GetArchetype(Entity entity) const
+	{
+		const Record* record = FindRecord(entity);
+
+		return (nullptr != record) ? record->archetype : nullptr;
+	}
+
+	size_t ArchetypeStore::GetArchetypeCount() const
+	{
+		return m_archetypes.size();
+	}
+
+	const Archetype& ArchetypeStore::GetArchetype(size_t index) const
+	{
+		return *m_archetypes[index];
+	}
+
+	const std::vector<Archetype*>& ArchetypeStore::Match(ArchetypeQuery& query) const
+	{
+		if (this != query.m_store)
+		{
+			query.Reset();
+			query.m_store = this;
+		}
+
+		for (; query.m_scanned < m_archetypes.size(); ++query.m_scanned)
+		{
+			Archetype* archetype = m_archetypes[query.m_scanned].get();
+
+			if (query.Matches(*archetype))
+			{
+				query.m_matches.push_back(archetype);
+			}
+		}
+
+		return query.m_matches;
+	}
+
+	ArchetypeStore::Record* ArchetypeStore::FindRecord(Entity entity)
+	{
+		if (m_records.size() <= entity.index)
+		{
+			return nullptr;
+		}
+
+		Record& record = m_records[entity.index];
+
+		return ((nullptr != record.archetype) && (record.generation == entity.generation)) ? &record : nullptr;
+	}
+
+	const ArchetypeStore::Record* ArchetypeStore::FindRecord(Entity entity) const
+	{
+		return const_cast<ArchetypeStore*>(this)->FindRecord(entity);
+	}
+
+	Archetype* ArchetypeStore::FindArchetype(std::vector<const TypeInfo*> types)
+	{
+		TypeSet typeSet;
+		for (const TypeInfo* type : types)
+		{
+			typeSet.Insert(type);
+		}
+
+		const auto found = m_archetypeMap.find(typeSet);
+		if (found != m_archetypeMap.end())
+		{
+			return found->second;
+		}
+
+		m_archetypes.push_back(std::make_unique<Archetype>(std::move(types)));
+
+		Archetype* archetype = m_archetypes.back().get();
+		m_archetypeMap.emplace(std::move(typeSet), archetype);
+
+		return archetype;
+	}
+
+	Archetype* ArchetypeStore::GetAddTarget(Archetype* source, const TypeInfo* type)
+	{
+		if (Archetype* target = FindEdge(source->m_addEdges, type->GetTypeId()))
+		{
+			return target;
+		}
+
+		std::vector<const TypeInfo*> types;
+		for (const Archetype::Column& column : source->m_columns)
+		{
+			types.push_back(column.type);
+		}
+
+		types.push_back(type);
+
+		Archetype* target = FindArchetype(std::move(types));
+		source->m_addEdges.emplace_back(type->GetTypeId(), target);
+		target->m_removeEdges.emplace_back(type->GetTypeId(), source);
+
+		return target;
+	}
+
+	Archetype* ArchetypeStore::GetRemoveTarget(Archetype* source, const TypeInfo* type)
+	{
+		if (Archetype* target = FindEdge(source->m_removeEdges, type->GetTypeId()))
+		{
+			return target;
+		}
+
+		std::vector<const TypeInfo*> types;
+		for (const Archetype::Column& column : source->m_columns)
+		{
+			if (column.type != type)
+			{
+				types.push_back(column.type);
+			}
+		}
+
+		Archetype* target = FindArchetype(std::move(types));
+		source->m_removeEdges.emplace_back(type->GetTypeId(), target);
+		target->m_addEdges.emplace_back(type->GetTypeId(), source);
+
+		return target;
+	}
+
+	void ArchetypeStore::MoveEntity(Entity entity, Record& record, Archetype* target)
+	{
+		Archetype* source = record.archetype;
+		const size_t sourceRow = record.row;
+		const size_t targetRow = target->AppendRow(entity);
+
+		size_t sourceIndex = 0;
+		size_t targetIndex = 0;
+		char* sourceData = source->LocateRow(sourceRow, sourceIndex);
+		char* targetData = target->LocateRow(targetRow, targetIndex);
+
+		for (size_t column = 0; column < source->m_columns.size(); ++column)
+		{
+			const size_t targetColumn = target->FindColumn(source->m_columns[column].type);
+			void* component = source->GetComponentAt(sourceData, sourceIndex, column);
+
+			if (targetColumn != target->GetColumnCount())
+			{
+				source->RelocateValue(column, target->GetComponentAt(targetData, targetIndex, targetColumn), component);
+			}
+			else
+			{
+				source->DestructValue(column, component);
+			}
+		}
+
+		const Entity moved = source->EraseRow(sourceRow);
+		if (moved.IsValid())
+		{
+			m_records[moved.index].row = static_cast<uint32_t>(sourceRow);
+		}
+
+		record.archetype = target;
+		record.row = static_cast<uint32_t>(targetRow);
+	}
+}
\ No newline at end of file
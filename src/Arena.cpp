@@ -0,0 +1,132 @@
+#include "Arena.h"
+
+#include <cstdlib>
+
+namespace Reflection
+{
+	namespace
+	{
+		inline size_t AlignUp(const size_t value, const size_t alignment)
+		{
+			return (value + alignment - 1) & ~(alignment - 1);
+		}
+	}
+
+	Arena::Arena(size_t blockSize)
+		: m_head(nullptr)
+		, m_finalizers(nullptr)
+		, m_blockSize(blockSize)
+		, m_usedBytes(0)
+		, m_reservedBytes(0)
+	{}
+
+	Arena::~Arena()
+	{
+		Reset();
+	}
+
+	void* Arena::Allocate(size_t size, size_t alignment)
+	{
+		if (0 == alignment)
+		{
+			alignment = alignof(std::max_align_t);
+		}
+
+		if (nullptr != m_head)
+		{
+			const uintptr_t base = reinterpret_cast<uintptr_t>(m_head + 1);
+			const uintptr_t address = AlignUp(base + m_head->used, alignment);
+			const size_t end = static_cast<size_t>(address - base) + size;
+
+			if (end <= m_head->size)
+			{
+				m_usedBytes += end - m_head->used;
+				m_head->used = end;
+
+				return reinterpret_cast<void*>(address);
+			}
+		}
+
+		Block* block = AllocateBlock(size + alignment);
+		if (nullptr == block)
+		{
+			return nullptr;
+		}
+
+		const uintptr_t base = reinterpret_cast<uintptr_t>(block + 1);
+		const uintptr_t address = AlignUp(base, alignment);
+
+		block->used = static_cast<size_t>(address - base) + size;
+		m_usedBytes += block->used;
+
+		return reinterpret_cast<void*>(address);
+	}
+
+	void Arena::AddFinalizer(void* object, Finalizer finalizer)
+	{
+		if ((nullptr == object) || (nullptr == finalizer))
+		{
+			return;
+		}
+
+		void* memory = Allocate(sizeof(FinalizerNode), alignof(FinalizerNode));
+		if (nullptr == memory)
+		{
+			return;
+		}
+
+		FinalizerNode* node = new (memory) FinalizerNode{ m_finalizers, object, finalizer };
+		m_finalizers = node;
+	}
+
+	void Arena::Reset()
+	{
+		FinalizerNode* node = m_finalizers;
+		while (nullptr != node)
+		{
+			node->finalizer(node->object);
+			node = node->next;
+		}
+
+		m_finalizers = nullptr;
+
+		Block* block = m_head;
+		while (nullptr != block)
+		{
+			Block* next = block->next;
+			std::free(block);
+			block = next;
+		}
+
+		m_head = nullptr;
+		m_usedBytes = 0;
+		m_reservedBytes = 0;
+	}
+
+	size_t Arena::GetUsedBytes() const
+	{
+		return m_usedBytes;
+	}
+
+	size_t Arena::GetReservedBytes() const
+	{
+		return m_reservedBytes;
+	}
+
+	Arena::Block* Arena::AllocateBlock(size_t minimumSize)
+	{
+		const size_t size = (minimumSize > m_blockSize) ? minimumSize : m_blockSize;
+
+		void* memory = std::malloc(sizeof(Block) + size);
+		if (nullptr == memory)
+		{
+			return nullptr;
+		}
+
+		Block* block = new (memory) Block{ m_head, size, 0 };
+		m_head = block;
+		m_reservedBytes += size;
+
+		return block;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,287 @@
+#include "JobSystem.h"
+
+#include <algorithm>
+
+namespace Reflection
+{
+	namespace
+	{
+		constexpr size_t NotWorker = static_cast<size_t>(-1);
+
+		thread_local size_t s_workerIndex = NotWorker;
+	}
+
+	JobSystem::JobSystem()
+		: m_queues()
+		, m_workers()
+		, m_pending(0)
+		, m_nextQueue(0)
+		, m_sleeping(0)
+		, m_sleepMutex()
+		, m_sleepCondition()
+		, m_stop(false)
+	{
+		const size_t hardware = static_cast<size_t>(std::thread::hardware_concurrency());
+		const size_t workerCount = std::max<size_t>(1, (1 < hardware) ? hardware - 1 : 1);
+
+		m_queues.reserve(workerCount);
+		for (size_t index = 0; index < workerCount; ++index)
+		{
+			m_queues.push_back(std::make_unique<LockFreeQueue<Job>>(QueueCapacity));
+		}
+
+		m_workers.reserve(workerCount);
+		for (size_t index = 0; index < workerCount; ++index)
+		{
+			m_workers.emplace_back([this, index]() { WorkerLoop(index); });
+		}
+	}
+
+	JobSystem::~JobSystem()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_sleepMutex);
+			m_stop = true;
+		}
+
+		m_sleepCondition.notify_all();
+
+		for (std::thread& worker : m_workers)
+		{
+			worker.join();
+		}
+	}
+
+	JobSystem& JobSystem::GetHandle()
+	{
+		static JobSystem jobSystem;
+		return jobSystem;
+	}
+
+	void JobSystem::Schedule(const Job& job)
+	{
+		const size_t queueIndex = (NotWorker != s_workerIndex)
+			? s_workerIndex
+			: m_nextQueue.fetch_add(1, std::memory_order_relaxed) % m_queues.size();
+
+		m_pending.fetch_add(1, std::memory_order_seq_cst);
+
+		if (!m_queues[queueIndex]->Push(job))
+		{
+			m_pending.fetch_sub(1, std::memory_order_relaxed);
+			Execute(job);
+			return;
+		}
+
+		// Pairs with the sleeping workers, which check m_pending after announcing themselves.
+		if (0 != m_sleeping.load(std::memory_order_seq_cst))
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_sleepMutex);
+			}
+
+			m_sleepCondition.notify_one();
+		}
+	}
+
+	void JobSystem::ParallelFor(size_t count, size_t grain, void* context, Job::RunFunc run)
+	{
+		if ((0 == count) || (nullptr == run))
+		{
+			return;
+		}
+
+		if (0 == grain)
+		{
+			const size_t chunks = (m_workers.size() + 1) * 4;
+			grain = std::max<size_t>(1, (count + chunks - 1) / chunks);
+		}
+
+		if (count <= grain)
+		{
+			run(context, 0, count);
+			return;
+		}
+
+		JobCounter counter;
+		counter.Add((count + grain - 1) / grain);
+
+		// The last chunk runs on the calling thread, the others are queued first so the workers start early.
+		const size_t lastFirst = ((count - 1) / grain) * grain;
+
+		for (size_t first = 0; first < lastFirst; first += grain)
+		{
+			Schedule({ run, context, first, first + grain, &counter });
+		}
+
+		Execute({ run, context, lastFirst, count, &counter });
+		Wait(counter);
+	}
+
+	void JobSystem::Wait(const JobCounter& counter)
+	{
+		while (!counter.IsDone())
+		{
+			if (!RunOne())
+			{
+				std::this_thread::yield();
+			}
+		}
+	}
+
+	bool JobSystem::RunOne()
+	{
+		const size_t start = (NotWorker != s_workerIndex) ? s_workerIndex : 0;
+
+		Job job;
+		if (!TakeJob(start, job))
+		{
+			return false;
+		}
+
+		Execute(job);
+		return true;
+	}
+
+	size_t JobSystem::GetWorkerCount() const
+	{
+		return m_workers.size();
+	}
+
+	bool JobSystem::IsWorkerThread() const
+	{
+		return NotWorker != s_workerIndex;
+	}
+
+	void JobSystem::WorkerLoop(size_t index)
+	{
+		s_workerIndex = index;
+
+		while (true)
+		{
+			Job job;
+			if (TakeJob(index, job))
+			{
+				Execute(job);
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(m_sleepMutex);
+
+			m_sleeping.fetch_add(1, std::memory_order_seq_cst);
+			m_sleepCondition.wait(lock, [this]()
+			{
+				return m_stop || (0 < m_pending.load(std::memory_order_seq_cst));
+			});
+			m_sleeping.fetch_sub(1, std::memory_order_relaxed);
+
+			if (m_stop)
+			{
+				return;
+			}
+		}
+	}
+
+	bool JobSystem::TakeJob(size_t start, Job& job)
+	{
+		if (m_pending.load(std::memory_order_relaxed) <= 0)
+		{
+			return false;
+		}
+
+		// The own queue first, then steal from the next ones.
+		const size_t queueCount = m_queues.size();
+		for (size_t offset = 0; offset < queueCount; ++offset)
+		{
+			if (m_queues[(start + offset) % queueCount]->Pop(job))
+			{
+				m_pending.fetch_sub(1, std::memory_order_relaxed);
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	void JobSystem::Execute(const Job& job)
+	{
+		job.run(job.context, job.first, job.last);
+
+		if (nullptr != job.counter)
+		{
+			job.counter->Done();
+		}
+	}
+
+	JobSerializer::JobSerializer()
+		: m_mutex()
+		, m_owner()
+		, m_queued()
+	{
+	}
+
+	bool JobSerializer::Enter(const Job& job)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		if (std::thread::id() != m_owner)
+		{
+			m_queued.push_back(job);
+			return false;
+		}
+
+		m_owner = std::this_thread::get_id();
+		return true;
+	}
+
+	bool JobSerializer::Acquire()
+	{
+		const std::thread::id self = std::this_thread::get_id();
+
+		while (true)
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+
+				if (self == m_owner)
+				{
+					return false;
+				}
+
+				if (std::thread::id() == m_owner)
+				{
+					m_owner = self;
+					return true;
+				}
+			}
+
+			if (!JobSystem::GetHandle().RunOne())
+			{
+				std::this_thread::yield();
+			}
+		}
+	}
+
+	void JobSerializer::Leave()
+	{
+		while (true)
+		{
+			Job job;
+
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+
+				if (m_queued.empty())
+				{
+					m_owner = std::thread::id();
+					return;
+				}
+
+				job = m_queued.front();
+				m_queued.pop_front();
+			}
+
+			job.run(job.context, job.first, job.last);
+		}
+	}
+}
@@ -32,8 +32,23 @@ namespace Reflection
 		return m_methodType;
 	}
 
-	const std::string& MethodInfo::GetMethodName() const
+	std::string_view MethodInfo::GetMethodName() const
 	{
 		return m_methodName;
 	}
+
+	MethodFlag MethodInfo::GetFlags() const
+	{
+		return m_flags;
+	}
+
+	bool MethodInfo::HasFlags(MethodFlag flags) const
+	{
+		return flags == (m_flags & flags);
+	}
+
+	size_t MethodInfo::GetMetadataBytes() const
+	{
+		return sizeof(MethodInfo) + ((nullptr != m_methodBase) ? m_methodBase->GetTypeInfo()->GetTypeSize() : 0);
+	}
 }
\ No newline at end of file
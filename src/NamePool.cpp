@@ -0,0 +1,147 @@
+#include "NamePool.h"
+
+#include "Utils.h"
+
+#include <cstring>
+#include <string>
+
+namespace Reflection
+{
+	NamePool::NamePool()
+		: m_arena(16 * 1024)
+		, m_slots()
+		, m_count(0)
+		, m_requestedBytes(0)
+		, m_mutex()
+	{}
+
+	NamePool::~NamePool() = default;
+
+	NamePool& NamePool::GetHandle()
+	{
+		static NamePool namePool;
+		return namePool;
+	}
+
+	std::string_view NamePool::Intern(std::string_view name)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		return InternLocked(name);
+	}
+
+	std::string_view NamePool::Intern(std::string_view scope, std::string_view name)
+	{
+		if (scope.empty())
+		{
+			return Intern(name);
+		}
+
+		// Joined on the stack : only unusually long names go through a temporary string.
+		char buffer[256];
+		std::string large;
+
+		const size_t size = scope.size() + 2 + name.size();
+		char* joined = buffer;
+
+		if (sizeof(buffer) < size)
+		{
+			large.resize(size);
+			joined = &large[0];
+		}
+
+		std::memcpy(joined, scope.data(), scope.size());
+		std::memcpy(joined + scope.size(), "::", 2);
+		std::memcpy(joined + scope.size() + 2, name.data(), name.size());
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		return InternLocked(std::string_view(joined, size));
+	}
+
+	size_t NamePool::GetNameCount() const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		return m_count;
+	}
+
+	size_t NamePool::GetRequestedBytes() const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		return m_requestedBytes;
+	}
+
+	size_t NamePool::GetReservedBytes() const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		return m_arena.GetReservedBytes() + m_slots.capacity() * sizeof(const Header*);
+	}
+
+	std::string_view NamePool::InternLocked(std::string_view name)
+	{
+		m_requestedBytes += name.size() + 1;
+
+		// Kept at most half full, so a probe sequence is short.
+		if (m_slots.size() <= m_count * 2)
+		{
+			Grow();
+		}
+
+		const uint32_t hash = static_cast<uint32_t>(Utils::HashBytes(name.data(), name.size(), 0));
+		const size_t mask = m_slots.size() - 1;
+
+		for (size_t slot = hash & mask; ; slot = (slot + 1) & mask)
+		{
+			const Header* header = m_slots[slot];
+
+			if (nullptr == header)
+			{
+				Header* stored = static_cast<Header*>(m_arena.Allocate(sizeof(Header) + name.size() + 1, alignof(Header)));
+				stored->size = static_cast<uint32_t>(name.size());
+				stored->hash = hash;
+
+				char* data = reinterpret_cast<char*>(stored + 1);
+				std::memcpy(data, name.data(), name.size());
+				data[name.size()] = '\0';
+
+				m_slots[slot] = stored;
+				++m_count;
+
+				return std::string_view(data, name.size());
+			}
+
+			const std::string_view interned(reinterpret_cast<const char*>(header + 1), header->size);
+			if ((hash == header->hash) && (name == interned))
+			{
+				return interned;
+			}
+		}
+	}
+
+	void NamePool::Grow()
+	{
+		std::vector<const Header*> slots(m_slots.empty() ? 256 : m_slots.size() * 2, nullptr);
+		const size_t mask = slots.size() - 1;
+
+		for (const Header* header : m_slots)
+		{
+			if (nullptr == header)
+			{
+				continue;
+			}
+
+			size_t slot = header->hash & mask;
+			while (nullptr != slots[slot])
+			{
+				slot = (slot + 1) & mask;
+			}
+
+			slots[slot] = header;
+		}
+
+		m_slots.swap(slots);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,98 @@
+#include "PointerMap.h"
+
+#include <algorithm>
+
+namespace Reflection
+{
+	PointerMap::PointerMap(size_t count)
+		: m_keys()
+		, m_values()
+		, m_size(0)
+		, m_mask(0)
+		, m_shift(64)
+	{
+		Reserve(count);
+	}
+
+	bool PointerMap::Find(const void* pointer, uint32_t& value) const
+	{
+		if (m_keys.empty())
+		{
+			return false;
+		}
+
+		const uintptr_t key = reinterpret_cast<uintptr_t>(pointer);
+		for (size_t slot = GetSlot(key); 0 != m_keys[slot]; slot = (slot + 1) & m_mask)
+		{
+			if (key == m_keys[slot])
+			{
+				value = m_values[slot];
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	void PointerMap::Reserve(size_t count)
+	{
+		size_t capacity = 16;
+		while (capacity < count * 2 + 1)
+		{
+			capacity *= 2;
+		}
+
+		if (m_keys.size() < capacity)
+		{
+			Rehash(capacity);
+		}
+	}
+
+	void PointerMap::Clear()
+	{
+		std::fill(m_keys.begin(), m_keys.end(), 0);
+		m_size = 0;
+	}
+
+	size_t PointerMap::GetSize() const
+	{
+		return m_size;
+	}
+
+	void PointerMap::Grow()
+	{
+		Rehash(m_keys.empty() ? 16 : m_keys.size() * 2);
+	}
+
+	void PointerMap::Rehash(size_t capacity)
+	{
+		std::vector<uintptr_t> keys(capacity, 0);
+		std::vector<uint32_t> values(capacity, 0);
+		keys.swap(m_keys);
+		values.swap(m_values);
+
+		m_mask = capacity - 1;
+		m_shift = 64;
+		for (size_t bits = capacity; 1 < bits; bits >>= 1)
+		{
+			--m_shift;
+		}
+
+		for (size_t index = 0; index < keys.size(); ++index)
+		{
+			if (0 == keys[index])
+			{
+				continue;
+			}
+
+			size_t slot = GetSlot(keys[index]);
+			while (0 != m_keys[slot])
+			{
+				slot = (slot + 1) & m_mask;
+			}
+
+			m_keys[slot] = keys[index];
+			m_values[slot] = values[index];
+		}
+	}
+}
\ No newline at end of file
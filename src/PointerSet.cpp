@@ -0,0 +1,93 @@
+#include "PointerSet.h"
+
+#include <algorithm>
+
+namespace Reflection
+{
+	PointerSet::PointerSet(size_t count)
+		: m_slots()
+		, m_size(0)
+		, m_mask(0)
+		, m_shift(64)
+	{
+		Reserve(count);
+	}
+
+	bool PointerSet::Contains(const void* pointer) const
+	{
+		if (m_slots.empty())
+		{
+			return false;
+		}
+
+		const uintptr_t key = reinterpret_cast<uintptr_t>(pointer);
+		for (size_t slot = GetSlot(key); 0 != m_slots[slot]; slot = (slot + 1) & m_mask)
+		{
+			if (key == m_slots[slot])
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	void PointerSet::Reserve(size_t count)
+	{
+		size_t capacity = 16;
+		while (capacity < count * 2 + 1)
+		{
+			capacity *= 2;
+		}
+
+		if (m_slots.size() < capacity)
+		{
+			Rehash(capacity);
+		}
+	}
+
+	void PointerSet::Clear()
+	{
+		std::fill(m_slots.begin(), m_slots.end(), 0);
+		m_size = 0;
+	}
+
+	size_t PointerSet::GetSize() const
+	{
+		return m_size;
+	}
+
+	void PointerSet::Grow()
+	{
+		Rehash(m_slots.empty() ? 16 : m_slots.size() * 2);
+	}
+
+	void PointerSet::Rehash(size_t capacity)
+	{
+		std::vector<uintptr_t> slots(capacity, 0);
+		slots.swap(m_slots);
+
+		m_mask = capacity - 1;
+		m_shift = 64;
+		for (size_t bits = capacity; 1 < bits; bits >>= 1)
+		{
+			--m_shift;
+		}
+
+		for (const uintptr_t key : slots)
+		{
+			if (0 == key)
+			{
+				continue;
+			}
+
+			size_t slot = GetSlot(key);
+			while (0 != m_slots[slot])
+			{
+				slot = (slot + 1) & m_mask;
+			}
+
+			m_slots[slot] = key;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,557 @@
+#include "Property/ContainerPropertyInfo.h"
+
+#include <cstring>
+#include <memory>
+
+namespace Reflection
+{
+	namespace
+	{
+		/**
+		 * @brief	Erases the elements of the container whose key is missing from the source.
+		 * @details	The keys are copied first, as erasing invalidates the iteration of the container.
+		 * @return	bool False if the keys cannot be copied or erased.
+		 */
+		template<typename GetKey>
+		bool EraseMissing(const ContainerPropertyInfo* info, const TypeInfo* keyType, void* container, const void* source, size_t removed, GetKey getKey)
+		{
+			if (0 == removed)
+			{
+				return true;
+			}
+
+			if (!info->CanErase() || !keyType->IsCopyable())
+			{
+				return false;
+			}
+
+			const size_t keySize = keyType->GetTypeSize();
+			std::unique_ptr<char[]> keys(new char[removed * keySize + 1]);
+			size_t count = 0;
+
+			auto itr = info->begin(container);
+			auto endItr = info->end(container);
+			for (; (itr != endItr) && (count < removed); ++itr)
+			{
+				const void* key = getKey(itr.get());
+
+				if (nullptr == info->Find(source, key))
+				{
+					keyType->CopyConstruct(keys.get() + count * keySize, key);
+					++count;
+				}
+			}
+
+			for (size_t index = 0; index < count; ++index)
+			{
+				void* key = keys.get() + index * keySize;
+
+				info->Erase(container, key);
+				keyType->Destruct(key);
+			}
+
+			return true;
+		}
+	}
+
+	size_t ContainerPropertyInfo::GetSize(const void* container) const
+	{
+		if (nullptr != m_operations->sizeFunc)
+		{
+			return m_operations->sizeFunc(container);
+		}
+
+		size_t size = 0;
+
+		auto itr = begin(container);
+		auto endItr = end(container);
+		for (; itr != endItr; ++itr)
+		{
+			++size;
+		}
+
+		return size;
+	}
+
+	const void* ContainerPropertyInfo::GetData(const void* container) const
+	{
+		if (nullptr != m_operations->dataFunc)
+		{
+			return m_operations->dataFunc(container);
+		}
+
+		return nullptr;
+	}
+
+	const void* ContainerPropertyInfo::Find(const void* container, const void* key) const
+	{
+		if (nullptr != m_operations->findFunc)
+		{
+			return m_operations->findFunc(container, key);
+		}
+
+		return nullptr;
+	}
+
+	bool ContainerPropertyInfo::Clear(void* container) const
+	{
+		if (nullptr != m_operations->clearFunc)
+		{
+			m_operations->clearFunc(container);
+			return true;
+		}
+
+		return false;
+	}
+
+	void ContainerPropertyInfo::Reserve(void* container, size_t size) const
+	{
+		if (nullptr != m_operations->reserveFunc)
+		{
+			m_operations->reserveFunc(container, size);
+		}
+	}
+
+	void* ContainerPropertyInfo::Insert(void* container, const void* element) const
+	{
+		if (nullptr != m_operations->insertFunc)
+		{
+			return m_operations->insertFunc(container, element);
+		}
+
+		return nullptr;
+	}
+
+	bool ContainerPropertyInfo::Erase(void* container, const void* key) const
+	{
+		if (nullptr != m_operations->eraseFunc)
+		{
+			m_operations->eraseFunc(container, key);
+			return true;
+		}
+
+		return false;
+	}
+
+	bool ContainerPropertyInfo::Resize(void* container, size_t size) const
+	{
+		if (nullptr != m_operations->resizeFunc)
+		{
+			m_operations->resizeFunc(container, size);
+			return true;
+		}
+
+		return false;
+	}
+
+	void ContainerPropertyInfo::Assign(void* container, const void* source) const
+	{
+		GetPropertyType()->CopyAssign(container, source);
+	}
+
+	const PropertyInfo* ArrayPropertyInfo::Rebase(const TypeInfo* ownerType, size_t baseOffset) const
+	{
+		return new ArrayPropertyInfo(*this, ownerType, baseOffset);
+	}
+
+	bool ArrayPropertyInfo::Equals(const void* lhs, const void* rhs) const
+	{
+		const size_t size = GetSize(lhs);
+		if (size != GetSize(rhs))
+		{
+			return false;
+		}
+
+		const void* lhsData = GetData(lhs);
+		const void* rhsData = GetData(rhs);
+
+		if ((nullptr != lhsData) && (nullptr != rhsData) && m_valueType->IsBitwiseComparable())
+		{
+			return (0 == size) || (0 == std::memcmp(lhsData, rhsData, size * m_valueType->GetTypeSize()));
+		}
+
+		auto lhsItr = begin(lhs);
+		auto lhsEnd = end(lhs);
+		auto rhsItr = begin(rhs);
+
+		for (; lhsItr != lhsEnd; ++lhsItr, ++rhsItr)
+		{
+			if (!m_valueType->Equals(lhsItr.get(), rhsItr.get()))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	size_t ArrayPropertyInfo::Hash(const void* container, size_t seed) const
+	{
+		const size_t size = GetSize(container);
+		seed = Utils::HashCombine(seed, size);
+
+		const void* data = GetData(container);
+
+		if ((nullptr != data) && m_valueType->IsBitwiseComparable())
+		{
+			return (0 == size) ? seed : Utils::HashBytes(data, size * m_valueType->GetTypeSize(), seed);
+		}
+
+		auto itr = begin(container);
+		auto endItr = end(container);
+		for (; itr != endItr; ++itr)
+		{
+			seed = m_valueType->Hash(itr.get(), seed);
+		}
+
+		return seed;
+	}
+
+	bool ArrayPropertyInfo::Diff(const void* lhs, const void* rhs, ElementDelta& delta) const
+	{
+		const size_t lhsSize = GetSize(lhs);
+		const size_t rhsSize = GetSize(rhs);
+		const size_t common = (lhsSize < rhsSize) ? lhsSize : rhsSize;
+
+		delta.size = rhsSize;
+
+		const char* lhsData = static_cast<const char*>(GetData(lhs));
+		const char* rhsData = static_cast<const char*>(GetData(rhs));
+
+		if ((nullptr != lhsData) && (nullptr != rhsData) && m_valueType->IsBitwiseComparable())
+		{
+			const size_t stride = m_valueType->GetTypeSize();
+
+			if ((0 != common) && (0 != std::memcmp(lhsData, rhsData, common * stride)))
+			{
+				for (size_t index = 0; index < common; ++index)
+				{
+					if (0 != std::memcmp(lhsData + index * stride, rhsData + index * stride, stride))
+					{
+						delta.indices.push_back(index);
+					}
+				}
+			}
+		}
+		else
+		{
+			auto lhsItr = begin(lhs);
+			auto rhsItr = begin(rhs);
+
+			for (size_t index = 0; index < common; ++index, ++lhsItr, ++rhsItr)
+			{
+				if (!m_valueType->Equals(lhsItr.get(), rhsItr.get()))
+				{
+					delta.indices.push_back(index);
+				}
+			}
+		}
+
+		return (lhsSize != rhsSize) || !delta.indices.empty();
+	}
+
+	void ArrayPropertyInfo::ApplyDiff(void* container, const void* source, const ElementDelta& delta) const
+	{
+		const size_t size = GetSize(container);
+
+		if (delta.full
+			|| ((delta.size < size) && !Resize(container, delta.size))
+			|| ((delta.size > size) && !CanInsert()))
+		{
+			Assign(container, source);
+			return;
+		}
+
+		if (!delta.indices.empty())
+		{
+			char* data = const_cast<char*>(static_cast<const char*>(GetData(container)));
+			const char* sourceData = static_cast<const char*>(GetData(source));
+
+			if ((nullptr != data) && (nullptr != sourceData))
+			{
+				const size_t stride = m_valueType->GetTypeSize();
+
+				for (const size_t index : delta.indices)
+				{
+					m_valueType->CopyAssign(data + index * stride, sourceData + index * stride);
+				}
+			}
+			else
+			{
+				auto itr = begin(container);
+				auto sourceItr = begin(source);
+				size_t position = 0;
+
+				for (const size_t index : delta.indices)
+				{
+					for (; position < index; ++position, ++itr, ++sourceItr) {}
+
+					m_valueType->CopyAssign(const_cast<void*>(itr.get()), sourceItr.get());
+				}
+			}
+		}
+
+		if (delta.size > size)
+		{
+			Reserve(container, delta.size);
+
+			auto sourceItr = begin(source);
+			size_t position = 0;
+
+			for (; position < size; ++position, ++sourceItr) {}
+
+			for (; position < delta.size; ++position, ++sourceItr)
+			{
+				Insert(container, sourceItr.get());
+			}
+		}
+	}
+
+	const PropertyInfo* SetPropertyInfo::Rebase(const TypeInfo* ownerType, size_t baseOffset) const
+	{
+		return new SetPropertyInfo(*this, ownerType, baseOffset);
+	}
+
+	bool SetPropertyInfo::Equals(const void* lhs, const void* rhs) const
+	{
+		if (GetSize(lhs) != GetSize(rhs))
+		{
+			return false;
+		}
+
+		auto lhsItr = begin(lhs);
+		auto lhsEnd = end(lhs);
+
+		if (HasFind())
+		{
+			for (; lhsItr != lhsEnd; ++lhsItr)
+			{
+				if (nullptr == Find(rhs, lhsItr.get()))
+				{
+					return false;
+				}
+			}
+		}
+		else
+		{
+			auto rhsItr = begin(rhs);
+			for (; lhsItr != lhsEnd; ++lhsItr, ++rhsItr)
+			{
+				if (!m_valueType->Equals(lhsItr.get(), rhsItr.get()))
+				{
+					return false;
+				}
+			}
+		}
+
+		return true;
+	}
+
+	size_t SetPropertyInfo::Hash(const void* container, size_t seed) const
+	{
+		size_t elementHash = 0;
+
+		auto itr = begin(container);
+		auto endItr = end(container);
+		for (; itr != endItr; ++itr)
+		{
+			elementHash += m_valueType->Hash(itr.get(), 0);
+		}
+
+		seed = Utils::HashCombine(seed, GetSize(container));
+
+		return Utils::HashCombine(seed, elementHash);
+	}
+
+	bool SetPropertyInfo::Diff(const void* lhs, const void* rhs, ElementDelta& delta) const
+	{
+		delta.size = GetSize(rhs);
+
+		if (!HasFind())
+		{
+			delta.full = !Equals(lhs, rhs);
+			return delta.full;
+		}
+
+		size_t index = 0;
+
+		auto itr = begin(rhs);
+		auto endItr = end(rhs);
+		for (; itr != endItr; ++itr, ++index)
+		{
+			if (nullptr == Find(lhs, itr.get()))
+			{
+				delta.indices.push_back(index);
+			}
+		}
+
+		delta.removed = GetSize(lhs) - (delta.size - delta.indices.size());
+
+		return (0 != delta.removed) || !delta.indices.empty();
+	}
+
+	void SetPropertyInfo::ApplyDiff(void* container, const void* source, const ElementDelta& delta) const
+	{
+		if (delta.full || (!delta.indices.empty() && !CanInsert()))
+		{
+			Assign(container, source);
+			return;
+		}
+
+		if (!EraseMissing(this, m_keyType, container, source, delta.removed, [](const void* element) { return element; }))
+		{
+			Assign(container, source);
+			return;
+		}
+
+		auto sourceItr = begin(source);
+		size_t position = 0;
+
+		for (const size_t index : delta.indices)
+		{
+			for (; position < index; ++position, ++sourceItr) {}
+
+			Insert(container, sourceItr.get());
+		}
+	}
+
+	const PropertyInfo* MapPropertyInfo::Rebase(const TypeInfo* ownerType, size_t baseOffset) const
+	{
+		return new MapPropertyInfo(*this, ownerType, baseOffset);
+	}
+
+	bool MapPropertyInfo::Equals(const void* lhs, const void* rhs) const
+	{
+		if (GetSize(lhs) != GetSize(rhs))
+		{
+			return false;
+		}
+
+		auto lhsItr = begin(lhs);
+		auto lhsEnd = end(lhs);
+
+		if (HasFind())
+		{
+			for (; lhsItr != lhsEnd; ++lhsItr)
+			{
+				const void* lhsValue = lhsItr.get();
+				const void* rhsValue = Find(rhs, GetRawKey(lhsValue));
+
+				if ((nullptr == rhsValue) || !m_mappedType->Equals(GetRawMapped(lhsValue), GetRawMapped(rhsValue)))
+				{
+					return false;
+				}
+			}
+		}
+		else
+		{
+			auto rhsItr = begin(rhs);
+			for (; lhsItr != lhsEnd; ++lhsItr, ++rhsItr)
+			{
+				const void* lhsValue = lhsItr.get();
+				const void* rhsValue = rhsItr.get();
+
+				if (!m_keyType->Equals(GetRawKey(lhsValue), GetRawKey(rhsValue))
+					|| !m_mappedType->Equals(GetRawMapped(lhsValue), GetRawMapped(rhsValue)))
+				{
+					return false;
+				}
+			}
+		}
+
+		return true;
+	}
+
+	size_t MapPropertyInfo::Hash(const void* container, size_t seed) const
+	{
+		size_t elementHash = 0;
+
+		auto itr = begin(container);
+		auto endItr = end(container);
+		for (; itr != endItr; ++itr)
+		{
+			const void* value = itr.get();
+
+			elementHash += Utils::HashCombine(m_keyType->Hash(GetRawKey(value), 0), m_mappedType->Hash(GetRawMapped(value), 0));
+		}
+
+		seed = Utils::HashCombine(seed, GetSize(container));
+
+		return Utils::HashCombine(seed, elementHash);
+	}
+
+	bool MapPropertyInfo::Diff(const void* lhs, const void* rhs, ElementDelta& delta) const
+	{
+		delta.size = GetSize(rhs);
+
+		if (!HasFind())
+		{
+			delta.full = !Equals(lhs, rhs);
+			return delta.full;
+		}
+
+		size_t index = 0;
+		size_t common = 0;
+
+		auto itr = begin(rhs);
+		auto endItr = end(rhs);
+		for (; itr != endItr; ++itr, ++index)
+		{
+			const void* rhsValue = itr.get();
+			const void* lhsValue = Find(lhs, GetRawKey(rhsValue));
+
+			if (nullptr == lhsValue)
+			{
+				delta.indices.push_back(index);
+				continue;
+			}
+
+			++common;
+
+			if (!m_mappedType->Equals(GetRawMapped(lhsValue), GetRawMapped(rhsValue)))
+			{
+				delta.indices.push_back(index);
+			}
+		}
+
+		delta.removed = GetSize(lhs) - common;
+
+		return (0 != delta.removed) || !delta.indices.empty();
+	}
+
+	void MapPropertyInfo::ApplyDiff(void* container, const void* source, const ElementDelta& delta) const
+	{
+		if (delta.full)
+		{
+			Assign(container, source);
+			return;
+		}
+
+		if (!EraseMissing(this, m_keyType, container, source, delta.removed, [this](const void* element) { return GetRawKey(element); }))
+		{
+			Assign(container, source);
+			return;
+		}
+
+		auto sourceItr = begin(source);
+		size_t position = 0;
+
+		for (const size_t index : delta.indices)
+		{
+			for (; position < index; ++position, ++sourceItr) {}
+
+			const void* sourceValue = sourceItr.get();
+			const void* value = Find(container, GetRawKey(sourceValue));
+
+			if (nullptr != value)
+			{
+				m_mappedType->CopyAssign(const_cast<void*>(GetRawMapped(value)), GetRawMapped(sourceValue));
+			}
+			else if (nullptr == Insert(container, sourceValue))
+			{
+				Assign(container, source);
+				return;
+			}
+		}
+	}
+}
\ No newline at end of file
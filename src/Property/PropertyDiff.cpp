@@ -0,0 +1,164 @@
+#include "Property/PropertyDiff.h"
+
+#include "Type/TypeInfo.h"
+
+#include <new>
+
+namespace Reflection
+{
+	PropertyDiff::PropertyDiff()
+		: m_mask()
+		, m_elements()
+		, m_elementCount(0)
+		, m_values()
+		, m_valueCount(0)
+		, m_buffer(nullptr)
+		, m_bufferSize(0)
+		, m_bufferAlignment(0)
+		, m_valueBytes(0)
+		, m_valueAlignment(1)
+	{}
+
+	PropertyDiff::~PropertyDiff()
+	{
+		Release();
+	}
+
+	PropertyDiff::PropertyDiff(PropertyDiff&& other) noexcept
+		: m_mask(std::move(other.m_mask))
+		, m_elements(std::move(other.m_elements))
+		, m_elementCount(other.m_elementCount)
+		, m_values(std::move(other.m_values))
+		, m_valueCount(other.m_valueCount)
+		, m_buffer(other.m_buffer)
+		, m_bufferSize(other.m_bufferSize)
+		, m_bufferAlignment(other.m_bufferAlignment)
+		, m_valueBytes(other.m_valueBytes)
+		, m_valueAlignment(other.m_valueAlignment)
+	{
+		other.m_elementCount = 0;
+		other.m_valueCount = 0;
+		other.m_buffer = nullptr;
+		other.m_bufferSize = 0;
+		other.m_bufferAlignment = 0;
+		other.m_valueBytes = 0;
+		other.m_valueAlignment = 1;
+	}
+
+	PropertyDiff& PropertyDiff::operator=(PropertyDiff&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Release();
+
+			m_mask = std::move(other.m_mask);
+			m_elements = std::move(other.m_elements);
+			m_elementCount = other.m_elementCount;
+			m_values = std::move(other.m_values);
+			m_valueCount = other.m_valueCount;
+			m_buffer = other.m_buffer;
+			m_bufferSize = other.m_bufferSize;
+			m_bufferAlignment = other.m_bufferAlignment;
+			m_valueBytes = other.m_valueBytes;
+			m_valueAlignment = other.m_valueAlignment;
+
+			other.m_elementCount = 0;
+			other.m_valueCount = 0;
+			other.m_buffer = nullptr;
+			other.m_bufferSize = 0;
+			other.m_bufferAlignment = 0;
+			other.m_valueBytes = 0;
+			other.m_valueAlignment = 1;
+		}
+
+		return *this;
+	}
+
+	const void* PropertyDiff::GetValue(size_t index) const
+	{
+		if ((index >= m_valueCount) || !m_values[index].stored)
+		{
+			return nullptr;
+		}
+
+		return static_cast<const char*>(m_buffer) + m_values[index].offset;
+	}
+
+	void PropertyDiff::Clear()
+	{
+		for (size_t index = 0; index < m_valueCount; ++index)
+		{
+			PropertyValue& value = m_values[index];
+
+			if (value.stored)
+			{
+				value.type->Destruct(static_cast<char*>(m_buffer) + value.offset);
+				value.stored = false;
+			}
+		}
+
+		m_mask.Clear();
+		m_elementCount = 0;
+		m_valueCount = 0;
+		m_valueBytes = 0;
+		m_valueAlignment = 1;
+	}
+
+	void PropertyDiff::AddValue(size_t ordinal, const TypeInfo* type)
+	{
+		const size_t alignment = type->GetTypeAlignment();
+		const size_t offset = (m_valueBytes + alignment - 1) & ~(alignment - 1);
+
+		if (m_valueCount == m_values.size())
+		{
+			m_values.emplace_back();
+		}
+
+		m_values[m_valueCount++] = { ordinal, type, offset, false };
+
+		m_valueBytes = offset + type->GetTypeSize();
+		m_valueAlignment = (alignment > m_valueAlignment) ? alignment : m_valueAlignment;
+	}
+
+	bool PropertyDiff::StoreValue(size_t index, const void* source)
+	{
+		if ((index >= m_valueCount) || (nullptr == source))
+		{
+			return false;
+		}
+
+		// Every value is added before the first one is stored, so the buffer only grows while it holds no value.
+		if ((m_bufferSize < m_valueBytes) || (m_bufferAlignment < m_valueAlignment))
+		{
+			const size_t alignment = (m_valueAlignment > alignof(std::max_align_t)) ? m_valueAlignment : alignof(std::max_align_t);
+
+			if (nullptr != m_buffer)
+			{
+				::operator delete(m_buffer, std::align_val_t(m_bufferAlignment));
+			}
+
+			m_buffer = ::operator new(m_valueBytes, std::align_val_t(alignment));
+			m_bufferSize = m_valueBytes;
+			m_bufferAlignment = alignment;
+		}
+
+		PropertyValue& value = m_values[index];
+		value.stored = value.type->CopyConstruct(static_cast<char*>(m_buffer) + value.offset, source);
+
+		return value.stored;
+	}
+
+	void PropertyDiff::Release()
+	{
+		Clear();
+
+		if (nullptr != m_buffer)
+		{
+			::operator delete(m_buffer, std::align_val_t(m_bufferAlignment));
+		}
+
+		m_buffer = nullptr;
+		m_bufferSize = 0;
+		m_bufferAlignment = 0;
+	}
+}
@@ -1,4 +1,6 @@
 #include "Property/PropertyInfo.h"
+#include "Property/PropertyMask.h"
+#include "Property/PropertyObserver.h"
 
 namespace Reflection
 {
@@ -26,7 +28,7 @@ namespace Reflection
 		}
 	}
 
-	const std::string& PropertyInfo::GetPropertyName() const
+	std::string_view PropertyInfo::GetPropertyName() const
 	{
 		return m_propertyName;
 	}
@@ -36,6 +38,56 @@ namespace Reflection
 		return m_propertyOffset;
 	}
 
+	size_t PropertyInfo::GetPropertyOrdinal() const
+	{
+		return m_propertyOrdinal;
+	}
+
+	void PropertyInfo::EnableHooks(uint8_t hooks) const
+	{
+		m_hooks.fetch_or(hooks, std::memory_order_relaxed);
+	}
+
+	void PropertyInfo::DisableHooks(uint8_t hooks) const
+	{
+		m_hooks.fetch_and(static_cast<uint8_t>(~hooks), std::memory_order_relaxed);
+	}
+
+	uint8_t PropertyInfo::GetHooks() const
+	{
+		return m_hooks.load(std::memory_order_relaxed);
+	}
+
+	void PropertyInfo::OnWrite(void* instance) const
+	{
+		const uint8_t hooks = m_hooks.load(std::memory_order_relaxed);
+
+		// The owner is tracked, and the mask of a derived instance is at the same address, so no runtime type is needed.
+		if (0 != (hooks & HookDirty))
+		{
+			PropertyMask* mask = m_ownerType->GetDirtyMask(instance);
+			if (nullptr != mask)
+			{
+				mask->SetAtomic(m_propertyOrdinal);
+			}
+		}
+
+		if (0 != (hooks & HookObserve))
+		{
+			ObserverManager::GetHandle().Push({ instance, this, m_ownerType->GetRuntimeType(instance) });
+		}
+	}
+
+	size_t PropertyInfo::Subscribe(std::function<void(const PropertyChange* changes, size_t count)> observer) const
+	{
+		return ObserverManager::GetHandle().Subscribe(this, std::move(observer));
+	}
+
+	void PropertyInfo::Unsubscribe(size_t handle) const
+	{
+		ObserverManager::GetHandle().Unsubscribe(handle);
+	}
+
 	const TypeInfo* PropertyInfo::GetOwnerType() const
 	{
 		return m_ownerType;
@@ -45,4 +97,36 @@ namespace Reflection
 	{
 		return m_propertyType;
 	}
+
+	PropertyFlag PropertyInfo::GetFlags() const
+	{
+		return m_flags;
+	}
+
+	bool PropertyInfo::HasFlags(PropertyFlag flags) const
+	{
+		return flags == (m_flags & flags);
+	}
+
+	PropertyInfo::PropertyInfo(const PropertyInfo& other, const TypeInfo* ownerType, size_t baseOffset)
+		: m_propertyName(other.m_propertyName)
+		, m_propertyOffset(baseOffset + other.m_propertyOffset)
+		, m_propertyType(other.m_propertyType)
+		, m_ownerType(ownerType)
+		, m_propertyAssigner(other.m_propertyAssigner)
+		, m_propertyOrdinal(ownerType->GetPropertyList().size())
+		, m_hooks(HookNone)
+		, m_flags(other.m_flags)
+	{
+	}
+
+	const PropertyInfo* PropertyInfo::Rebase(const TypeInfo* ownerType, size_t baseOffset) const
+	{
+		return new PropertyInfo(*this, ownerType, baseOffset);
+	}
+
+	size_t PropertyInfo::GetMetadataBytes() const
+	{
+		return GetTypeInfo()->GetTypeSize();
+	}
 }
\ No newline at end of file
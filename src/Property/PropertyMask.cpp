@@ -0,0 +1,168 @@
+#include "Property/PropertyMask.h"
+
+namespace Reflection
+{
+	PropertyMask::PropertyMask()
+		: m_inline{}
+		, m_overflow()
+	{}
+
+	void PropertyMask::Set(size_t ordinal)
+	{
+		const uint64_t bit = uint64_t(1) << (ordinal % WordBits);
+
+		if (ordinal < InlineBits)
+		{
+			m_inline[ordinal / WordBits] |= bit;
+			return;
+		}
+
+		const size_t index = (ordinal - InlineBits) / WordBits;
+		if (index >= m_overflow.size())
+		{
+			m_overflow.resize(index + 1, 0);
+		}
+
+		m_overflow[index] |= bit;
+	}
+
+	void PropertyMask::SetAtomic(size_t ordinal)
+	{
+		if (ordinal < InlineBits)
+		{
+			Utils::AtomicOr(m_inline[ordinal / WordBits], uint64_t(1) << (ordinal % WordBits));
+			return;
+		}
+
+		Set(ordinal);
+	}
+
+	void PropertyMask::Reset(size_t ordinal)
+	{
+		const uint64_t bit = uint64_t(1) << (ordinal % WordBits);
+
+		if (ordinal < InlineBits)
+		{
+			m_inline[ordinal / WordBits] &= ~bit;
+			return;
+		}
+
+		const size_t index = (ordinal - InlineBits) / WordBits;
+		if (index < m_overflow.size())
+		{
+			m_overflow[index] &= ~bit;
+		}
+	}
+
+	bool PropertyMask::Test(size_t ordinal) const
+	{
+		const uint64_t bit = uint64_t(1) << (ordinal % WordBits);
+
+		if (ordinal < InlineBits)
+		{
+			return 0 != (m_inline[ordinal / WordBits] & bit);
+		}
+
+		const size_t index = (ordinal - InlineBits) / WordBits;
+
+		return (index < m_overflow.size()) && (0 != (m_overflow[index] & bit));
+	}
+
+	bool PropertyMask::Any() const
+	{
+		uint64_t bits = 0;
+
+		for (const uint64_t word : m_inline)
+		{
+			bits |= word;
+		}
+
+		for (const uint64_t word : m_overflow)
+		{
+			bits |= word;
+		}
+
+		return 0 != bits;
+	}
+
+	size_t PropertyMask::Count() const
+	{
+		size_t count = 0;
+
+		for (const uint64_t word : m_inline)
+		{
+			count += Utils::PopCount(word);
+		}
+
+		for (const uint64_t word : m_overflow)
+		{
+			count += Utils::PopCount(word);
+		}
+
+		return count;
+	}
+
+	void PropertyMask::Clear()
+	{
+		for (uint64_t& word : m_inline)
+		{
+			word = 0;
+		}
+
+		for (uint64_t& word : m_overflow)
+		{
+			word = 0;
+		}
+	}
+
+	PropertyMask& PropertyMask::operator|=(const PropertyMask& other)
+	{
+		for (size_t index = 0; index < InlineWords; ++index)
+		{
+			m_inline[index] |= other.m_inline[index];
+		}
+
+		if (m_overflow.size() < other.m_overflow.size())
+		{
+			m_overflow.resize(other.m_overflow.size(), 0);
+		}
+
+		for (size_t index = 0; index < other.m_overflow.size(); ++index)
+		{
+			m_overflow[index] |= other.m_overflow[index];
+		}
+
+		return *this;
+	}
+
+	bool PropertyMask::operator==(const PropertyMask& other) const
+	{
+		for (size_t index = 0; index < InlineWords; ++index)
+		{
+			if (m_inline[index] != other.m_inline[index])
+			{
+				return false;
+			}
+		}
+
+		const size_t size = (m_overflow.size() > other.m_overflow.size()) ? m_overflow.size() : other.m_overflow.size();
+
+		for (size_t index = 0; index < size; ++index)
+		{
+			const uint64_t lhs = (index < m_overflow.size()) ? m_overflow[index] : 0;
+			const uint64_t rhs = (index < other.m_overflow.size()) ? other.m_overflow[index] : 0;
+
+			if (lhs != rhs)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	bool PropertyMask::operator!=(const PropertyMask& other) const
+	{
+		return !(*this == other);
+	}
+}
\ No newline at end of file
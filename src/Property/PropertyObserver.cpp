@@ -0,0 +1,379 @@
+#include "Property/PropertyObserver.h"
+
+#include "Property/PropertyInfo.h"
+#include "Type/TypeInfo.h"
+#include "Type/TypeCast.h"
+#include "Type/TypeManager.h"
+
+#include <algorithm>
+#include <functional>
+#include <thread>
+
+namespace Reflection
+{
+	namespace
+	{
+		// The flushes delivering on this thread, so an unregistration does not wait for its own thread.
+		thread_local size_t s_deliveryDepth = 0;
+	}
+
+	ObserverManager::ObserverManager()
+		: m_queue(DefaultQueueCapacity)
+		, m_overflowMutex()
+		, m_overflow()
+		, m_observerMutex()
+		, m_observers(std::make_shared<const ObserverList>())
+		, m_observedCounts()
+		, m_nextHandle(InvalidHandle)
+		, m_flushMutex()
+		, m_changes()
+		, m_batch()
+		, m_deliveries(0)
+	{
+		TypeManager::GetHandle().AddUnregistListener(&ObserverManager::OnUnregist);
+	}
+
+	ObserverManager::~ObserverManager()
+	{
+		m_observers.reset();
+	}
+
+	ObserverManager& ObserverManager::GetHandle()
+	{
+		static ObserverManager observerManager;
+		return observerManager;
+	}
+
+	ObserverManager::ObserverHandle ObserverManager::Subscribe(const PropertyInfo* property, ObserverFunc observer)
+	{
+		if ((nullptr == property) || !observer)
+		{
+			return InvalidHandle;
+		}
+
+		std::lock_guard<std::mutex> lock(m_observerMutex);
+
+		std::shared_ptr<ObserverList> observers = std::make_shared<ObserverList>(*m_observers);
+		observers->push_back({ ++m_nextHandle, property, nullptr, std::move(observer) });
+		AddHooks(observers->back());
+
+		m_observers = std::move(observers);
+
+		return m_nextHandle;
+	}
+
+	ObserverManager::ObserverHandle ObserverManager::Subscribe(const TypeInfo* type, ObserverFunc observer)
+	{
+		if ((nullptr == type) || !observer)
+		{
+			return InvalidHandle;
+		}
+
+		std::lock_guard<std::mutex> lock(m_observerMutex);
+
+		std::shared_ptr<ObserverList> observers = std::make_shared<ObserverList>(*m_observers);
+		observers->push_back({ ++m_nextHandle, nullptr, type, std::move(observer) });
+		AddHooks(observers->back());
+
+		m_observers = std::move(observers);
+
+		return m_nextHandle;
+	}
+
+	void ObserverManager::Unsubscribe(ObserverHandle handle)
+	{
+		std::lock_guard<std::mutex> lock(m_observerMutex);
+
+		auto itr = std::find_if(m_observers->begin(), m_observers->end(), [handle](const Observer& observer)
+		{
+			return observer.handle == handle;
+		});
+
+		if (itr != m_observers->end())
+		{
+			RemoveHooks(*itr);
+
+			std::shared_ptr<ObserverList> observers = std::make_shared<ObserverList>();
+			observers->reserve(m_observers->size() - 1);
+
+			for (const Observer& observer : *m_observers)
+			{
+				if (observer.handle != handle)
+				{
+					observers->push_back(observer);
+				}
+			}
+
+			m_observers = std::move(observers);
+		}
+	}
+
+	void ObserverManager::Push(const PropertyChange& change)
+	{
+		if (m_queue.Push(change))
+		{
+			return;
+		}
+
+		std::lock_guard<std::mutex> lock(m_overflowMutex);
+
+		m_overflow.push_back(change);
+	}
+
+	size_t ObserverManager::Flush(size_t batchSize)
+	{
+		// The buffers of the previous flush are reused, unless a nested flush holds them.
+		std::vector<PropertyChange> changes;
+		std::vector<PropertyChange> batch;
+		std::shared_ptr<const ObserverList> observers;
+
+		{
+			std::lock_guard<std::mutex> flushLock(m_flushMutex);
+
+			changes.swap(m_changes);
+			batch.swap(m_batch);
+			changes.clear();
+
+			Drain(changes);
+
+			if (changes.empty())
+			{
+				m_changes.swap(changes);
+				m_batch.swap(batch);
+				return 0;
+			}
+
+			{
+				std::lock_guard<std::mutex> lock(m_observerMutex);
+
+				observers = m_observers;
+			}
+
+			// Counted before the lock is released, so an unregistration purging the queue waits for these changes.
+			m_deliveries.fetch_add(1, std::memory_order_seq_cst);
+		}
+
+		// Ends the delivery even if an observer throws, so an unregistration never waits for it forever.
+		struct DeliveryScope
+		{
+			std::atomic<size_t>& deliveries;
+
+			~DeliveryScope()
+			{
+				--s_deliveryDepth;
+				deliveries.fetch_sub(1, std::memory_order_seq_cst);
+			}
+		};
+
+		++s_deliveryDepth;
+		const DeliveryScope deliveryScope{ m_deliveries };
+
+		std::sort(changes.begin(), changes.end(), [](const PropertyChange& lhs, const PropertyChange& rhs)
+		{
+			if (lhs.property != rhs.property)
+			{
+				return std::less<const PropertyInfo*>()(lhs.property, rhs.property);
+			}
+
+			return std::less<void*>()(lhs.instance, rhs.instance);
+		});
+
+		auto last = std::unique(changes.begin(), changes.end(), [](const PropertyChange& lhs, const PropertyChange& rhs)
+		{
+			return (lhs.property == rhs.property) && (lhs.instance == rhs.instance);
+		});
+
+		changes.erase(last, changes.end());
+
+		for (const Observer& observer : *observers)
+		{
+			if (nullptr != observer.property)
+			{
+				auto range = std::equal_range(changes.begin(), changes.end(), PropertyChange{ nullptr, observer.property, nullptr }, 
+					[](const PropertyChange& lhs, const PropertyChange& rhs)
+					{
+						return std::less<const PropertyInfo*>()(lhs.property, rhs.property);
+					});
+
+				if (range.first != range.second)
+				{
+					Deliver(observer.func, &(*range.first), static_cast<size_t>(range.second - range.first), batchSize);
+				}
+
+				continue;
+			}
+
+			const TypeInfo::PropertyList& properties = observer.type->GetPropertyList();
+
+			batch.clear();
+
+			for (const PropertyChange& typeChange : changes)
+			{
+				const size_t ordinal = typeChange.property->GetPropertyOrdinal();
+
+				if ((ordinal < properties.size()) && (properties[ordinal] == typeChange.property)
+					&& (IsSame(observer.type, typeChange.type) || IsChild(observer.type, typeChange.type)))
+				{
+					batch.push_back(typeChange);
+				}
+			}
+
+			if (!batch.empty())
+			{
+				Deliver(observer.func, batch.data(), batch.size(), batchSize);
+			}
+		}
+
+		const size_t count = changes.size();
+
+		{
+			std::lock_guard<std::mutex> flushLock(m_flushMutex);
+
+			if (m_changes.capacity() < changes.capacity())
+			{
+				m_changes.swap(changes);
+			}
+
+			if (m_batch.capacity() < batch.capacity())
+			{
+				m_batch.swap(batch);
+			}
+		}
+
+		return count;
+	}
+
+	void ObserverManager::Drain(std::vector<PropertyChange>& changes)
+	{
+		PropertyChange change;
+		while (m_queue.Pop(change))
+		{
+			changes.push_back(change);
+		}
+
+		std::lock_guard<std::mutex> lock(m_overflowMutex);
+
+		changes.insert(changes.end(), m_overflow.begin(), m_overflow.end());
+		m_overflow.clear();
+	}
+
+	void ObserverManager::OnUnregist(const TypeInfo* type)
+	{
+		ObserverManager& observerManager = GetHandle();
+
+		auto isRemoved = [type](const PropertyInfo* property)
+		{
+			return (nullptr != property) && (property->GetOwnerType() == type);
+		};
+
+		// The metadata of the type is still alive : it is freed once the listeners return.
+		{
+			std::lock_guard<std::mutex> flushLock(observerManager.m_flushMutex);
+
+			std::vector<PropertyChange> changes;
+			observerManager.Drain(changes);
+
+			changes.erase(std::remove_if(changes.begin(), changes.end(), [type, &isRemoved](const PropertyChange& change)
+			{
+				return (change.type == type) || isRemoved(change.property);
+			}), changes.end());
+
+			// Kept for the next flush, in front of the changes pushed meanwhile.
+			std::lock_guard<std::mutex> lock(observerManager.m_overflowMutex);
+
+			observerManager.m_overflow.insert(observerManager.m_overflow.begin(), changes.begin(), changes.end());
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(observerManager.m_observerMutex);
+
+			const ObserverList& current = *observerManager.m_observers;
+			std::shared_ptr<ObserverList> observers = std::make_shared<ObserverList>();
+			observers->reserve(current.size());
+
+			for (const Observer& observer : current)
+			{
+				if ((observer.type == type) || isRemoved(observer.property))
+				{
+					observerManager.RemoveHooks(observer);
+				}
+				else
+				{
+					observers->push_back(observer);
+				}
+			}
+
+			if (observers->size() != current.size())
+			{
+				observerManager.m_observers = std::move(observers);
+			}
+		}
+
+		// A flush that took the changes or the observers before the purge may still be delivering them.
+		while (s_deliveryDepth < observerManager.m_deliveries.load(std::memory_order_seq_cst))
+		{
+			std::this_thread::yield();
+		}
+	}
+
+	void ObserverManager::AddHooks(const Observer& observer)
+	{
+		auto addHook = [this](const PropertyInfo* property)
+		{
+			if (0 == m_observedCounts[property]++)
+			{
+				property->EnableHooks(PropertyInfo::HookObserve);
+			}
+		};
+
+		if (nullptr != observer.property)
+		{
+			addHook(observer.property);
+			return;
+		}
+
+		for (const PropertyInfo* property : observer.type->GetPropertyList())
+		{
+			addHook(property);
+		}
+	}
+
+	void ObserverManager::RemoveHooks(const Observer& observer)
+	{
+		auto removeHook = [this](const PropertyInfo* property)
+		{
+			auto itr = m_observedCounts.find(property);
+			if ((itr != m_observedCounts.end()) && (0 == --itr->second))
+			{
+				property->DisableHooks(PropertyInfo::HookObserve);
+				m_observedCounts.erase(itr);
+			}
+		};
+
+		if (nullptr != observer.property)
+		{
+			removeHook(observer.property);
+			return;
+		}
+
+		for (const PropertyInfo* property : observer.type->GetPropertyList())
+		{
+			removeHook(property);
+		}
+	}
+
+	void ObserverManager::Deliver(const ObserverFunc& func, const PropertyChange* changes, size_t count, size_t batchSize) const
+	{
+		if (0 == batchSize)
+		{
+			batchSize = count;
+		}
+
+		for (size_t offset = 0; offset < count; offset += batchSize)
+		{
+			const size_t size = ((count - offset) < batchSize) ? (count - offset) : batchSize;
+
+			func(changes + offset, size);
+		}
+	}
+}
\ No newline at end of file
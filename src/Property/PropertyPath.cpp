@@ -0,0 +1,416 @@
+#include "Property/PropertyPath.h"
+
+#include "Property/ContainerPropertyInfo.h"
+#include "Serialization/ScratchValue.h"
+#include "Serialization/TypeSchema.h"
+
+#include <charconv>
+
+namespace Reflection
+{
+	namespace
+	{
+		bool MatchName(std::string_view name, std::string_view key)
+		{
+			if (name.size() == key.size())
+			{
+				return 0 == name.compare(key);
+			}
+
+			if (name.size() < key.size() + 2)
+			{
+				return false;
+			}
+
+			const size_t prefix = name.size() - key.size();
+
+			return (':' == name[prefix - 1]) && (':' == name[prefix - 2]) && (0 == name.compare(prefix, key.size(), key));
+		}
+
+		/**
+		 * @brief	Finds a member by name. Derived properties are listed after the inherited ones,
+		 * 			so the last match is the most derived declaration, the one C++ name lookup would pick.
+		 */
+		const PropertyInfo* FindMember(const TypeInfo* type, std::string_view name)
+		{
+			const PropertyInfo* found = nullptr;
+
+			for (const PropertyInfo* property : type->GetPropertyList())
+			{
+				if (MatchName(property->GetPropertyName(), name))
+				{
+					found = property;
+				}
+			}
+
+			return found;
+		}
+
+		bool IsSeparator(std::string_view path, size_t position)
+		{
+			const char character = path[position];
+
+			return ('.' == character) || ('[' == character) || (('-' == character) && (position + 1 < path.size()) && ('>' == path[position + 1]));
+		}
+
+		/**
+		 * @brief	Parses a key literal into a value of the key type.
+		 */
+		bool ParseKey(std::string_view literal, const TypeInfo* keyType, void* key)
+		{
+			const TypeInfo::Primitive primitive = keyType->GetPrimitive();
+
+			if ((2 <= literal.size()) && (('"' == literal.front()) || ('\'' == literal.front())) && (literal.front() == literal.back()))
+			{
+				if (TypeInfo::Primitive::String != primitive)
+				{
+					return false;
+				}
+
+				static_cast<std::string*>(key)->assign(literal.data() + 1, literal.size() - 2);
+				return true;
+			}
+
+			if (("true" == literal) || ("false" == literal))
+			{
+				const bool value = ("true" == literal);
+				return ConvertPrimitive(TypeInfo::Primitive::Bool, &value, primitive, key);
+			}
+
+			const char* begin = literal.data();
+			const char* end = literal.data() + literal.size();
+
+			if (std::string_view::npos == literal.find_first_of(".eE"))
+			{
+				if ('-' == literal.front())
+				{
+					int64_t value = 0;
+					const auto result = std::from_chars(begin, end, value);
+					return (std::errc() == result.ec) && (end == result.ptr) && ConvertPrimitive(TypeInfo::Primitive::Int64, &value, primitive, key);
+				}
+
+				uint64_t value = 0;
+				const auto result = std::from_chars(begin, end, value);
+				return (std::errc() == result.ec) && (end == result.ptr) && ConvertPrimitive(TypeInfo::Primitive::UInt64, &value, primitive, key);
+			}
+
+			double value = 0.0;
+			const auto result = std::from_chars(begin, end, value);
+			return (std::errc() == result.ec) && (end == result.ptr) && ConvertPrimitive(TypeInfo::Primitive::Double, &value, primitive, key);
+		}
+	}
+
+	PropertyPath::PropertyPath()
+		: m_path()
+		, m_error()
+		, m_steps()
+		, m_offset(0)
+		, m_valueType(nullptr)
+		, m_property(nullptr)
+		, m_notifyProperty(nullptr)
+		, m_notifySteps(0)
+		, m_assignable(false)
+	{}
+
+	PropertyPath PropertyPath::Compile(const TypeInfo* type, std::string_view path)
+	{
+		PropertyPath result;
+		result.m_path = std::string(path);
+
+		if (nullptr == type)
+		{
+			result.Fail("no type");
+			return result;
+		}
+
+		const TypeInfo* current = type;
+		const PropertyInfo* member = nullptr;
+		size_t offset = 0;
+		size_t position = 0;
+		bool arrow = false;
+
+		while (true)
+		{
+			// Member
+			const size_t start = position;
+			while ((position < path.size()) && !IsSeparator(path, position))
+			{
+				++position;
+			}
+
+			const std::string_view name = path.substr(start, position - start);
+			if (name.empty())
+			{
+				result.Fail("missing member name at " + std::to_string(start));
+				return result;
+			}
+
+			if (current->IsPointer())
+			{
+				result.m_steps.push_back({ StepKind::Deref, offset, 0, 0, nullptr, nullptr });
+				offset = 0;
+				current = current->GetPureType();
+
+				// The object behind the pointer owns the rest of the path : writes are reported on it.
+				result.m_notifyProperty = nullptr;
+				result.m_notifySteps = result.m_steps.size();
+			}
+			else if (arrow)
+			{
+				result.Fail("'->' after a member that is not a pointer, before '" + std::string(name) + "'");
+				return result;
+			}
+
+			member = FindMember(current, name);
+			if (nullptr == member)
+			{
+				result.Fail("'" + std::string(current->GetTypeName()) + "' has no member '" + std::string(name) + "'");
+				return result;
+			}
+
+			if (nullptr == result.m_notifyProperty)
+			{
+				result.m_notifyProperty = member;
+			}
+
+			offset += member->GetPropertyOffset();
+			current = member->GetPropertyType();
+			result.m_property = member;
+			result.m_assignable = true;
+
+			// Container accesses
+			while ((position < path.size()) && ('[' == path[position]))
+			{
+				const size_t close = path.find(']', position);
+				if (std::string_view::npos == close)
+				{
+					result.Fail("missing ']' after " + std::to_string(position));
+					return result;
+				}
+
+				const std::string_view literal = path.substr(position + 1, close - position - 1);
+				// An element holding a container is described by the TypeInfo of the element.
+				const ContainerPropertyInfo* container = (nullptr != member) ? Cast<const ContainerPropertyInfo*>(member) : current->GetContainer();
+
+				if (nullptr == container)
+				{
+					result.Fail("'" + std::string(nullptr != member ? member->GetPropertyName() : std::string_view("element")) + "' is not a container");
+					return result;
+				}
+
+				if (const auto* arrayInfo = Cast<const ArrayPropertyInfo*>(container))
+				{
+					size_t index = 0;
+					const auto parsed = std::from_chars(literal.data(), literal.data() + literal.size(), index);
+
+					if (literal.empty() || (std::errc() != parsed.ec) || (literal.data() + literal.size() != parsed.ptr))
+					{
+						result.Fail("invalid index '" + std::string(literal) + "'");
+						return result;
+					}
+
+					current = arrayInfo->GetValueType();
+					result.m_steps.push_back({ StepKind::Index, offset, index, current->GetTypeSize(), container, nullptr });
+					result.m_assignable = true;
+				}
+				else
+				{
+					const auto* mapInfo = Cast<const MapPropertyInfo*>(container);
+					const auto* setInfo = Cast<const SetPropertyInfo*>(container);
+					const TypeInfo* keyType = (nullptr != mapInfo) ? mapInfo->GetKeyType() : setInfo->GetKeyType();
+
+					auto key = std::make_shared<ScratchValue>(keyType);
+					if (!container->HasFind() || !key->IsValid() || !ParseKey(literal, keyType, key->Get()))
+					{
+						result.Fail("invalid key '" + std::string(literal) + "' for '" + std::string(container->GetPropertyName()) + "'");
+						return result;
+					}
+
+					// The mapped value sits at a fixed offset in the found pair.
+					size_t mappedOffset = 0;
+					if (nullptr != mapInfo)
+					{
+						const char* probe = reinterpret_cast<const char*>(&mappedOffset);
+						mappedOffset = static_cast<size_t>(static_cast<const char*>(mapInfo->GetRawMapped(probe)) - probe);
+					}
+
+					current = (nullptr != mapInfo) ? mapInfo->GetMappedType() : setInfo->GetValueType();
+					result.m_steps.push_back({ StepKind::Key, offset, mappedOffset, 0, container, std::move(key) });
+					result.m_assignable = (nullptr != mapInfo);
+				}
+
+				offset = 0;
+				member = nullptr;
+				result.m_property = nullptr;
+				position = close + 1;
+			}
+
+			if (position >= path.size())
+			{
+				break;
+			}
+
+			if ('.' == path[position])
+			{
+				arrow = false;
+				position += 1;
+			}
+			else if ('-' == path[position])
+			{
+				arrow = true;
+				position += 2;
+			}
+			else
+			{
+				result.Fail("unexpected '" + std::string(1, path[position]) + "' at " + std::to_string(position));
+				return result;
+			}
+		}
+
+		result.m_offset = offset;
+		result.m_valueType = current;
+
+		return result;
+	}
+
+	void* PropertyPath::Resolve(void* instance) const
+	{
+		return const_cast<void*>(Resolve(static_cast<const void*>(instance)));
+	}
+
+	const void* PropertyPath::Resolve(const void* instance) const
+	{
+		if ((nullptr == m_valueType) || (nullptr == instance))
+		{
+			return nullptr;
+		}
+
+		const char* base = Walk(static_cast<const char*>(instance));
+
+		return (nullptr != base) ? base + m_offset : nullptr;
+	}
+
+	bool PropertyPath::SetRaw(void* instance, const void* value) const
+	{
+		if (!m_assignable || (nullptr == m_valueType) || (nullptr == instance))
+		{
+			return false;
+		}
+
+		char* owner = const_cast<char*>(Walk(static_cast<const char*>(instance), 0, m_notifySteps));
+		char* base = (nullptr != owner) ? const_cast<char*>(Walk(owner, m_notifySteps, m_steps.size())) : nullptr;
+		if (nullptr == base)
+		{
+			return false;
+		}
+
+		// A member of the owner itself goes through its hooks, a nested value is reported as a write of the owner's member.
+		if ((m_property == m_notifyProperty) && (owner == base))
+		{
+			m_property->SetRaw(owner, value);
+			return true;
+		}
+
+		if (!m_valueType->CopyAssign(base + m_offset, value))
+		{
+			return false;
+		}
+
+		m_notifyProperty->MarkWritten(owner);
+		return true;
+	}
+
+	const char* PropertyPath::Walk(const char* address) const
+	{
+		return Walk(address, 0, m_steps.size());
+	}
+
+	const char* PropertyPath::Walk(const char* address, size_t first, size_t last) const
+	{
+		for (size_t stepIndex = first; stepIndex < last; ++stepIndex)
+		{
+			const Step& step = m_steps[stepIndex];
+			address += step.offset;
+
+			switch (step.kind)
+			{
+				case StepKind::Deref :
+					address = *reinterpret_cast<const char* const*>(address);
+					break;
+				case StepKind::Index :
+				{
+					const char* data = static_cast<const char*>(step.container->GetData(address));
+
+					if (nullptr != data)
+					{
+						address = (step.index < step.container->GetSize(address)) ? data + step.index * step.elementSize : nullptr;
+						break;
+					}
+
+					// Node based containers are walked up to the index.
+					auto itr = step.container->begin(address);
+					const auto end = step.container->end(address);
+
+					for (size_t index = 0; (index < step.index) && (itr != end); ++index)
+					{
+						++itr;
+					}
+
+					address = (itr != end) ? static_cast<const char*>(itr.get()) : nullptr;
+					break;
+				}
+				case StepKind::Key :
+				{
+					const char* found = static_cast<const char*>(step.container->Find(address, step.key->Get()));
+					address = (nullptr != found) ? found + step.index : nullptr;
+					break;
+				}
+			}
+
+			if (nullptr == address)
+			{
+				return nullptr;
+			}
+		}
+
+		return address;
+	}
+
+	bool PropertyPath::Fail(std::string error)
+	{
+		m_error = "PropertyPath '" + m_path + "' : " + error;
+		m_steps.clear();
+		m_valueType = nullptr;
+		m_property = nullptr;
+		m_notifyProperty = nullptr;
+		m_notifySteps = 0;
+		m_assignable = false;
+
+		return false;
+	}
+
+	bool PropertyPath::IsValid() const
+	{
+		return nullptr != m_valueType;
+	}
+
+	const std::string& PropertyPath::GetError() const
+	{
+		return m_error;
+	}
+
+	const std::string& PropertyPath::GetPath() const
+	{
+		return m_path;
+	}
+
+	const TypeInfo* PropertyPath::GetValueType() const
+	{
+		return m_valueType;
+	}
+
+	const PropertyInfo* PropertyPath::GetProperty() const
+	{
+		return m_property;
+	}
+}
\ No newline at end of file
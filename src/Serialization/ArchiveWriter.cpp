@@ -0,0 +1,78 @@
+#include "Serialization/ArchiveWriter.h"
+
+#include <cstring>
+#include <fstream>
+
+namespace Reflection
+{
+	ArchiveWriter::ArchiveWriter()
+		: m_image()
+	{
+		AllocateRaw(sizeof(ArchiveHeader), ArchiveHeader::Alignment);
+
+		ArchiveHeader& header = GetHeader();
+		header.magic = ArchiveHeader::MagicNumber;
+		header.version = ArchiveHeader::CurrentVersion;
+		header.fingerprint = 0;
+		header.rootOffset = 0;
+		header.size = m_image.size();
+	}
+
+	void ArchiveWriter::SetRoot(const TypeInfo* type, size_t offset)
+	{
+		ArchiveHeader& header = GetHeader();
+
+		header.fingerprint = (nullptr != type) ? type->GetLayoutFingerprint() : 0;
+		header.rootOffset = (nullptr != type) ? offset : 0;
+	}
+
+	bool ArchiveWriter::Save(const std::string& path) const
+	{
+		const ArchiveHeader* header = reinterpret_cast<const ArchiveHeader*>(m_image.data());
+		if (0 == header->rootOffset)
+		{
+			return false;
+		}
+
+		std::ofstream file(path, std::ios::binary | std::ios::trunc);
+		if (!file)
+		{
+			return false;
+		}
+
+		file.write(m_image.data(), static_cast<std::streamsize>(m_image.size()));
+
+		return static_cast<bool>(file);
+	}
+
+	const void* ArchiveWriter::GetData() const
+	{
+		return m_image.data();
+	}
+
+	size_t ArchiveWriter::GetSize() const
+	{
+		return m_image.size();
+	}
+
+	size_t ArchiveWriter::AllocateRaw(size_t size, size_t alignment)
+	{
+		const size_t offset = (m_image.size() + alignment - 1) & ~(alignment - 1);
+
+		// Growing by whole alignment units keeps every offset aligned once the image is mapped at an aligned address.
+		const size_t end = (offset + size + ArchiveHeader::Alignment - 1) & ~(ArchiveHeader::Alignment - 1);
+		m_image.resize(end, 0);
+
+		if (sizeof(ArchiveHeader) <= m_image.size())
+		{
+			GetHeader().size = m_image.size();
+		}
+
+		return offset;
+	}
+
+	ArchiveHeader& ArchiveWriter::GetHeader()
+	{
+		return *reinterpret_cast<ArchiveHeader*>(m_image.data());
+	}
+}
\ No newline at end of file
@@ -0,0 +1,497 @@
+#include "Serialization/BinaryReader.h"
+#include "Serialization/BinaryWriter.h"
+
+#include "Property/PropertyInfo.h"
+#include "Property/ContainerPropertyInfo.h"
+#include "Serialization/ScratchValue.h"
+
+#include <cstring>
+#include <utility>
+
+namespace Reflection
+{
+	namespace
+	{
+		/**
+		 * @brief	Checks if a stored plain value can be copied bytewise into the local type.
+		 */
+		bool IsBitwiseMatch(const SchemaValue& source, const TypeInfo* target)
+		{
+			if ((nullptr == target) || (source.size != target->GetTypeSize()))
+			{
+				return false;
+			}
+
+			if (SchemaValue::Kind::Primitive == source.kind)
+			{
+				return source.primitive == target->GetPrimitive();
+			}
+			else if (SchemaValue::Kind::Bytes == source.kind)
+			{
+				const std::string_view name = target->GetTypeName();
+				return target->IsTriviallyCopyable() && (source.typeHash == static_cast<uint64_t>(Utils::HashBytes(name.data(), name.size(), 0)));
+			}
+
+			return false;
+		}
+	}
+
+	BinaryReader::BinaryReader(const void* data, size_t size)
+		: m_cursor(static_cast<const char*>(data))
+		, m_end(static_cast<const char*>(data) + size)
+		, m_valid(false)
+		, m_schemas()
+		, m_bindings()
+		, m_resolve()
+	{
+		uint32_t header[4] = {};
+
+		if ((nullptr == data) || !Extract(header) || (BinaryWriter::MagicNumber != header[0])
+			|| (0 == header[1]) || (BinaryWriter::CurrentVersion < header[1]))
+		{
+			return;
+		}
+
+		m_schemas.resize(header[2]);
+		m_bindings.resize(header[2]);
+
+		for (TypeSchema& schema : m_schemas)
+		{
+			if (!schema.Deserialize(m_cursor, m_end))
+			{
+				return;
+			}
+		}
+
+		m_valid = true;
+	}
+
+	bool BinaryReader::Read(const TypeInfo* type, void* instance)
+	{
+		uint32_t schemaIndex = 0;
+
+		if (!m_valid || (nullptr == type) || (nullptr == instance) || !Extract(schemaIndex))
+		{
+			return false;
+		}
+
+		return ReadObject(schemaIndex, type->GetRuntimeType(instance), instance);
+	}
+
+	bool BinaryReader::Skip()
+	{
+		uint32_t schemaIndex = 0;
+
+		return m_valid && Extract(schemaIndex) && ReadObject(schemaIndex, nullptr, nullptr);
+	}
+
+	bool BinaryReader::IsValid() const
+	{
+		return m_valid;
+	}
+
+	bool BinaryReader::IsEnd() const
+	{
+		return m_cursor >= m_end;
+	}
+
+	const std::vector<TypeSchema>& BinaryReader::GetSchemas() const
+	{
+		return m_schemas;
+	}
+
+	void BinaryReader::SetObjectResolveFunc(ObjectResolveFunc resolve)
+	{
+		m_resolve = std::move(resolve);
+	}
+
+	const BinaryReader::Binding* BinaryReader::GetBinding(uint32_t schemaIndex, const TypeInfo* type)
+	{
+		std::vector<Binding>& bindings = m_bindings[schemaIndex];
+
+		for (const Binding& binding : bindings)
+		{
+			if (binding.type == type)
+			{
+				return &binding;
+			}
+		}
+
+		const TypeSchema& source = m_schemas[schemaIndex];
+
+		if (source.GetFingerprint() == type->GetLayoutFingerprint())
+		{
+			bindings.push_back({ type, TypeSchema::Get(type), nullptr });
+		}
+		else
+		{
+			bindings.push_back({ type, TypeSchema::Get(type), SchemaRemap::Get(&source, type) });
+		}
+
+		return &bindings.back();
+	}
+
+	bool BinaryReader::ReadObject(uint32_t schemaIndex, const TypeInfo* type, void* instance)
+	{
+		if (schemaIndex >= m_schemas.size())
+		{
+			m_valid = false;
+			return false;
+		}
+
+		const TypeSchema& source = m_schemas[schemaIndex];
+		const char* image = m_cursor;
+
+		if (!Advance(source.GetSize()))
+		{
+			return false;
+		}
+
+		const std::vector<SchemaField>& sourceFields = source.GetFields();
+
+		if ((nullptr == type) || (nullptr == instance))
+		{
+			for (const size_t index : source.GetTail())
+			{
+				if (!ReadField(sourceFields[index], nullptr, nullptr))
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		char* base = static_cast<char*>(instance);
+		const Binding* binding = GetBinding(schemaIndex, type);
+
+		if (nullptr == binding->remap)
+		{
+			// Same layout: the image is copied in as few blocks as possible, once the image is known to match the local schema.
+			const TypeSchema* schema = binding->schema;
+
+			if ((source.GetSize() != schema->GetSize()) || (sourceFields.size() != schema->GetFields().size()))
+			{
+				m_valid = false;
+				return false;
+			}
+
+			if (schema->IsFlat())
+			{
+				std::memcpy(base, image, static_cast<size_t>(schema->GetSize()));
+			}
+			else
+			{
+				for (const SchemaRun& run : schema->GetRuns())
+				{
+					std::memcpy(base + run.target, image + run.source, static_cast<size_t>(run.size));
+				}
+			}
+
+			const std::vector<SchemaField>& fields = schema->GetFields();
+
+			for (const size_t index : schema->GetTail())
+			{
+				if (!ReadField(sourceFields[index], &fields[index], base))
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		const SchemaRemap* remap = binding->remap;
+
+		for (const SchemaRun& run : remap->GetRuns())
+		{
+			std::memcpy(base + run.target, image + run.source, static_cast<size_t>(run.size));
+		}
+
+		for (const SchemaRemap::Conversion& conversion : remap->GetConversions())
+		{
+			if (!ConvertPrimitive(conversion.sourcePrimitive, image + conversion.source, conversion.targetPrimitive, base + conversion.target))
+			{
+				m_valid = false;
+				return false;
+			}
+		}
+
+		for (const SchemaRemap::TailEntry& entry : remap->GetTail())
+		{
+			if (!ReadField(entry.source, entry.target, base))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	bool BinaryReader::ReadField(const SchemaField& source, const SchemaField* target, char* base)
+	{
+		void* address = (nullptr != target) ? base + target->offset : nullptr;
+
+		if (SchemaValue::Kind::String == source.value.kind)
+		{
+			return ReadString(static_cast<std::string*>(address));
+		}
+
+		if (SchemaValue::Kind::Pointer == source.value.kind)
+		{
+			return ReadElement(source.value, (nullptr != target) ? target->property->GetPropertyType() : nullptr, address);
+		}
+
+		uint64_t count = 0;
+		if (!Extract(count))
+		{
+			return false;
+		}
+
+		const ContainerPropertyInfo* container = (nullptr != target) ? Cast<const ContainerPropertyInfo*>(target->property) : nullptr;
+
+		return ReadElements(source, container, address, count);
+	}
+
+	bool BinaryReader::ReadElements(const SchemaField& source, const ContainerPropertyInfo* container, void* address, uint64_t count)
+	{
+		const SchemaValue& element = source.element;
+
+		if (nullptr == container)
+		{
+			for (uint64_t index = 0; index < count; ++index)
+			{
+				if (((SchemaValue::Kind::Map == source.value.kind) && !ReadElement(source.key, nullptr, nullptr)) || !ReadElement(element, nullptr, nullptr))
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		if (const auto* mapInfo = Cast<const MapPropertyInfo*>(container))
+		{
+			ScratchValue scratch(mapInfo->GetValueType());
+			if (!scratch.IsValid() || !container->CanInsert() || !container->Clear(address))
+			{
+				return ReadElements(source, nullptr, nullptr, count);
+			}
+
+			for (uint64_t index = 0; index < count; ++index)
+			{
+				scratch.Reset();
+
+				// The key of a value_type is const; it is written before the element is inserted.
+				void* key = const_cast<void*>(mapInfo->GetRawKey(scratch.Get()));
+				void* mapped = const_cast<void*>(mapInfo->GetRawMapped(scratch.Get()));
+
+				if (!ReadElement(source.key, mapInfo->GetKeyType(), key) || !ReadElement(element, mapInfo->GetMappedType(), mapped))
+				{
+					return false;
+				}
+
+				container->Insert(address, scratch.Get());
+			}
+
+			return true;
+		}
+
+		if (const auto* setInfo = Cast<const SetPropertyInfo*>(container))
+		{
+			ScratchValue scratch(setInfo->GetValueType());
+			if (!scratch.IsValid() || !container->CanInsert() || !container->Clear(address))
+			{
+				return ReadElements(source, nullptr, nullptr, count);
+			}
+
+			for (uint64_t index = 0; index < count; ++index)
+			{
+				scratch.Reset();
+
+				if (!ReadElement(element, setInfo->GetValueType(), scratch.Get()))
+				{
+					return false;
+				}
+
+				container->Insert(address, scratch.Get());
+			}
+
+			return true;
+		}
+
+		const ArrayPropertyInfo* arrayInfo = Cast<const ArrayPropertyInfo*>(container);
+		const TypeInfo* elementType = arrayInfo->GetValueType();
+
+		if (!container->CanInsert())
+		{
+			// Fixed size arrays: the elements are updated in place and the extra values are skipped.
+			auto itr = container->begin(address);
+			const auto end = container->end(address);
+
+			for (uint64_t index = 0; index < count; ++index)
+			{
+				const bool inside = (itr != end);
+
+				if (!ReadElement(element, inside ? elementType : nullptr, inside ? const_cast<void*>(itr.get()) : nullptr))
+				{
+					return false;
+				}
+
+				if (inside)
+				{
+					++itr;
+				}
+			}
+
+			return true;
+		}
+
+		// Plain elements of the same type are copied in one block once the array is resized.
+		if (IsBitwiseMatch(element, elementType) && container->Resize(address, static_cast<size_t>(count)))
+		{
+			void* data = const_cast<void*>(container->GetData(address));
+			const char* source = m_cursor;
+
+			if ((nullptr != data) && Advance(count * element.size))
+			{
+				std::memcpy(data, source, static_cast<size_t>(count * element.size));
+				return true;
+			}
+		}
+
+		ScratchValue scratch(elementType);
+		if (!scratch.IsValid() || !container->Clear(address))
+		{
+			return ReadElements(source, nullptr, nullptr, count);
+		}
+
+		container->Reserve(address, static_cast<size_t>(count));
+
+		for (uint64_t index = 0; index < count; ++index)
+		{
+			void* stored = container->Insert(address, scratch.Get());
+
+			if (!ReadElement(element, (nullptr != stored) ? elementType : nullptr, stored))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	bool BinaryReader::ReadElement(const SchemaValue& source, const TypeInfo* target, void* address)
+	{
+		switch (source.kind)
+		{
+			case SchemaValue::Kind::Primitive :
+			case SchemaValue::Kind::Bytes :
+			{
+				const char* value = m_cursor;
+				if (!Advance(source.size))
+				{
+					return false;
+				}
+
+				if (nullptr == target)
+				{
+					return true;
+				}
+
+				if (IsBitwiseMatch(source, target))
+				{
+					std::memcpy(address, value, static_cast<size_t>(source.size));
+				}
+				else if ((SchemaValue::Kind::Primitive == source.kind) && IsNumeric(source.primitive) && IsNumeric(target->GetPrimitive())
+					&& !ConvertPrimitive(source.primitive, value, target->GetPrimitive(), address))
+				{
+					m_valid = false;
+					return false;
+				}
+
+				return true;
+			}
+			case SchemaValue::Kind::String :
+			{
+				const bool assignable = (nullptr != target) && (TypeInfo::Primitive::String == target->GetPrimitive());
+				return ReadString(assignable ? static_cast<std::string*>(address) : nullptr);
+			}
+			case SchemaValue::Kind::Object :
+			{
+				const bool readable = (nullptr != target) && !target->GetPropertyList().empty();
+				return ReadObject(source.schema, readable ? target : nullptr, readable ? address : nullptr);
+			}
+			case SchemaValue::Kind::Pointer :
+			{
+				uint32_t id = 0;
+				if (!Extract(id))
+				{
+					return false;
+				}
+
+				if ((nullptr != target) && target->IsPointer() && (nullptr != m_resolve))
+				{
+					void* object = (0 != id) ? m_resolve(id, target->GetPureType()) : nullptr;
+					std::memcpy(address, &object, sizeof(void*));
+				}
+
+				return true;
+			}
+			default :
+				return true;
+		}
+	}
+
+	bool BinaryReader::ReadString(std::string* target)
+	{
+		uint64_t size = 0;
+		const char* data = nullptr;
+
+		if (!Extract(size))
+		{
+			return false;
+		}
+
+		data = m_cursor;
+		if (!Advance(size))
+		{
+			return false;
+		}
+
+		if (nullptr != target)
+		{
+			target->assign(data, static_cast<size_t>(size));
+		}
+
+		return true;
+	}
+
+	bool BinaryReader::Advance(uint64_t size)
+	{
+		if (static_cast<uint64_t>(m_end - m_cursor) < size)
+		{
+			m_cursor = m_end;
+			m_valid = false;
+			return false;
+		}
+
+		m_cursor += size;
+
+		return true;
+	}
+
+	template<typename T>
+	bool BinaryReader::Extract(T& value)
+	{
+		const char* data = m_cursor;
+		if (!Advance(sizeof(T)))
+		{
+			return false;
+		}
+
+		std::memcpy(&value, data, sizeof(T));
+
+		return true;
+	}
+}
\ No newline at end of file
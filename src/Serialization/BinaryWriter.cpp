@@ -0,0 +1,223 @@
+#include "Serialization/BinaryWriter.h"
+
+#include "Property/PropertyInfo.h"
+#include "Property/ContainerPropertyInfo.h"
+
+#include <cstring>
+#include <string>
+#include <utility>
+
+namespace Reflection
+{
+	BinaryWriter::BinaryWriter()
+		: m_schemaTable()
+		, m_data()
+		, m_schemas()
+		, m_schemaCount(0)
+		, m_objectId()
+	{}
+
+	void BinaryWriter::Write(const TypeInfo* type, const void* instance)
+	{
+		if ((nullptr == type) || (nullptr == instance))
+		{
+			return;
+		}
+
+		const SchemaEntry& entry = GetSchema(type->GetRuntimeType(instance));
+
+		WriteValue(entry.index);
+		WriteObject(entry.schema, instance);
+	}
+
+	std::vector<char> BinaryWriter::GetBuffer() const
+	{
+		const uint32_t header[4] = { MagicNumber, CurrentVersion, m_schemaCount, 0 };
+
+		std::vector<char> buffer(sizeof(header) + m_schemaTable.size() + m_data.size());
+		char* output = buffer.data();
+
+		std::memcpy(output, header, sizeof(header));
+		output += sizeof(header);
+
+		if (!m_schemaTable.empty())
+		{
+			std::memcpy(output, m_schemaTable.data(), m_schemaTable.size());
+			output += m_schemaTable.size();
+		}
+
+		if (!m_data.empty())
+		{
+			std::memcpy(output, m_data.data(), m_data.size());
+		}
+
+		return buffer;
+	}
+
+	void BinaryWriter::Clear()
+	{
+		m_schemaTable.clear();
+		m_data.clear();
+		m_schemas.clear();
+		m_schemaCount = 0;
+	}
+
+	void BinaryWriter::SetObjectIdFunc(ObjectIdFunc objectId)
+	{
+		m_objectId = std::move(objectId);
+	}
+
+	const BinaryWriter::SchemaEntry& BinaryWriter::GetSchema(const TypeInfo* type)
+	{
+		auto itr = m_schemas.find(type);
+		if (itr != m_schemas.end())
+		{
+			return itr->second;
+		}
+
+		// Every schema reachable through Object values is numbered first, so the table can refer to them by index.
+		std::vector<const TypeSchema*> pending;
+		std::vector<const TypeInfo*> stack = { type };
+
+		while (!stack.empty())
+		{
+			const TypeInfo* current = stack.back();
+			stack.pop_back();
+
+			if (m_schemas.end() != m_schemas.find(current))
+			{
+				continue;
+			}
+
+			const TypeSchema* schema = TypeSchema::Get(current);
+			m_schemas.emplace(current, SchemaEntry{ schema, m_schemaCount++ });
+			pending.push_back(schema);
+
+			for (const SchemaField& field : schema->GetFields())
+			{
+				for (const SchemaValue* value : { &field.key, &field.element })
+				{
+					if ((SchemaValue::Kind::Object == value->kind) && (nullptr != value->type))
+					{
+						stack.push_back(value->type);
+					}
+				}
+			}
+		}
+
+		for (const TypeSchema* schema : pending)
+		{
+			schema->Serialize(m_schemaTable, [this](const TypeInfo* objectType)
+			{
+				return m_schemas.at(objectType).index;
+			});
+		}
+
+		return m_schemas.at(type);
+	}
+
+	void BinaryWriter::WriteObject(const TypeSchema* schema, const void* instance)
+	{
+		const size_t size = static_cast<size_t>(schema->GetSize());
+		const size_t position = m_data.size();
+		const char* source = static_cast<const char*>(instance);
+
+		if (schema->IsFlat())
+		{
+			WriteBytes(instance, size);
+		}
+		else
+		{
+			// Skipped leaves (pointers, padding, non-trivial members) stay zero in the image.
+			m_data.resize(position + size, 0);
+
+			for (const SchemaRun& run : schema->GetRuns())
+			{
+				std::memcpy(m_data.data() + position + run.target, source + run.source, static_cast<size_t>(run.size));
+			}
+		}
+
+		const std::vector<SchemaField>& fields = schema->GetFields();
+
+		for (const size_t index : schema->GetTail())
+		{
+			const SchemaField& field = fields[index];
+			WriteField(field, source + field.offset);
+		}
+	}
+
+	void BinaryWriter::WriteField(const SchemaField& field, const void* address)
+	{
+		if ((SchemaValue::Kind::String == field.value.kind) || (SchemaValue::Kind::Pointer == field.value.kind))
+		{
+			WriteElement(field.value, address);
+			return;
+		}
+
+		const ContainerPropertyInfo* container = Cast<const ContainerPropertyInfo*>(field.property);
+		const uint64_t size = container->GetSize(address);
+
+		WriteValue(size);
+
+		const bool plain = (SchemaValue::Kind::Primitive == field.element.kind) || (SchemaValue::Kind::Bytes == field.element.kind);
+		const void* data = container->GetData(address);
+
+		if (plain && (nullptr != data))
+		{
+			WriteBytes(data, static_cast<size_t>(size * field.element.size));
+			return;
+		}
+
+		const MapPropertyInfo* mapInfo = (SchemaValue::Kind::Map == field.value.kind) ? Cast<const MapPropertyInfo*>(container) : nullptr;
+
+		for (auto itr = container->begin(address), end = container->end(address); itr != end; ++itr)
+		{
+			const void* element = itr.get();
+
+			if (nullptr != mapInfo)
+			{
+				WriteElement(field.key, mapInfo->GetRawKey(element));
+				WriteElement(field.element, mapInfo->GetRawMapped(element));
+			}
+			else
+			{
+				WriteElement(field.element, element);
+			}
+		}
+	}
+
+	void BinaryWriter::WriteElement(const SchemaValue& value, const void* address)
+	{
+		switch (value.kind)
+		{
+			case SchemaValue::Kind::Primitive :
+			case SchemaValue::Kind::Bytes :
+				WriteBytes(address, static_cast<size_t>(value.size));
+				break;
+			case SchemaValue::Kind::String :
+			{
+				const std::string& string = *static_cast<const std::string*>(address);
+				WriteValue(static_cast<uint64_t>(string.size()));
+				WriteBytes(string.data(), string.size());
+				break;
+			}
+			case SchemaValue::Kind::Object :
+				WriteObject(GetSchema(value.type).schema, address);
+				break;
+			case SchemaValue::Kind::Pointer :
+			{
+				const void* object = *static_cast<const void* const*>(address);
+				WriteValue(((nullptr != object) && (nullptr != m_objectId)) ? m_objectId(value.type, object) : uint32_t(0));
+				break;
+			}
+			default :
+				break;
+		}
+	}
+
+	void BinaryWriter::WriteBytes(const void* data, size_t size)
+	{
+		const char* bytes = static_cast<const char*>(data);
+		m_data.insert(m_data.end(), bytes, bytes + size);
+	}
+}
\ No newline at end of file
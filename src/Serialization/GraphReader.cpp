@@ -0,0 +1,211 @@
+#include "Serialization/GraphReader.h"
+#include "Serialization/GraphWriter.h"
+#include "Serialization/BinaryReader.h"
+
+#include "Type/TypeManager.h"
+#include "Arena.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace Reflection
+{
+	namespace
+	{
+		template<typename T>
+		bool Extract(const char*& cursor, const char* end, T& value)
+		{
+			if (static_cast<size_t>(end - cursor) < sizeof(T))
+			{
+				return false;
+			}
+
+			std::memcpy(&value, cursor, sizeof(T));
+			cursor += sizeof(T);
+
+			return true;
+		}
+
+		bool ExtractArray(const char*& cursor, const char* end, std::vector<uint32_t>& values, size_t count)
+		{
+			if (static_cast<size_t>(end - cursor) / sizeof(uint32_t) < count)
+			{
+				return false;
+			}
+
+			values.resize(count);
+			if (0 < count)
+			{
+				std::memcpy(values.data(), cursor, count * sizeof(uint32_t));
+			}
+
+			cursor += count * sizeof(uint32_t);
+
+			return true;
+		}
+	}
+
+	GraphReader::GraphReader(const void* data, size_t size)
+		: m_binary(nullptr)
+		, m_binarySize(0)
+		, m_valid(false)
+		, m_typeNames()
+		, m_objectTypes()
+		, m_roots()
+		, m_objects()
+	{
+		const char* cursor = static_cast<const char*>(data);
+		const char* end = cursor + size;
+
+		uint32_t header[6] = {};
+
+		if ((nullptr == data) || !Extract(cursor, end, header) || (GraphWriter::MagicNumber != header[0]) || (GraphWriter::CurrentVersion != header[1]))
+		{
+			return;
+		}
+
+		m_typeNames.resize(header[2]);
+
+		for (std::string& name : m_typeNames)
+		{
+			uint32_t length = 0;
+			if (!Extract(cursor, end, length) || (static_cast<size_t>(end - cursor) < length))
+			{
+				return;
+			}
+
+			name.assign(cursor, length);
+			cursor += length;
+		}
+
+		if (!ExtractArray(cursor, end, m_objectTypes, header[3]) || !ExtractArray(cursor, end, m_roots, header[4]))
+		{
+			return;
+		}
+
+		for (const uint32_t typeIndex : m_objectTypes)
+		{
+			if (m_typeNames.size() <= typeIndex)
+			{
+				return;
+			}
+		}
+
+		m_binary = cursor;
+		m_binarySize = static_cast<size_t>(end - cursor);
+		m_valid = true;
+	}
+
+	bool GraphReader::Read(Arena& arena)
+	{
+		if (!m_valid)
+		{
+			return false;
+		}
+
+		std::vector<const TypeInfo*> types(m_typeNames.size(), nullptr);
+		std::vector<size_t> counts(m_typeNames.size(), 0);
+
+		// The types found stay in use while the objects are loaded.
+		TypeManager::ReadGuard guard;
+
+		for (size_t index = 0; index < m_typeNames.size(); ++index)
+		{
+			const TypeInfo* type = TypeManager::GetHandle().FindType(m_typeNames[index]);
+			types[index] = ((nullptr != type) && type->IsConstructible()) ? type : nullptr;
+		}
+
+		for (const uint32_t typeIndex : m_objectTypes)
+		{
+			++counts[typeIndex];
+		}
+
+		// One allocation per type : the objects of a type are contiguous, constructed in identifier order.
+		std::vector<char*> blocks(m_typeNames.size(), nullptr);
+
+		for (size_t index = 0; index < types.size(); ++index)
+		{
+			if (nullptr != types[index])
+			{
+				blocks[index] = static_cast<char*>(arena.Allocate(types[index]->GetTypeSize() * counts[index], types[index]->GetTypeAlignment()));
+			}
+		}
+
+		m_objects.assign(m_objectTypes.size(), Object{ nullptr, nullptr });
+		std::fill(counts.begin(), counts.end(), 0);
+
+		for (size_t index = 0; index < m_objectTypes.size(); ++index)
+		{
+			const uint32_t typeIndex = m_objectTypes[index];
+			const TypeInfo* type = types[typeIndex];
+
+			if ((nullptr == type) || (nullptr == blocks[typeIndex]))
+			{
+				continue;
+			}
+
+			void* address = blocks[typeIndex] + type->GetTypeSize() * counts[typeIndex]++;
+			if (type->Construct(address))
+			{
+				arena.AddFinalizer(address, type->GetDestructFunc());
+				m_objects[index] = Object{ type, address };
+			}
+		}
+
+		BinaryReader reader(m_binary, m_binarySize);
+		reader.SetObjectResolveFunc([this](uint32_t id, const TypeInfo* type)
+		{
+			return Resolve(id, type);
+		});
+
+		for (const Object& object : m_objects)
+		{
+			const bool isRead = (nullptr != object.address) ? reader.Read(object.type, object.address) : reader.Skip();
+			if (!isRead)
+			{
+				m_valid = false;
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	void* GraphReader::GetRoot(size_t index, const TypeInfo* type) const
+	{
+		return (index < m_roots.size()) ? Resolve(m_roots[index], type) : nullptr;
+	}
+
+	size_t GraphReader::GetRootCount() const
+	{
+		return m_roots.size();
+	}
+
+	size_t GraphReader::GetObjectCount() const
+	{
+		return m_objectTypes.size();
+	}
+
+	bool GraphReader::IsValid() const
+	{
+		return m_valid;
+	}
+
+	void* GraphReader::Resolve(uint32_t id, const TypeInfo* type) const
+	{
+		if ((0 == id) || (m_objects.size() < id) || (nullptr == type))
+		{
+			return nullptr;
+		}
+
+		const Object& object = m_objects[id - 1];
+
+		ptrdiff_t offset = 0;
+		if ((nullptr == object.address) || !object.type->GetBaseOffset(type, offset))
+		{
+			return nullptr;
+		}
+
+		return static_cast<char*>(object.address) + offset;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,118 @@
+#include "Serialization/GraphWriter.h"
+
+#include <cstring>
+
+namespace Reflection
+{
+	GraphWriter::GraphWriter()
+		: m_binary()
+		, m_typeTable()
+		, m_typeIndices()
+		, m_objectIds()
+		, m_objectTypes()
+		, m_pending()
+		, m_written(0)
+		, m_roots()
+	{
+		m_binary.SetObjectIdFunc([this](const TypeInfo* type, const void* object)
+		{
+			return GetObjectId(type, object);
+		});
+	}
+
+	void GraphWriter::Write(const TypeInfo* type, const void* root)
+	{
+		if ((nullptr == type) || (nullptr == root))
+		{
+			return;
+		}
+
+		m_roots.push_back(GetObjectId(type, root));
+
+		// Writing an object queues the new objects it points to, so the objects are written in identifier order.
+		while (m_written < m_pending.size())
+		{
+			const Pending pending = m_pending[m_written++];
+			m_binary.Write(pending.type, pending.object);
+		}
+	}
+
+	std::vector<char> GraphWriter::GetBuffer() const
+	{
+		const uint32_t header[6] = { MagicNumber, CurrentVersion, static_cast<uint32_t>(m_typeIndices.size()),
+									static_cast<uint32_t>(m_objectTypes.size()), static_cast<uint32_t>(m_roots.size()), 0 };
+
+		const std::vector<char> binary = m_binary.GetBuffer();
+		const size_t objectBytes = m_objectTypes.size() * sizeof(uint32_t);
+		const size_t rootBytes = m_roots.size() * sizeof(uint32_t);
+
+		std::vector<char> buffer(sizeof(header) + m_typeTable.size() + objectBytes + rootBytes + binary.size());
+		char* output = buffer.data();
+
+		std::memcpy(output, header, sizeof(header));
+		output += sizeof(header);
+
+		auto append = [&output](const void* data, size_t size)
+		{
+			if (0 < size)
+			{
+				std::memcpy(output, data, size);
+				output += size;
+			}
+		};
+
+		append(m_typeTable.data(), m_typeTable.size());
+		append(m_objectTypes.data(), objectBytes);
+		append(m_roots.data(), rootBytes);
+		append(binary.data(), binary.size());
+
+		return buffer;
+	}
+
+	size_t GraphWriter::GetObjectCount() const
+	{
+		return m_objectTypes.size();
+	}
+
+	void GraphWriter::Clear()
+	{
+		m_binary.Clear();
+		m_typeTable.clear();
+		m_typeIndices.clear();
+		m_objectIds.Clear();
+		m_objectTypes.clear();
+		m_pending.clear();
+		m_written = 0;
+		m_roots.clear();
+	}
+
+	uint32_t GraphWriter::GetObjectId(const TypeInfo* type, const void* object)
+	{
+		// Identity is the complete object : pointers to different bases of one object share an identifier,
+		// and the object is recorded with its dynamic type, so a base pointer loads back the derived object.
+		ptrdiff_t offset = 0;
+		const TypeInfo* runtimeType = type->GetCompleteType(object, offset);
+		object = static_cast<const char*>(object) - offset;
+
+		uint32_t id = 0;
+		if (!m_objectIds.Insert(object, static_cast<uint32_t>(m_objectTypes.size() + 1), id))
+		{
+			return id;
+		}
+
+		auto typeResult = m_typeIndices.try_emplace(runtimeType, static_cast<uint32_t>(m_typeIndices.size()));
+		if (typeResult.second)
+		{
+			const std::string_view name = runtimeType->GetTypeName();
+			const uint32_t length = static_cast<uint32_t>(name.size());
+
+			m_typeTable.insert(m_typeTable.end(), reinterpret_cast<const char*>(&length), reinterpret_cast<const char*>(&length) + sizeof(length));
+			m_typeTable.insert(m_typeTable.end(), name.begin(), name.end());
+		}
+
+		m_objectTypes.push_back(typeResult.first->second);
+		m_pending.push_back({ runtimeType, object });
+
+		return id;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,851 @@
+#include "Serialization/JsonReader.h"
+
+#include "Property/PropertyInfo.h"
+#include "Property/ContainerPropertyInfo.h"
+#include "Serialization/ScratchValue.h"
+
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace Reflection
+{
+	namespace
+	{
+		bool IsWhitespace(char value)
+		{
+			return (' ' == value) || ('\n' == value) || ('\r' == value) || ('\t' == value);
+		}
+
+		bool IsNumberCharacter(char value)
+		{
+			return (('0' <= value) && (value <= '9')) || ('-' == value) || ('+' == value) || ('.' == value) || ('e' == value) || ('E' == value);
+		}
+
+		bool IsString(TypeInfo::Primitive primitive)
+		{
+			return (TypeInfo::Primitive::String == primitive) || (TypeInfo::Primitive::StringView == primitive);
+		}
+
+		/**
+		 * @brief	Matches a key against a qualified property name, with or without its "Owner::" prefix.
+		 */
+		bool MatchName(std::string_view name, std::string_view key)
+		{
+			if (name.size() == key.size())
+			{
+				return 0 == name.compare(key);
+			}
+
+			if (name.size() < key.size() + 2)
+			{
+				return false;
+			}
+
+			const size_t prefix = name.size() - key.size();
+
+			return (':' == name[prefix - 1]) && (':' == name[prefix - 2]) && (0 == name.compare(prefix, key.size(), key));
+		}
+
+		size_t EncodeUtf8(uint32_t codePoint, char* output)
+		{
+			if (codePoint < 0x80)
+			{
+				output[0] = static_cast<char>(codePoint);
+				return 1;
+			}
+			else if (codePoint < 0x800)
+			{
+				output[0] = static_cast<char>(0xC0 | (codePoint >> 6));
+				output[1] = static_cast<char>(0x80 | (codePoint & 0x3F));
+				return 2;
+			}
+			else if (codePoint < 0x10000)
+			{
+				output[0] = static_cast<char>(0xE0 | (codePoint >> 12));
+				output[1] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+				output[2] = static_cast<char>(0x80 | (codePoint & 0x3F));
+				return 3;
+			}
+			else
+			{
+				output[0] = static_cast<char>(0xF0 | (codePoint >> 18));
+				output[1] = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+				output[2] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+				output[3] = static_cast<char>(0x80 | (codePoint & 0x3F));
+				return 4;
+			}
+		}
+
+		bool ParseHex(const char* input, uint32_t& value)
+		{
+			value = 0;
+
+			for (size_t index = 0; index < 4; ++index)
+			{
+				const char digit = input[index];
+				value <<= 4;
+
+				if (('0' <= digit) && (digit <= '9'))
+				{
+					value |= static_cast<uint32_t>(digit - '0');
+				}
+				else if (('a' <= digit) && (digit <= 'f'))
+				{
+					value |= static_cast<uint32_t>(digit - 'a' + 10);
+				}
+				else if (('A' <= digit) && (digit <= 'F'))
+				{
+					value |= static_cast<uint32_t>(digit - 'A' + 10);
+				}
+				else
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		const TypeInfo* GetElementType(const ContainerPropertyInfo* container)
+		{
+			if (const auto* arrayInfo = Cast<const ArrayPropertyInfo*>(container))
+			{
+				return arrayInfo->GetValueType();
+			}
+			else if (const auto* setInfo = Cast<const SetPropertyInfo*>(container))
+			{
+				return setInfo->GetValueType();
+			}
+			else
+			{
+				return nullptr;
+			}
+		}
+	}
+
+	JsonReader::JsonReader(std::string_view input)
+		: m_begin(input.data())
+		, m_cursor(input.data())
+		, m_end(input.data() + input.size())
+		, m_strings()
+		, m_error()
+	{}
+
+	bool JsonReader::Read(const TypeInfo* type, void* instance)
+	{
+		if ((nullptr == type) || (nullptr == instance))
+		{
+			return Fail("Invalid instance");
+		}
+
+		m_error.clear();
+
+		return ReadValue(type, instance);
+	}
+
+	const std::string& JsonReader::GetError() const
+	{
+		return m_error;
+	}
+
+	size_t JsonReader::GetOffset() const
+	{
+		return static_cast<size_t>(m_cursor - m_begin);
+	}
+
+	bool JsonReader::ReadValue(const TypeInfo* type, void* value)
+	{
+		if (ConsumeNull())
+		{
+			return true;
+		}
+
+		const TypeInfo::Primitive primitive = type->GetPrimitive();
+
+		if (const EnumInfo* enumInfo = type->GetEnumInfo())
+		{
+			return ReadEnum(enumInfo, primitive, value);
+		}
+		else if (TypeInfo::Primitive::None != primitive)
+		{
+			return ReadPrimitive(primitive, value);
+		}
+		else if (type->IsPointer() || type->GetPropertyList().empty())
+		{
+			return SkipValue();
+		}
+		else
+		{
+			return ReadObject(type->GetRuntimeType(value), value);
+		}
+	}
+
+	bool JsonReader::ReadObject(const TypeInfo* type, void* instance)
+	{
+		if (!Consume('{'))
+		{
+			return Fail("Expected '{'");
+		}
+
+		if (Consume('}'))
+		{
+			return true;
+		}
+
+		const TypeInfo::PropertyRange properties = type->GetPropertiesWithout(PropertyFlag::Transient);
+		const size_t propertyCount = properties.size();
+		size_t expected = 0;
+
+		while (true)
+		{
+			std::string_view key;
+			if (!ReadString(key) || !Consume(':'))
+			{
+				return Fail("Expected a key");
+			}
+
+			size_t found = propertyCount;
+
+			if ((expected < propertyCount) && MatchName(properties[expected]->GetPropertyName(), key))
+			{
+				found = expected;
+			}
+			else
+			{
+				for (size_t index = 0; index < propertyCount; ++index)
+				{
+					if (MatchName(properties[index]->GetPropertyName(), key))
+					{
+						found = index;
+						break;
+					}
+				}
+			}
+
+			if (found < propertyCount)
+			{
+				if (!ReadProperty(properties[found], instance))
+				{
+					return false;
+				}
+
+				expected = found + 1;
+			}
+			else if (!SkipValue())
+			{
+				return false;
+			}
+
+			if (Consume(','))
+			{
+				continue;
+			}
+			else if (Consume('}'))
+			{
+				return true;
+			}
+			else
+			{
+				return Fail("Expected ',' or '}'");
+			}
+		}
+	}
+
+	bool JsonReader::ReadProperty(const PropertyInfo* property, void* instance)
+	{
+		if (ConsumeNull())
+		{
+			return true;
+		}
+
+		const TypeInfo* propertyType = property->GetPropertyType();
+		const TypeInfo::Primitive primitive = propertyType->GetPrimitive();
+
+		// std::string is assigned in place from the input instead of through a temporary string.
+		if (TypeInfo::Primitive::String == primitive)
+		{
+			std::string_view value;
+			if (!ReadString(value))
+			{
+				return false;
+			}
+
+			static_cast<std::string*>(property->GetRaw(instance))->assign(value.data(), value.size());
+			property->MarkWritten(instance);
+
+			return true;
+		}
+		else if (TypeInfo::Primitive::None != primitive)
+		{
+			union Scalar
+			{
+				uint64_t integer;
+				double number;
+				std::string_view string;
+
+				Scalar() : integer(0) {}
+			} scalar;
+
+			const EnumInfo* enumInfo = propertyType->GetEnumInfo();
+			const bool read = (nullptr != enumInfo) ? ReadEnum(enumInfo, primitive, &scalar) : ReadPrimitive(primitive, &scalar);
+
+			if (!read)
+			{
+				return false;
+			}
+
+			property->SetRaw(instance, &scalar);
+
+			return true;
+		}
+
+		void* address = property->GetRaw(instance);
+		bool result = false;
+
+		if (const ContainerPropertyInfo* container = Cast<const ContainerPropertyInfo*>(property))
+		{
+			result = ReadContainer(container, address);
+		}
+		else if (propertyType->IsPointer() || propertyType->GetPropertyList().empty())
+		{
+			return SkipValue();
+		}
+		else
+		{
+			result = ReadObject(propertyType->GetRuntimeType(address), address);
+		}
+
+		property->MarkWritten(instance);
+
+		return result;
+	}
+
+	bool JsonReader::ReadContainer(const ContainerPropertyInfo* container, void* address)
+	{
+		if (Cast<const MapPropertyInfo*>(container))
+		{
+			return ReadMap(container, address);
+		}
+
+		const TypeInfo* elementType = GetElementType(container);
+		if (nullptr == elementType)
+		{
+			return SkipValue();
+		}
+
+		if (Cast<const SetPropertyInfo*>(container))
+		{
+			return ReadKeyed(container, elementType, address);
+		}
+		else
+		{
+			return ReadArray(container, elementType, address);
+		}
+	}
+
+	bool JsonReader::ReadArray(const ContainerPropertyInfo* container, const TypeInfo* elementType, void* address)
+	{
+		if (!Consume('['))
+		{
+			return Fail("Expected '['");
+		}
+
+		if (!container->CanInsert())
+		{
+			// Fixed size arrays: the elements are updated in place and the extra values are skipped.
+			auto itr = container->begin(address);
+			const auto end = container->end(address);
+
+			if (Consume(']'))
+			{
+				return true;
+			}
+
+			do
+			{
+				if (itr != end)
+				{
+					if (!ReadValue(elementType, const_cast<void*>(itr.get())))
+					{
+						return false;
+					}
+
+					++itr;
+				}
+				else if (!SkipValue())
+				{
+					return false;
+				}
+			} while (Consume(','));
+
+			return Consume(']') || Fail("Expected ',' or ']'");
+		}
+
+		ScratchValue element(elementType);
+		if (!element.IsValid() || !container->Clear(address))
+		{
+			return Fail("Array cannot be rebuilt");
+		}
+
+		if (Consume(']'))
+		{
+			return true;
+		}
+
+		do
+		{
+			// Appending a default element and parsing into it avoids copying the parsed value.
+			void* stored = container->Insert(address, element.Get());
+			if ((nullptr == stored) || !ReadValue(elementType, stored))
+			{
+				return Fail("Invalid array element");
+			}
+		} while (Consume(','));
+
+		return Consume(']') || Fail("Expected ',' or ']'");
+	}
+
+	bool JsonReader::ReadKeyed(const ContainerPropertyInfo* container, const TypeInfo* elementType, void* address)
+	{
+		if (!Consume('['))
+		{
+			return Fail("Expected '['");
+		}
+
+		ScratchValue element(elementType);
+		if (!element.IsValid() || !container->CanInsert() || !container->Clear(address))
+		{
+			return Fail("Set cannot be rebuilt");
+		}
+
+		if (Consume(']'))
+		{
+			return true;
+		}
+
+		do
+		{
+			element.Reset();
+
+			if (!ReadValue(elementType, element.Get()))
+			{
+				return false;
+			}
+
+			container->Insert(address, element.Get());
+		} while (Consume(','));
+
+		return Consume(']') || Fail("Expected ',' or ']'");
+	}
+
+	bool JsonReader::ReadMap(const ContainerPropertyInfo* container, void* address)
+	{
+		const MapPropertyInfo* mapInfo = Cast<const MapPropertyInfo*>(container);
+		const TypeInfo* keyType = mapInfo->GetKeyType();
+		const TypeInfo* mappedType = mapInfo->GetMappedType();
+
+		SkipWhitespace();
+
+		const bool objectForm = (m_cursor < m_end) && ('{' == *m_cursor);
+		if (objectForm && !IsString(keyType->GetPrimitive()))
+		{
+			return Fail("Map keys are not strings");
+		}
+
+		if (!Consume(objectForm ? '{' : '['))
+		{
+			return Fail("Expected '{' or '['");
+		}
+
+		ScratchValue element(mapInfo->GetValueType());
+		if (!element.IsValid() || !container->CanInsert() || !container->Clear(address))
+		{
+			return Fail("Map cannot be rebuilt");
+		}
+
+		const char close = objectForm ? '}' : ']';
+
+		if (Consume(close))
+		{
+			return true;
+		}
+
+		do
+		{
+			element.Reset();
+
+			// The key of a value_type is const; it is written before the element is inserted.
+			void* key = const_cast<void*>(mapInfo->GetRawKey(element.Get()));
+			void* mapped = const_cast<void*>(mapInfo->GetRawMapped(element.Get()));
+
+			if (objectForm)
+			{
+				if (!ReadPrimitive(keyType->GetPrimitive(), key) || !Consume(':') || !ReadValue(mappedType, mapped))
+				{
+					return Fail("Invalid map entry");
+				}
+			}
+			else
+			{
+				if (!Consume('[') || !ReadValue(keyType, key) || !Consume(',') || !ReadValue(mappedType, mapped) || !Consume(']'))
+				{
+					return Fail("Invalid map entry");
+				}
+			}
+
+			container->Insert(address, element.Get());
+		} while (Consume(','));
+
+		return Consume(close) || Fail("Expected ',' or the end of the map");
+	}
+
+	bool JsonReader::ReadPrimitive(TypeInfo::Primitive primitive, void* value)
+	{
+		switch (primitive)
+		{
+			case TypeInfo::Primitive::Bool :	return ReadBool(*static_cast<bool*>(value));
+			case TypeInfo::Primitive::Int8 :	return ReadNumber(*static_cast<int8_t*>(value));
+			case TypeInfo::Primitive::Int16 :	return ReadNumber(*static_cast<int16_t*>(value));
+			case TypeInfo::Primitive::Int32 :	return ReadNumber(*static_cast<int32_t*>(value));
+			case TypeInfo::Primitive::Int64 :	return ReadNumber(*static_cast<int64_t*>(value));
+			case TypeInfo::Primitive::UInt8 :	return ReadNumber(*static_cast<uint8_t*>(value));
+			case TypeInfo::Primitive::UInt16 :	return ReadNumber(*static_cast<uint16_t*>(value));
+			case TypeInfo::Primitive::UInt32 :	return ReadNumber(*static_cast<uint32_t*>(value));
+			case TypeInfo::Primitive::UInt64 :	return ReadNumber(*static_cast<uint64_t*>(value));
+			case TypeInfo::Primitive::Float :	return ReadNumber(*static_cast<float*>(value));
+			case TypeInfo::Primitive::Double :	return ReadNumber(*static_cast<double*>(value));
+			case TypeInfo::Primitive::String :
+			{
+				std::string_view view;
+				if (!ReadString(view))
+				{
+					return false;
+				}
+
+				static_cast<std::string*>(value)->assign(view.data(), view.size());
+				return true;
+			}
+			case TypeInfo::Primitive::StringView :
+				return ReadString(*static_cast<std::string_view*>(value));
+			default :
+				return SkipValue();
+		}
+	}
+
+	bool JsonReader::ReadEnum(const EnumInfo* enumInfo, TypeInfo::Primitive primitive, void* value)
+	{
+		SkipWhitespace();
+
+		if ((m_cursor >= m_end) || ('"' != *m_cursor))
+		{
+			return ReadPrimitive(primitive, value);
+		}
+
+		std::string_view name;
+		if (!ReadString(name))
+		{
+			return false;
+		}
+
+		uint64_t bits = 0;
+		const bool found = enumInfo->IsFlags() ? enumInfo->ParseFlags(name, bits) : enumInfo->GetValue(name, bits);
+
+		if (!found)
+		{
+			return Fail("Unknown enum name");
+		}
+
+		enumInfo->Write(value, bits);
+		return true;
+	}
+
+	bool JsonReader::ReadString(std::string_view& value)
+	{
+		if (!Consume('"'))
+		{
+			return Fail("Expected a string");
+		}
+
+		const char* start = m_cursor;
+		const char* position = start;
+		bool escaped = false;
+
+		while ((position < m_end) && ('"' != *position))
+		{
+			if ('\\' == *position)
+			{
+				escaped = true;
+				++position;
+			}
+
+			++position;
+		}
+
+		if (position >= m_end)
+		{
+			return Fail("Unterminated string");
+		}
+
+		m_cursor = position + 1;
+
+		if (!escaped)
+		{
+			value = std::string_view(start, static_cast<size_t>(position - start));
+			return true;
+		}
+
+		// The decoded string is never longer than its escaped form.
+		char* output = static_cast<char*>(m_strings.Allocate(static_cast<size_t>(position - start), 1));
+		size_t size = 0;
+
+		for (const char* input = start; input < position; ++input)
+		{
+			if ('\\' != *input)
+			{
+				output[size++] = *input;
+				continue;
+			}
+
+			++input;
+
+			switch (*input)
+			{
+				case 'b' :	output[size++] = '\b'; break;
+				case 'f' :	output[size++] = '\f'; break;
+				case 'n' :	output[size++] = '\n'; break;
+				case 'r' :	output[size++] = '\r'; break;
+				case 't' :	output[size++] = '\t'; break;
+				case 'u' :
+				{
+					uint32_t codePoint = 0;
+					if ((position - input < 5) || !ParseHex(input + 1, codePoint))
+					{
+						m_cursor = input;
+						return Fail("Invalid unicode escape");
+					}
+
+					input += 4;
+
+					uint32_t low = 0;
+					if ((0xD800 <= codePoint) && (codePoint < 0xDC00) && (position - input >= 7)
+						&& ('\\' == input[1]) && ('u' == input[2]) && ParseHex(input + 3, low) && (0xDC00 <= low) && (low < 0xE000))
+					{
+						codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+						input += 6;
+					}
+
+					size += EncodeUtf8(codePoint, output + size);
+					break;
+				}
+				default :
+					output[size++] = *input;
+					break;
+			}
+		}
+
+		value = std::string_view(output, size);
+
+		return true;
+	}
+
+	bool JsonReader::ReadBool(bool& value)
+	{
+		SkipWhitespace();
+
+		const size_t remaining = static_cast<size_t>(m_end - m_cursor);
+
+		if ((remaining >= 4) && (0 == std::memcmp(m_cursor, "true", 4)))
+		{
+			value = true;
+			m_cursor += 4;
+			return true;
+		}
+		else if ((remaining >= 5) && (0 == std::memcmp(m_cursor, "false", 5)))
+		{
+			value = false;
+			m_cursor += 5;
+			return true;
+		}
+
+		return Fail("Expected a boolean");
+	}
+
+	template<typename T>
+	bool JsonReader::ReadNumber(T& value)
+	{
+		SkipWhitespace();
+
+		T number = T();
+		const std::from_chars_result result = std::from_chars(m_cursor, m_end, number);
+		if (std::errc::result_out_of_range == result.ec)
+		{
+			return Fail("Number out of range");
+		}
+		else if (std::errc() != result.ec)
+		{
+			return Fail("Invalid number");
+		}
+
+		if constexpr (std::is_integral<T>::value)
+		{
+			// Integers written with a fraction or an exponent are read as doubles and truncated.
+			if ((result.ptr < m_end) && (('.' == *result.ptr) || ('e' == *result.ptr) || ('E' == *result.ptr)))
+			{
+				double real = 0.0;
+				const std::from_chars_result fallback = std::from_chars(m_cursor, m_end, real);
+				if (std::errc::result_out_of_range == fallback.ec)
+				{
+					return Fail("Number out of range");
+				}
+				else if (std::errc() != fallback.ec)
+				{
+					return Fail("Invalid number");
+				}
+
+				// Converting a double outside the range of T is undefined, so it is rejected like an integer overflow.
+				const double truncated = std::trunc(real);
+				if (!(truncated >= static_cast<double>(std::numeric_limits<T>::lowest())) || !(truncated < static_cast<double>(std::numeric_limits<T>::max()) + 1.0))
+				{
+					return Fail("Number out of range");
+				}
+
+				value = static_cast<T>(truncated);
+				m_cursor = fallback.ptr;
+				return true;
+			}
+		}
+		else
+		{
+			// from_chars accepts nan and inf, which are not JSON : the writer stores non-finite values as null.
+			if (!std::isfinite(number))
+			{
+				return Fail("Invalid number");
+			}
+		}
+
+		value = number;
+		m_cursor = result.ptr;
+
+		return true;
+	}
+
+	bool JsonReader::SkipValue()
+	{
+		SkipWhitespace();
+
+		if (m_cursor >= m_end)
+		{
+			return Fail("Unexpected end of input");
+		}
+
+		switch (*m_cursor)
+		{
+			case '"' :
+			{
+				std::string_view ignored;
+				return ReadString(ignored);
+			}
+			case '{' :
+			{
+				++m_cursor;
+				if (Consume('}'))
+				{
+					return true;
+				}
+
+				do
+				{
+					std::string_view ignored;
+					if (!ReadString(ignored) || !Consume(':') || !SkipValue())
+					{
+						return Fail("Invalid object");
+					}
+				} while (Consume(','));
+
+				return Consume('}') || Fail("Expected ',' or '}'");
+			}
+			case '[' :
+			{
+				++m_cursor;
+				if (Consume(']'))
+				{
+					return true;
+				}
+
+				do
+				{
+					if (!SkipValue())
+					{
+						return false;
+					}
+				} while (Consume(','));
+
+				return Consume(']') || Fail("Expected ',' or ']'");
+			}
+			case 't' :
+			case 'f' :
+			{
+				bool ignored = false;
+				return ReadBool(ignored);
+			}
+			case 'n' :
+				return ConsumeNull() || Fail("Expected null");
+			default :
+			{
+				const char* start = m_cursor;
+				while ((m_cursor < m_end) && IsNumberCharacter(*m_cursor))
+				{
+					++m_cursor;
+				}
+
+				return (start != m_cursor) || Fail("Unexpected character");
+			}
+		}
+	}
+
+	void JsonReader::SkipWhitespace()
+	{
+		while ((m_cursor < m_end) && IsWhitespace(*m_cursor))
+		{
+			++m_cursor;
+		}
+	}
+
+	bool JsonReader::Consume(char expected)
+	{
+		SkipWhitespace();
+
+		if ((m_cursor < m_end) && (expected == *m_cursor))
+		{
+			++m_cursor;
+			return true;
+		}
+
+		return false;
+	}
+
+	bool JsonReader::ConsumeNull()
+	{
+		SkipWhitespace();
+
+		if ((m_end - m_cursor >= 4) && (0 == std::memcmp(m_cursor, "null", 4)))
+		{
+			m_cursor += 4;
+			return true;
+		}
+
+		return false;
+	}
+
+	bool JsonReader::Fail(const char* message)
+	{
+		if (m_error.empty())
+		{
+			m_error = message;
+		}
+
+		return false;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,455 @@
+#include "Serialization/JsonWriter.h"
+
+#include "Property/PropertyInfo.h"
+#include "Property/ContainerPropertyInfo.h"
+
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <string>
+
+namespace Reflection
+{
+	namespace
+	{
+		constexpr size_t MaxNumberLength = 32;
+		constexpr size_t MaxEnumTextLength = 256;
+
+		bool NeedsEscape(unsigned char value)
+		{
+			return (value < 0x20) || ('"' == value) || ('\\' == value);
+		}
+
+		const TypeInfo* GetElementType(const ContainerPropertyInfo* container)
+		{
+			if (const auto* arrayInfo = Cast<const ArrayPropertyInfo*>(container))
+			{
+				return arrayInfo->GetValueType();
+			}
+			else if (const auto* setInfo = Cast<const SetPropertyInfo*>(container))
+			{
+				return setInfo->GetValueType();
+			}
+			else
+			{
+				return nullptr;
+			}
+		}
+	}
+
+	JsonWriter::JsonWriter(char* buffer, size_t capacity, FlushFunc flush)
+		: m_buffer(buffer)
+		, m_capacity(capacity)
+		, m_size(0)
+		, m_flushed(0)
+		, m_flush(std::move(flush))
+		, m_overflowed((nullptr == buffer) || (capacity < MaxNumberLength * 2))
+	{}
+
+	bool JsonWriter::Write(const TypeInfo* type, const void* instance)
+	{
+		if ((nullptr == type) || (nullptr == instance))
+		{
+			return false;
+		}
+
+		WriteValue(type, instance);
+
+		return !m_overflowed;
+	}
+
+	bool JsonWriter::Flush()
+	{
+		if (m_overflowed || (nullptr == m_flush))
+		{
+			return false;
+		}
+
+		if (0 != m_size)
+		{
+			if (!m_flush(m_buffer, m_size))
+			{
+				m_overflowed = true;
+				return false;
+			}
+
+			m_flushed += m_size;
+			m_size = 0;
+		}
+
+		return true;
+	}
+
+	std::string_view JsonWriter::GetPending() const
+	{
+		return std::string_view(m_buffer, m_size);
+	}
+
+	size_t JsonWriter::GetWrittenBytes() const
+	{
+		return m_flushed + m_size;
+	}
+
+	bool JsonWriter::IsOverflowed() const
+	{
+		return m_overflowed;
+	}
+
+	void JsonWriter::WriteValue(const TypeInfo* type, const void* value)
+	{
+		const TypeInfo::Primitive primitive = type->GetPrimitive();
+
+		if (const EnumInfo* enumInfo = type->GetEnumInfo())
+		{
+			WriteEnum(enumInfo, primitive, value);
+		}
+		else if (TypeInfo::Primitive::None != primitive)
+		{
+			WritePrimitive(primitive, value);
+		}
+		else if (type->IsPointer() || type->GetPropertyList().empty())
+		{
+			WriteRaw("null", 4);
+		}
+		else
+		{
+			WriteObject(type->GetRuntimeType(value), value);
+		}
+	}
+
+	void JsonWriter::WriteObject(const TypeInfo* type, const void* instance)
+	{
+		WriteChar('{');
+
+		bool first = true;
+		for (const PropertyInfo* property : type->GetPropertiesWithout(PropertyFlag::Transient))
+		{
+			if (!first)
+			{
+				WriteChar(',');
+			}
+
+			first = false;
+
+			WriteString(property->GetPropertyName());
+			WriteChar(':');
+			WriteProperty(property, instance);
+		}
+
+		WriteChar('}');
+	}
+
+	void JsonWriter::WriteProperty(const PropertyInfo* property, const void* instance)
+	{
+		const TypeInfo* propertyType = property->GetPropertyType();
+		const void* address = property->GetRaw(instance);
+
+		// std::string is registered as an array of char, so the primitive check must come first.
+		if (const EnumInfo* enumInfo = propertyType->GetEnumInfo())
+		{
+			WriteEnum(enumInfo, propertyType->GetPrimitive(), address);
+		}
+		else if (TypeInfo::Primitive::None != propertyType->GetPrimitive())
+		{
+			WritePrimitive(propertyType->GetPrimitive(), address);
+		}
+		else if (const ContainerPropertyInfo* container = Cast<const ContainerPropertyInfo*>(property))
+		{
+			WriteContainer(container, address);
+		}
+		else
+		{
+			WriteValue(propertyType, address);
+		}
+	}
+
+	void JsonWriter::WriteContainer(const ContainerPropertyInfo* container, const void* address)
+	{
+		if (const auto* mapInfo = Cast<const MapPropertyInfo*>(container))
+		{
+			const TypeInfo* keyType = mapInfo->GetKeyType();
+			const TypeInfo* mappedType = mapInfo->GetMappedType();
+			const bool stringKey = (TypeInfo::Primitive::String == keyType->GetPrimitive())
+				|| (TypeInfo::Primitive::StringView == keyType->GetPrimitive());
+
+			WriteChar(stringKey ? '{' : '[');
+
+			bool first = true;
+			for (auto itr = container->begin(address), end = container->end(address); itr != end; ++itr)
+			{
+				if (!first)
+				{
+					WriteChar(',');
+				}
+
+				first = false;
+
+				const void* element = itr.get();
+
+				if (stringKey)
+				{
+					WritePrimitive(keyType->GetPrimitive(), mapInfo->GetRawKey(element));
+					WriteChar(':');
+					WriteValue(mappedType, mapInfo->GetRawMapped(element));
+				}
+				else
+				{
+					WriteChar('[');
+					WriteValue(keyType, mapInfo->GetRawKey(element));
+					WriteChar(',');
+					WriteValue(mappedType, mapInfo->GetRawMapped(element));
+					WriteChar(']');
+				}
+			}
+
+			WriteChar(stringKey ? '}' : ']');
+			return;
+		}
+
+		const TypeInfo* elementType = GetElementType(container);
+		if (nullptr == elementType)
+		{
+			WriteRaw("null", 4);
+			return;
+		}
+
+		WriteChar('[');
+
+		const char* data = static_cast<const char*>(container->GetData(address));
+		if (nullptr != data)
+		{
+			const size_t size = container->GetSize(address);
+			const size_t stride = elementType->GetTypeSize();
+
+			for (size_t index = 0; index < size; ++index)
+			{
+				if (0 != index)
+				{
+					WriteChar(',');
+				}
+
+				WriteValue(elementType, data + index * stride);
+			}
+		}
+		else
+		{
+			bool first = true;
+			for (auto itr = container->begin(address), end = container->end(address); itr != end; ++itr)
+			{
+				if (!first)
+				{
+					WriteChar(',');
+				}
+
+				first = false;
+
+				WriteValue(elementType, itr.get());
+			}
+		}
+
+		WriteChar(']');
+	}
+
+	void JsonWriter::WriteEnum(const EnumInfo* enumInfo, TypeInfo::Primitive primitive, const void* value)
+	{
+		const uint64_t bits = enumInfo->Read(value);
+
+		if (enumInfo->IsFlags())
+		{
+			char text[MaxEnumTextLength];
+			const size_t length = enumInfo->FormatFlags(bits, text, sizeof(text));
+
+			if (length < sizeof(text))
+			{
+				WriteString(std::string_view(text, length));
+				return;
+			}
+		}
+		else
+		{
+			const std::string_view name = enumInfo->GetName(bits);
+
+			if (!name.empty())
+			{
+				WriteString(name);
+				return;
+			}
+		}
+
+		// Values without a name, or masks too long for the local buffer, are written as numbers.
+		WritePrimitive(primitive, value);
+	}
+
+	void JsonWriter::WritePrimitive(TypeInfo::Primitive primitive, const void* value)
+	{
+		if (TypeInfo::Primitive::String == primitive)
+		{
+			WriteString(*static_cast<const std::string*>(value));
+			return;
+		}
+		else if (TypeInfo::Primitive::StringView == primitive)
+		{
+			WriteString(*static_cast<const std::string_view*>(value));
+			return;
+		}
+		else if (TypeInfo::Primitive::Bool == primitive)
+		{
+			if (*static_cast<const bool*>(value))
+			{
+				WriteRaw("true", 4);
+			}
+			else
+			{
+				WriteRaw("false", 5);
+			}
+
+			return;
+		}
+
+		char* first = Reserve(MaxNumberLength);
+		if (nullptr == first)
+		{
+			return;
+		}
+
+		char* last = first + MaxNumberLength;
+		std::to_chars_result result{ first, std::errc() };
+
+		switch (primitive)
+		{
+			case TypeInfo::Primitive::Int8 :	result = std::to_chars(first, last, *static_cast<const int8_t*>(value)); break;
+			case TypeInfo::Primitive::Int16 :	result = std::to_chars(first, last, *static_cast<const int16_t*>(value)); break;
+			case TypeInfo::Primitive::Int32 :	result = std::to_chars(first, last, *static_cast<const int32_t*>(value)); break;
+			case TypeInfo::Primitive::Int64 :	result = std::to_chars(first, last, *static_cast<const int64_t*>(value)); break;
+			case TypeInfo::Primitive::UInt8 :	result = std::to_chars(first, last, *static_cast<const uint8_t*>(value)); break;
+			case TypeInfo::Primitive::UInt16 :	result = std::to_chars(first, last, *static_cast<const uint16_t*>(value)); break;
+			case TypeInfo::Primitive::UInt32 :	result = std::to_chars(first, last, *static_cast<const uint32_t*>(value)); break;
+			case TypeInfo::Primitive::UInt64 :	result = std::to_chars(first, last, *static_cast<const uint64_t*>(value)); break;
+			case TypeInfo::Primitive::Float :
+			{
+				const float number = *static_cast<const float*>(value);
+				result = std::isfinite(number) ? std::to_chars(first, last, number) : std::to_chars_result{ first, std::errc::value_too_large };
+				break;
+			}
+			case TypeInfo::Primitive::Double :
+			{
+				const double number = *static_cast<const double*>(value);
+				result = std::isfinite(number) ? std::to_chars(first, last, number) : std::to_chars_result{ first, std::errc::value_too_large };
+				break;
+			}
+			default :
+				result.ec = std::errc::invalid_argument;
+				break;
+		}
+
+		if (std::errc() != result.ec)
+		{
+			std::memcpy(first, "null", 4);
+			result.ptr = first + 4;
+		}
+
+		m_size += static_cast<size_t>(result.ptr - first);
+	}
+
+	void JsonWriter::WriteString(std::string_view value)
+	{
+		static constexpr char HexDigits[] = "0123456789abcdef";
+
+		WriteChar('"');
+
+		const char* data = value.data();
+		const size_t size = value.size();
+		size_t runStart = 0;
+
+		for (size_t index = 0; index < size; ++index)
+		{
+			const unsigned char character = static_cast<unsigned char>(data[index]);
+			if (!NeedsEscape(character))
+			{
+				continue;
+			}
+
+			WriteRaw(data + runStart, index - runStart);
+			runStart = index + 1;
+
+			char escape[6] = { '\\', 0, 0, 0, 0, 0 };
+			size_t escapeSize = 2;
+
+			switch (character)
+			{
+				case '"' :	escape[1] = '"'; break;
+				case '\\' :	escape[1] = '\\'; break;
+				case '\b' :	escape[1] = 'b'; break;
+				case '\f' :	escape[1] = 'f'; break;
+				case '\n' :	escape[1] = 'n'; break;
+				case '\r' :	escape[1] = 'r'; break;
+				case '\t' :	escape[1] = 't'; break;
+				default :
+					escape[1] = 'u';
+					escape[2] = '0';
+					escape[3] = '0';
+					escape[4] = HexDigits[character >> 4];
+					escape[5] = HexDigits[character & 0xF];
+					escapeSize = 6;
+					break;
+			}
+
+			WriteRaw(escape, escapeSize);
+		}
+
+		WriteRaw(data + runStart, size - runStart);
+		WriteChar('"');
+	}
+
+	void JsonWriter::WriteRaw(const char* data, size_t size)
+	{
+		while ((0 != size) && !m_overflowed)
+		{
+			if (m_size == m_capacity)
+			{
+				if (!Flush())
+				{
+					m_overflowed = true;
+					return;
+				}
+			}
+
+			const size_t available = m_capacity - m_size;
+			const size_t count = (size < available) ? size : available;
+
+			std::memcpy(m_buffer + m_size, data, count);
+			m_size += count;
+			data += count;
+			size -= count;
+		}
+	}
+
+	void JsonWriter::WriteChar(char value)
+	{
+		char* position = Reserve(1);
+		if (nullptr != position)
+		{
+			*position = value;
+			++m_size;
+		}
+	}
+
+	char* JsonWriter::Reserve(size_t size)
+	{
+		if (m_overflowed)
+		{
+			return nullptr;
+		}
+
+		if (m_size + size > m_capacity)
+		{
+			if ((size > m_capacity) || !Flush())
+			{
+				m_overflowed = true;
+				return nullptr;
+			}
+		}
+
+		return m_buffer + m_size;
+	}
+}
\ No newline at end of file
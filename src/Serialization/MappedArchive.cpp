@@ -0,0 +1,213 @@
+#include "Serialization/MappedArchive.h"
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Reflection
+{
+	MappedArchive::MappedArchive()
+		: m_data(nullptr)
+		, m_size(0)
+		, m_mapping(nullptr)
+		, m_mappingSize(0)
+		, m_fileHandle(nullptr)
+		, m_mappingHandle(nullptr)
+	{}
+
+	MappedArchive::~MappedArchive()
+	{
+		Close();
+	}
+
+	bool MappedArchive::Open(const std::string& path)
+	{
+		Close();
+
+#if defined(_WIN32)
+		HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (INVALID_HANDLE_VALUE == file)
+		{
+			return false;
+		}
+
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(file, &fileSize) || (0 == fileSize.QuadPart))
+		{
+			CloseHandle(file);
+			return false;
+		}
+
+		HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (nullptr == mapping)
+		{
+			CloseHandle(file);
+			return false;
+		}
+
+		void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		if (nullptr == view)
+		{
+			CloseHandle(mapping);
+			CloseHandle(file);
+			return false;
+		}
+
+		m_fileHandle = file;
+		m_mappingHandle = mapping;
+		m_mapping = view;
+		m_mappingSize = static_cast<size_t>(fileSize.QuadPart);
+#else
+		const int file = open(path.c_str(), O_RDONLY);
+		if (file < 0)
+		{
+			return false;
+		}
+
+		struct stat status;
+		if ((0 != fstat(file, &status)) || (0 == status.st_size))
+		{
+			close(file);
+			return false;
+		}
+
+		const size_t size = static_cast<size_t>(status.st_size);
+		void* view = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+
+		// The mapping keeps its own reference to the file.
+		close(file);
+
+		if (MAP_FAILED == view)
+		{
+			return false;
+		}
+
+		m_mapping = view;
+		m_mappingSize = size;
+#endif
+
+		m_data = static_cast<const char*>(m_mapping);
+		m_size = m_mappingSize;
+
+		if (!Validate())
+		{
+			Close();
+			return false;
+		}
+
+		return true;
+	}
+
+	bool MappedArchive::Attach(const void* data, size_t size)
+	{
+		Close();
+
+		if ((nullptr == data) || (0 != (reinterpret_cast<uintptr_t>(data) & (ArchiveHeader::Alignment - 1))))
+		{
+			return false;
+		}
+
+		m_data = static_cast<const char*>(data);
+		m_size = size;
+
+		if (!Validate())
+		{
+			Close();
+			return false;
+		}
+
+		return true;
+	}
+
+	void MappedArchive::Close()
+	{
+		if (nullptr != m_mapping)
+		{
+#if defined(_WIN32)
+			UnmapViewOfFile(m_mapping);
+			CloseHandle(static_cast<HANDLE>(m_mappingHandle));
+			CloseHandle(static_cast<HANDLE>(m_fileHandle));
+#else
+			munmap(m_mapping, m_mappingSize);
+#endif
+		}
+
+		m_data = nullptr;
+		m_size = 0;
+		m_mapping = nullptr;
+		m_mappingSize = 0;
+		m_fileHandle = nullptr;
+		m_mappingHandle = nullptr;
+	}
+
+	const void* MappedArchive::GetRoot(const TypeInfo* type) const
+	{
+		const ArchiveHeader* header = GetHeader();
+
+		if ((nullptr == header) || (nullptr == type) || !type->IsTriviallyCopyable())
+		{
+			return nullptr;
+		}
+
+		if (header->fingerprint != type->GetLayoutFingerprint())
+		{
+			return nullptr;
+		}
+
+		const char* root = m_data + header->rootOffset;
+		if (!Contains(root, type->GetTypeSize()) || (0 != (reinterpret_cast<uintptr_t>(root) & (type->GetTypeAlignment() - 1))))
+		{
+			return nullptr;
+		}
+
+		return root;
+	}
+
+	bool MappedArchive::Contains(const void* address, size_t size) const
+	{
+		const char* begin = static_cast<const char*>(address);
+
+		return (nullptr != m_data) && (m_data <= begin) && (size <= m_size) && (static_cast<size_t>(begin - m_data) <= m_size - size);
+	}
+
+	const ArchiveHeader* MappedArchive::GetHeader() const
+	{
+		return (nullptr != m_data) ? reinterpret_cast<const ArchiveHeader*>(m_data) : nullptr;
+	}
+
+	const void* MappedArchive::GetData() const
+	{
+		return m_data;
+	}
+
+	size_t MappedArchive::GetSize() const
+	{
+		return m_size;
+	}
+
+	bool MappedArchive::IsOpen() const
+	{
+		return nullptr != m_data;
+	}
+
+	bool MappedArchive::Validate()
+	{
+		if (m_size < sizeof(ArchiveHeader))
+		{
+			return false;
+		}
+
+		const ArchiveHeader* header = GetHeader();
+
+		return (ArchiveHeader::MagicNumber == header->magic)
+			&& (ArchiveHeader::CurrentVersion == header->version)
+			&& (header->size <= m_size)
+			&& (sizeof(ArchiveHeader) <= header->rootOffset)
+			&& (header->rootOffset < header->size);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,703 @@
+#include "Serialization/TypeSchema.h"
+
+#include "Property/PropertyInfo.h"
+#include "Property/ContainerPropertyInfo.h"
+#include "Type/TypeManager.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace Reflection
+{
+	namespace
+	{
+		template<typename T>
+		void Append(std::vector<char>& output, const T& value)
+		{
+			const char* bytes = reinterpret_cast<const char*>(&value);
+			output.insert(output.end(), bytes, bytes + sizeof(T));
+		}
+
+		void AppendString(std::vector<char>& output, const std::string& value)
+		{
+			Append(output, static_cast<uint32_t>(value.size()));
+			output.insert(output.end(), value.begin(), value.end());
+		}
+
+		template<typename T>
+		bool Extract(const char*& cursor, const char* end, T& value)
+		{
+			if (static_cast<size_t>(end - cursor) < sizeof(T))
+			{
+				return false;
+			}
+
+			std::memcpy(&value, cursor, sizeof(T));
+			cursor += sizeof(T);
+
+			return true;
+		}
+
+		bool ExtractString(const char*& cursor, const char* end, std::string& value)
+		{
+			uint32_t size = 0;
+			if (!Extract(cursor, end, size) || (static_cast<size_t>(end - cursor) < size))
+			{
+				return false;
+			}
+
+			value.assign(cursor, size);
+			cursor += size;
+
+			return true;
+		}
+
+		void AppendValue(std::vector<char>& output, const SchemaValue& value, const TypeSchema::SchemaIndexFunc& schemaIndex)
+		{
+			Append(output, static_cast<uint8_t>(value.kind));
+			Append(output, static_cast<uint8_t>(value.primitive));
+			Append(output, value.size);
+			Append(output, value.typeHash);
+			Append(output, (SchemaValue::Kind::Object == value.kind) ? schemaIndex(value.type) : uint32_t(0));
+		}
+
+		bool ExtractValue(const char*& cursor, const char* end, SchemaValue& value)
+		{
+			uint8_t kind = 0;
+			uint8_t primitive = 0;
+
+			if (!Extract(cursor, end, kind) || !Extract(cursor, end, primitive) || !Extract(cursor, end, value.size)
+				|| !Extract(cursor, end, value.typeHash) || !Extract(cursor, end, value.schema))
+			{
+				return false;
+			}
+
+			value.kind = static_cast<SchemaValue::Kind>(kind);
+			value.primitive = static_cast<TypeInfo::Primitive>(primitive);
+			value.type = nullptr;
+
+			return true;
+		}
+
+		uint64_t HashName(std::string_view name)
+		{
+			return static_cast<uint64_t>(Utils::HashBytes(name.data(), name.size(), 0));
+		}
+
+		SchemaValue MakeValue(const TypeInfo* type)
+		{
+			SchemaValue value;
+			value.size = type->GetTypeSize();
+			value.primitive = type->GetPrimitive();
+
+			if (TypeInfo::Primitive::String == value.primitive)
+			{
+				value.kind = SchemaValue::Kind::String;
+			}
+			else if (TypeInfo::Primitive::StringView == value.primitive)
+			{
+				value.kind = SchemaValue::Kind::None;
+			}
+			else if (TypeInfo::Primitive::None != value.primitive)
+			{
+				value.kind = SchemaValue::Kind::Primitive;
+			}
+			else if (type->IsPointer())
+			{
+				// Only pointers to objects are stored; pointers to values and to pointers cannot be given an identifier.
+				const TypeInfo* pointee = type->GetPureType();
+
+				if ((nullptr != pointee) && (TypeInfo::Primitive::None == pointee->GetPrimitive()) && !pointee->IsPointer())
+				{
+					value.kind = SchemaValue::Kind::Pointer;
+					value.typeHash = HashName(pointee->GetTypeName());
+					value.type = pointee;
+				}
+				else
+				{
+					value.kind = SchemaValue::Kind::None;
+				}
+			}
+			else if (!type->GetPropertyList().empty())
+			{
+				value.kind = SchemaValue::Kind::Object;
+				value.typeHash = type->GetLayoutFingerprint();
+				value.type = type;
+			}
+			else if (type->IsTriviallyCopyable())
+			{
+				value.kind = SchemaValue::Kind::Bytes;
+				value.typeHash = HashName(type->GetTypeName());
+			}
+
+			return value;
+		}
+
+		bool IsFloating(TypeInfo::Primitive primitive)
+		{
+			return (TypeInfo::Primitive::Float == primitive) || (TypeInfo::Primitive::Double == primitive);
+		}
+
+		bool IsSigned(TypeInfo::Primitive primitive)
+		{
+			return (TypeInfo::Primitive::Int8 == primitive) || (TypeInfo::Primitive::Int16 == primitive)
+				|| (TypeInfo::Primitive::Int32 == primitive) || (TypeInfo::Primitive::Int64 == primitive);
+		}
+
+		template<typename Source, typename T>
+		T LoadValue(const void* source)
+		{
+			Source value;
+			std::memcpy(&value, source, sizeof(Source));
+
+			return static_cast<T>(value);
+		}
+
+		template<typename T>
+		T Load(TypeInfo::Primitive primitive, const void* source)
+		{
+			switch (primitive)
+			{
+				case TypeInfo::Primitive::Bool :	return LoadValue<bool, T>(source);
+				case TypeInfo::Primitive::Int8 :	return LoadValue<int8_t, T>(source);
+				case TypeInfo::Primitive::Int16 :	return LoadValue<int16_t, T>(source);
+				case TypeInfo::Primitive::Int32 :	return LoadValue<int32_t, T>(source);
+				case TypeInfo::Primitive::Int64 :	return LoadValue<int64_t, T>(source);
+				case TypeInfo::Primitive::UInt8 :	return LoadValue<uint8_t, T>(source);
+				case TypeInfo::Primitive::UInt16 :	return LoadValue<uint16_t, T>(source);
+				case TypeInfo::Primitive::UInt32 :	return LoadValue<uint32_t, T>(source);
+				case TypeInfo::Primitive::UInt64 :	return LoadValue<uint64_t, T>(source);
+				case TypeInfo::Primitive::Float :	return LoadValue<float, T>(source);
+				case TypeInfo::Primitive::Double :	return LoadValue<double, T>(source);
+				default :							return T(0);
+			}
+		}
+
+		/**
+		 * @brief	Stores value as a Target, or returns false if Target cannot represent it.
+		 * @details	Converting an out of range or NaN floating value to an integer is undefined, and so is narrowing a finite double
+		 * 			beyond the range of float. Integers are checked too, so a narrower field never silently wraps.
+		 */
+		template<typename Target, typename T>
+		bool StoreValue(void* target, T value)
+		{
+			if constexpr (std::is_floating_point<T>::value && std::is_integral<Target>::value)
+			{
+				const double truncated = std::trunc(value);
+				if (!(truncated >= static_cast<double>(std::numeric_limits<Target>::lowest())) || !(truncated < static_cast<double>(std::numeric_limits<Target>::max()) + 1.0))
+				{
+					return false;
+				}
+			}
+			else if constexpr (std::is_floating_point<T>::value && std::is_floating_point<Target>::value)
+			{
+				if (std::isfinite(value) && (static_cast<T>(std::numeric_limits<Target>::max()) < std::fabs(value)))
+				{
+					return false;
+				}
+			}
+			else if constexpr (std::is_integral<T>::value && std::is_integral<Target>::value)
+			{
+				if (std::is_signed<T>::value && (value < T(0)))
+				{
+					if (!std::is_signed<Target>::value || (static_cast<int64_t>(value) < static_cast<int64_t>(std::numeric_limits<Target>::lowest())))
+					{
+						return false;
+					}
+				}
+				else if (static_cast<uint64_t>(std::numeric_limits<Target>::max()) < static_cast<uint64_t>(value))
+				{
+					return false;
+				}
+			}
+
+			*static_cast<Target*>(target) = static_cast<Target>(value);
+			return true;
+		}
+
+		template<typename T>
+		bool Store(TypeInfo::Primitive primitive, void* target, T value)
+		{
+			switch (primitive)
+			{
+				case TypeInfo::Primitive::Bool :	*static_cast<bool*>(target) = (T(0) != value); return true;
+				case TypeInfo::Primitive::Int8 :	return StoreValue<int8_t>(target, value);
+				case TypeInfo::Primitive::Int16 :	return StoreValue<int16_t>(target, value);
+				case TypeInfo::Primitive::Int32 :	return StoreValue<int32_t>(target, value);
+				case TypeInfo::Primitive::Int64 :	return StoreValue<int64_t>(target, value);
+				case TypeInfo::Primitive::UInt8 :	return StoreValue<uint8_t>(target, value);
+				case TypeInfo::Primitive::UInt16 :	return StoreValue<uint16_t>(target, value);
+				case TypeInfo::Primitive::UInt32 :	return StoreValue<uint32_t>(target, value);
+				case TypeInfo::Primitive::UInt64 :	return StoreValue<uint64_t>(target, value);
+				case TypeInfo::Primitive::Float :	return StoreValue<float>(target, value);
+				case TypeInfo::Primitive::Double :	return StoreValue<double>(target, value);
+				default :							return false;
+			}
+		}
+
+		/**
+		 * @brief	Removes the owner qualifiers of every segment of a field path ("A::m_b.B::m_c" -> "m_b.m_c").
+		 */
+		std::string GetShortName(const std::string& name)
+		{
+			std::string shortName;
+			shortName.reserve(name.size());
+
+			size_t start = 0;
+			while (start <= name.size())
+			{
+				size_t end = name.find('.', start);
+				if (std::string::npos == end)
+				{
+					end = name.size();
+				}
+
+				size_t qualifier = name.rfind("::", end);
+				const size_t segment = ((std::string::npos != qualifier) && (qualifier >= start)) ? qualifier + 2 : start;
+
+				if (!shortName.empty())
+				{
+					shortName.push_back('.');
+				}
+
+				shortName.append(name, segment, end - segment);
+				start = end + 1;
+			}
+
+			return shortName;
+		}
+
+		void MergeRuns(std::vector<SchemaRun>& runs)
+		{
+			std::sort(runs.begin(), runs.end(), [](const SchemaRun& lhs, const SchemaRun& rhs)
+			{
+				return lhs.source < rhs.source;
+			});
+
+			std::vector<SchemaRun> merged;
+			merged.reserve(runs.size());
+
+			for (const SchemaRun& run : runs)
+			{
+				if (!merged.empty())
+				{
+					SchemaRun& last = merged.back();
+					if ((last.source + last.size == run.source) && (last.target + last.size == run.target))
+					{
+						last.size += run.size;
+						continue;
+					}
+				}
+
+				merged.push_back(run);
+			}
+
+			runs = std::move(merged);
+		}
+	}
+
+	namespace
+	{
+		/**
+		 * @brief	The schemas and remaps built so far, dropped with their type when it is unregistered.
+		 */
+		struct SchemaCache
+		{
+			std::mutex schemaMutex;
+			std::unordered_map<const TypeInfo*, std::unique_ptr<TypeSchema>> schemas;
+
+			std::mutex remapMutex;
+			std::map<std::pair<uint64_t, const TypeInfo*>, std::unique_ptr<SchemaRemap>> remaps;
+		};
+
+		void ForgetType(const TypeInfo* type);
+
+		SchemaCache& GetCache()
+		{
+			static SchemaCache s_cache;
+			static const bool s_isListening = (TypeManager::GetHandle().AddUnregistListener(&ForgetType), true);
+
+			(void)s_isListening;
+			return s_cache;
+		}
+
+		void ForgetType(const TypeInfo* type)
+		{
+			SchemaCache& cache = GetCache();
+
+			// A reloaded plugin may register a new type at the same address, which must not find the old schema.
+			{
+				std::lock_guard<std::mutex> lock(cache.remapMutex);
+
+				for (auto itr = cache.remaps.begin(); itr != cache.remaps.end();)
+				{
+					itr = (itr->first.second == type) ? cache.remaps.erase(itr) : std::next(itr);
+				}
+			}
+
+			std::lock_guard<std::mutex> lock(cache.schemaMutex);
+			cache.schemas.erase(type);
+		}
+	}
+
+	TypeSchema::TypeSchema()
+		: m_name()
+		, m_fingerprint(0)
+		, m_size(0)
+		, m_flat(false)
+		, m_fields()
+		, m_runs()
+		, m_tail()
+	{}
+
+	const TypeSchema* TypeSchema::Get(const TypeInfo* type)
+	{
+		if (nullptr == type)
+		{
+			return nullptr;
+		}
+
+		SchemaCache& cache = GetCache();
+		std::lock_guard<std::mutex> lock(cache.schemaMutex);
+
+		std::unique_ptr<TypeSchema>& schema = cache.schemas[type];
+		if (nullptr == schema)
+		{
+			schema.reset(new TypeSchema());
+			schema->m_name = type->GetTypeName();
+			schema->m_fingerprint = type->GetLayoutFingerprint();
+			schema->m_size = type->GetTypeSize();
+			schema->AddFields(type, std::string(), 0);
+			schema->Finalize();
+
+			const bool complete = std::none_of(schema->m_fields.begin(), schema->m_fields.end(), [](const SchemaField& field)
+			{
+				return SchemaValue::Kind::None == field.value.kind;
+			});
+
+			schema->m_flat = type->IsTriviallyCopyable() && complete && schema->m_tail.empty();
+		}
+
+		return schema.get();
+	}
+
+	const std::string& TypeSchema::GetName() const
+	{
+		return m_name;
+	}
+
+	uint64_t TypeSchema::GetFingerprint() const
+	{
+		return m_fingerprint;
+	}
+
+	uint64_t TypeSchema::GetSize() const
+	{
+		return m_size;
+	}
+
+	const std::vector<SchemaField>& TypeSchema::GetFields() const
+	{
+		return m_fields;
+	}
+
+	const std::vector<SchemaRun>& TypeSchema::GetRuns() const
+	{
+		return m_runs;
+	}
+
+	const std::vector<size_t>& TypeSchema::GetTail() const
+	{
+		return m_tail;
+	}
+
+	bool TypeSchema::IsFlat() const
+	{
+		return m_flat;
+	}
+
+	void TypeSchema::Serialize(std::vector<char>& output, const SchemaIndexFunc& schemaIndex) const
+	{
+		AppendString(output, m_name);
+		Append(output, m_fingerprint);
+		Append(output, m_size);
+		Append(output, static_cast<uint32_t>(m_fields.size()));
+
+		for (const SchemaField& field : m_fields)
+		{
+			AppendString(output, field.name);
+			Append(output, field.offset);
+			AppendValue(output, field.value, schemaIndex);
+			AppendValue(output, field.key, schemaIndex);
+			AppendValue(output, field.element, schemaIndex);
+		}
+	}
+
+	bool TypeSchema::Deserialize(const char*& cursor, const char* end)
+	{
+		uint32_t fieldCount = 0;
+
+		if (!ExtractString(cursor, end, m_name) || !Extract(cursor, end, m_fingerprint) || !Extract(cursor, end, m_size)
+			|| !Extract(cursor, end, fieldCount))
+		{
+			return false;
+		}
+
+		m_fields.clear();
+		m_fields.reserve(fieldCount);
+
+		for (uint32_t index = 0; index < fieldCount; ++index)
+		{
+			SchemaField field;
+
+			if (!ExtractString(cursor, end, field.name) || !Extract(cursor, end, field.offset) || !ExtractValue(cursor, end, field.value)
+				|| !ExtractValue(cursor, end, field.key) || !ExtractValue(cursor, end, field.element))
+			{
+				return false;
+			}
+
+			if ((SchemaValue::Kind::Primitive == field.value.kind || SchemaValue::Kind::Bytes == field.value.kind)
+				&& ((field.offset > m_size) || (field.value.size > m_size - field.offset)))
+			{
+				return false;
+			}
+
+			m_fields.push_back(std::move(field));
+		}
+
+		m_flat = false;
+		Finalize();
+
+		return true;
+	}
+
+	void TypeSchema::AddFields(const TypeInfo* type, const std::string& prefix, size_t base)
+	{
+		for (const PropertyInfo* property : type->GetPropertyList())
+		{
+			const TypeInfo* propertyType = property->GetPropertyType();
+
+			SchemaField field;
+			field.name = prefix + std::string(property->GetPropertyName());
+			field.offset = base + property->GetPropertyOffset();
+			field.property = property;
+
+			const ContainerPropertyInfo* container = Cast<const ContainerPropertyInfo*>(property);
+
+			if ((nullptr != container) && (TypeInfo::Primitive::String != propertyType->GetPrimitive()))
+			{
+				field.value.size = propertyType->GetTypeSize();
+
+				if (const auto* mapInfo = Cast<const MapPropertyInfo*>(container))
+				{
+					field.value.kind = SchemaValue::Kind::Map;
+					field.key = MakeValue(mapInfo->GetKeyType());
+					field.element = MakeValue(mapInfo->GetMappedType());
+				}
+				else if (const auto* setInfo = Cast<const SetPropertyInfo*>(container))
+				{
+					field.value.kind = SchemaValue::Kind::Set;
+					field.element = MakeValue(setInfo->GetValueType());
+				}
+				else if (const auto* arrayInfo = Cast<const ArrayPropertyInfo*>(container))
+				{
+					field.value.kind = SchemaValue::Kind::Array;
+					field.element = MakeValue(arrayInfo->GetValueType());
+				}
+			}
+			else
+			{
+				field.value = MakeValue(propertyType);
+
+				// Nested reflected values are stored in place: their leaves are part of the outer image.
+				if (SchemaValue::Kind::Object == field.value.kind)
+				{
+					AddFields(propertyType, field.name + ".", field.offset);
+					continue;
+				}
+			}
+
+			m_fields.push_back(std::move(field));
+		}
+	}
+
+	void TypeSchema::Finalize()
+	{
+		m_runs.clear();
+		m_tail.clear();
+
+		for (size_t index = 0; index < m_fields.size(); ++index)
+		{
+			const SchemaField& field = m_fields[index];
+
+			switch (field.value.kind)
+			{
+				case SchemaValue::Kind::Primitive :
+				case SchemaValue::Kind::Bytes :
+					m_runs.push_back({ field.offset, field.offset, field.value.size });
+					break;
+				case SchemaValue::Kind::String :
+				case SchemaValue::Kind::Pointer :
+				case SchemaValue::Kind::Array :
+				case SchemaValue::Kind::Set :
+				case SchemaValue::Kind::Map :
+					m_tail.push_back(index);
+					break;
+				default :
+					break;
+			}
+		}
+
+		MergeRuns(m_runs);
+	}
+
+	const SchemaRemap* SchemaRemap::Get(const TypeSchema* source, const TypeInfo* target)
+	{
+		if ((nullptr == source) || (nullptr == target))
+		{
+			return nullptr;
+		}
+
+		const TypeSchema* targetSchema = TypeSchema::Get(target);
+
+		SchemaCache& cache = GetCache();
+		std::lock_guard<std::mutex> lock(cache.remapMutex);
+
+		std::unique_ptr<SchemaRemap>& remap = cache.remaps[{ source->GetFingerprint(), target }];
+		if (nullptr == remap)
+		{
+			remap.reset(new SchemaRemap(source, targetSchema));
+		}
+
+		return remap.get();
+	}
+
+	SchemaRemap::SchemaRemap(const TypeSchema* source, const TypeSchema* target)
+		: m_runs()
+		, m_conversions()
+		, m_tail()
+	{
+		std::unordered_map<std::string, const SchemaField*> names;
+		std::unordered_map<std::string, const SchemaField*> shortNames;
+
+		for (const SchemaField& field : target->GetFields())
+		{
+			names.emplace(field.name, &field);
+
+			// Ambiguous short names (e.g. the same member name in a base and a derived class) are not matched.
+			auto result = shortNames.emplace(GetShortName(field.name), &field);
+			if (!result.second)
+			{
+				result.first->second = nullptr;
+			}
+		}
+
+		for (const SchemaField& field : source->GetFields())
+		{
+			const SchemaField* match = nullptr;
+
+			auto itr = names.find(field.name);
+			if (itr != names.end())
+			{
+				match = itr->second;
+			}
+			else
+			{
+				auto shortItr = shortNames.find(GetShortName(field.name));
+				match = (shortItr != shortNames.end()) ? shortItr->second : nullptr;
+			}
+
+			const SchemaValue& value = field.value;
+
+			switch (value.kind)
+			{
+				case SchemaValue::Kind::Primitive :
+				case SchemaValue::Kind::Bytes :
+				{
+					if (nullptr == match)
+					{
+						break;
+					}
+
+					const SchemaValue& matchValue = match->value;
+					const bool identical = (value.kind == matchValue.kind) && (value.size == matchValue.size)
+						&& (value.primitive == matchValue.primitive) && (value.typeHash == matchValue.typeHash);
+
+					if (identical)
+					{
+						m_runs.push_back({ field.offset, match->offset, value.size });
+					}
+					else if ((SchemaValue::Kind::Primitive == value.kind) && (SchemaValue::Kind::Primitive == matchValue.kind)
+						&& IsNumeric(value.primitive) && IsNumeric(matchValue.primitive))
+					{
+						m_conversions.push_back({ field.offset, value.primitive, match->offset, matchValue.primitive });
+					}
+
+					break;
+				}
+				case SchemaValue::Kind::String :
+				case SchemaValue::Kind::Pointer :
+				case SchemaValue::Kind::Array :
+				case SchemaValue::Kind::Set :
+				case SchemaValue::Kind::Map :
+				{
+					const bool compatible = (nullptr != match) && (match->value.kind == value.kind);
+					m_tail.push_back({ field, compatible ? match : nullptr });
+					break;
+				}
+				default :
+					break;
+			}
+		}
+
+		MergeRuns(m_runs);
+	}
+
+	const std::vector<SchemaRun>& SchemaRemap::GetRuns() const
+	{
+		return m_runs;
+	}
+
+	const std::vector<SchemaRemap::Conversion>& SchemaRemap::GetConversions() const
+	{
+		return m_conversions;
+	}
+
+	const std::vector<SchemaRemap::TailEntry>& SchemaRemap::GetTail() const
+	{
+		return m_tail;
+	}
+
+	bool IsNumeric(TypeInfo::Primitive primitive)
+	{
+		return (TypeInfo::Primitive::None != primitive) && (TypeInfo::Primitive::String != primitive) && (TypeInfo::Primitive::StringView != primitive);
+	}
+
+	bool ConvertPrimitive(TypeInfo::Primitive sourcePrimitive, const void* source, TypeInfo::Primitive targetPrimitive, void* target)
+	{
+		if (!IsNumeric(sourcePrimitive) || !IsNumeric(targetPrimitive))
+		{
+			return false;
+		}
+
+		if (IsFloating(sourcePrimitive) || IsFloating(targetPrimitive))
+		{
+			return Store(targetPrimitive, target, Load<double>(sourcePrimitive, source));
+		}
+		else if (IsSigned(sourcePrimitive))
+		{
+			return Store(targetPrimitive, target, Load<int64_t>(sourcePrimitive, source));
+		}
+		else
+		{
+			return Store(targetPrimitive, target, Load<uint64_t>(sourcePrimitive, source));
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,341 @@
+#include "SoAVector.h"
+
+#include "Property/PropertyInfo.h"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+namespace Reflection
+{
+	namespace
+	{
+		char* AllocateColumn(size_t bytes)
+		{
+			return static_cast<char*>(::operator new(std::max<size_t>(bytes, 1), std::align_val_t(SoAStorage::ColumnAlignment)));
+		}
+
+		void FreeColumn(char* data)
+		{
+			::operator delete(data, std::align_val_t(SoAStorage::ColumnAlignment));
+		}
+	}
+
+	SoAStorage::SoAStorage(const TypeInfo* rowType)
+		: m_rowType(rowType)
+		, m_columns()
+		, m_prototype(nullptr)
+		, m_size(0)
+		, m_capacity(0)
+		, m_isValid(nullptr != rowType)
+	{
+		if (!m_isValid)
+		{
+			return;
+		}
+
+		const bool hasPrototype = rowType->IsConstructible();
+
+		for (const PropertyInfo* property : rowType->GetPropertyList())
+		{
+			const TypeInfo* type = property->GetPropertyType();
+
+			if ((nullptr == type) || !type->IsCopyable() || !type->IsRelocatable() || (!hasPrototype && !type->IsConstructible()))
+			{
+				m_isValid = false;
+				break;
+			}
+
+			m_columns.push_back({ property, type, property->GetPropertyOffset(), type->GetTypeSize(), type->GetTypeAlignment(), type->IsTriviallyCopyable(), nullptr });
+		}
+
+		if (!m_isValid)
+		{
+			m_columns.clear();
+			return;
+		}
+
+		std::stable_sort(m_columns.begin(), m_columns.end(), [](const Column& lhs, const Column& rhs)
+		{
+			return lhs.offset < rhs.offset;
+		});
+
+		// New rows copy the values of this instance, so they get the member initializers of the row type.
+		if (hasPrototype)
+		{
+			m_prototype = ::operator new(rowType->GetTypeSize(), std::align_val_t(std::max<size_t>(rowType->GetTypeAlignment(), alignof(std::max_align_t))));
+			rowType->Construct(m_prototype);
+		}
+	}
+
+	SoAStorage::~SoAStorage()
+	{
+		Clear();
+
+		for (Column& column : m_columns)
+		{
+			if (nullptr != column.data)
+			{
+				FreeColumn(column.data);
+			}
+		}
+
+		if (nullptr != m_prototype)
+		{
+			m_rowType->Destruct(m_prototype);
+			::operator delete(m_prototype, std::align_val_t(std::max<size_t>(m_rowType->GetTypeAlignment(), alignof(std::max_align_t))));
+		}
+	}
+
+	bool SoAStorage::IsValid() const
+	{
+		return m_isValid;
+	}
+
+	const TypeInfo* SoAStorage::GetRowType() const
+	{
+		return m_rowType;
+	}
+
+	size_t SoAStorage::GetColumnCount() const
+	{
+		return m_columns.size();
+	}
+
+	const SoAStorage::Column& SoAStorage::GetColumn(size_t column) const
+	{
+		return m_columns[column];
+	}
+
+	size_t SoAStorage::FindColumn(size_t offset) const
+	{
+		const auto found = std::lower_bound(m_columns.begin(), m_columns.end(), offset, [](const Column& column, size_t value)
+		{
+			return column.offset < value;
+		});
+
+		return ((found != m_columns.end()) && (offset == found->offset)) ? static_cast<size_t>(found - m_columns.begin()) : m_columns.size();
+	}
+
+	size_t SoAStorage::FindColumn(const std::string& propertyName) const
+	{
+		const auto found = std::find_if(m_columns.begin(), m_columns.end(), [&propertyName](const Column& column)
+		{
+			return propertyName == column.property->GetPropertyName();
+		});
+
+		return static_cast<size_t>(found - m_columns.begin());
+	}
+
+	size_t SoAStorage::GetSize() const
+	{
+		return m_size;
+	}
+
+	size_t SoAStorage::GetCapacity() const
+	{
+		return m_capacity;
+	}
+
+	void SoAStorage::Reserve(size_t capacity)
+	{
+		if (capacity <= m_capacity)
+		{
+			return;
+		}
+
+		for (Column& column : m_columns)
+		{
+			char* data = AllocateColumn(capacity * column.size);
+
+			if (nullptr != column.data)
+			{
+				if (column.isTriviallyCopyable)
+				{
+					std::memcpy(data, column.data, m_size * column.size);
+				}
+				else
+				{
+					for (size_t row = 0; row < m_size; ++row)
+					{
+						column.type->Relocate(data + row * column.size, column.data + row * column.size);
+					}
+				}
+
+				FreeColumn(column.data);
+			}
+
+			column.data = data;
+		}
+
+		m_capacity = capacity;
+	}
+
+	void SoAStorage::Resize(size_t size)
+	{
+		while (size < m_size)
+		{
+			PopBack();
+		}
+
+		Reserve(size);
+
+		while (m_size < size)
+		{
+			EmplaceBack();
+		}
+	}
+
+	void SoAStorage::PushBack(const void* object)
+	{
+		if (m_size == m_capacity)
+		{
+			Grow();
+		}
+
+		const char* source = static_cast<const char*>(object);
+		for (const Column& column : m_columns)
+		{
+			CopyConstruct(column, column.data + m_size * column.size, source + column.offset);
+		}
+
+		++m_size;
+	}
+
+	void SoAStorage::EmplaceBack()
+	{
+		if (m_size == m_capacity)
+		{
+			Grow();
+		}
+
+		for (const Column& column : m_columns)
+		{
+			ConstructDefault(column, column.data + m_size * column.size);
+		}
+
+		++m_size;
+	}
+
+	void SoAStorage::PopBack()
+	{
+		if (0 == m_size)
+		{
+			return;
+		}
+
+		--m_size;
+
+		for (const Column& column : m_columns)
+		{
+			Destruct(column, column.data + m_size * column.size);
+		}
+	}
+
+	void SoAStorage::SwapRemove(size_t row)
+	{
+		if (m_size <= row)
+		{
+			return;
+		}
+
+		const size_t last = m_size - 1;
+		if (row != last)
+		{
+			for (const Column& column : m_columns)
+			{
+				CopyAssign(column, column.data + row * column.size, column.data + last * column.size);
+			}
+		}
+
+		PopBack();
+	}
+
+	void SoAStorage::Clear()
+	{
+		for (const Column& column : m_columns)
+		{
+			if (column.isTriviallyCopyable)
+			{
+				continue;
+			}
+
+			for (size_t row = 0; row < m_size; ++row)
+			{
+				Destruct(column, column.data + row * column.size);
+			}
+		}
+
+		m_size = 0;
+	}
+
+	void SoAStorage::Load(size_t row, void* object) const
+	{
+		char* target = static_cast<char*>(object);
+
+		for (const Column& column : m_columns)
+		{
+			CopyAssign(column, target + column.offset, column.data + row * column.size);
+		}
+	}
+
+	void SoAStorage::Store(size_t row, const void* object)
+	{
+		const char* source = static_cast<const char*>(object);
+
+		for (const Column& column : m_columns)
+		{
+			CopyAssign(column, column.data + row * column.size, source + column.offset);
+		}
+	}
+
+	void SoAStorage::ConstructDefault(const Column& column, void* element) const
+	{
+		if (nullptr != m_prototype)
+		{
+			CopyConstruct(column, element, static_cast<const char*>(m_prototype) + column.offset);
+		}
+		else
+		{
+			column.type->Construct(element);
+		}
+	}
+
+	void SoAStorage::CopyConstruct(const Column& column, void* element, const void* source)
+	{
+		if (column.isTriviallyCopyable)
+		{
+			std::memcpy(element, source, column.size);
+		}
+		else
+		{
+			column.type->CopyConstruct(element, source);
+		}
+	}
+
+	void SoAStorage::CopyAssign(const Column& column, void* element, const void* source)
+	{
+		if (column.isTriviallyCopyable)
+		{
+			std::memcpy(element, source, column.size);
+		}
+		else
+		{
+			column.type->CopyAssign(element, source);
+		}
+	}
+
+	void SoAStorage::Destruct(const Column& column, void* element)
+	{
+		// Trivially copyable values have a trivial destructor.
+		if (!column.isTriviallyCopyable)
+		{
+			column.type->Destruct(element);
+		}
+	}
+
+	void SoAStorage::Grow()
+	{
+		Reserve(std::max<size_t>(16, m_capacity * 2));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,184 @@
+#include "Type/CastCache.h"
+
+#include "Type/TypeManager.h"
+
+namespace Reflection
+{
+	CastCache::CastCache()
+		: m_table(nullptr)
+		, m_tables()
+		, m_size(0)
+		, m_clearedGeneration(0)
+		, m_mutex()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		Grow(GetRequiredCapacity());
+
+		TypeManager::GetHandle().AddUnregistListener(&CastCache::OnUnregist);
+	}
+
+	CastCache::~CastCache() = default;
+
+	CastCache& CastCache::GetHandle()
+	{
+		static CastCache castCache;
+		return castCache;
+	}
+
+	bool CastCache::FindSlow(uint64_t key, const Table* table, const TypeInfo* runtimeType, const TypeInfo* sourceType, const TypeInfo* targetType, ptrdiff_t& offset)
+	{
+		const size_t slot = GetSlot(key, table->shift);
+
+		for (size_t probe = 0; probe < MaxProbe; ++probe)
+		{
+			Entry& entry = table->entries[(slot + probe) & (table->capacity - 1)];
+			uint64_t current = entry.key.load(std::memory_order_acquire);
+
+			if (key == current)
+			{
+				const int64_t answer = entry.offset.load(std::memory_order_acquire);
+				if (key == entry.key.load(std::memory_order_relaxed))
+				{
+					offset = static_cast<ptrdiff_t>(answer);
+					return NoSubobject != answer;
+				}
+
+				continue;
+			}
+
+			if (0 != current)
+			{
+				continue;
+			}
+
+			// Not cached : resolve the triple, then claim the slot, write the answer and publish the key.
+			ptrdiff_t found = 0;
+			const bool isCastable = Resolve(runtimeType, sourceType, targetType, found);
+
+			if (entry.key.compare_exchange_strong(current, BusyKey, std::memory_order_acquire))
+			{
+				entry.offset.store(isCastable ? static_cast<int64_t>(found) : NoSubobject, std::memory_order_release);
+				entry.key.store(key, std::memory_order_release);
+				m_size.fetch_add(1, std::memory_order_relaxed);
+			}
+
+			offset = found;
+			return isCastable;
+		}
+
+		// The probe window is full : a table at least half full is replaced by a larger one, filled again by the next lookups.
+		if ((table->capacity < MaxCapacity) && (table->capacity <= m_size.load(std::memory_order_relaxed) * 2))
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			if (table == m_table.load(std::memory_order_relaxed))
+			{
+				Grow(table->capacity * 2);
+			}
+		}
+
+		return Resolve(runtimeType, sourceType, targetType, offset);
+	}
+
+	bool CastCache::Resolve(const TypeInfo* runtimeType, const TypeInfo* sourceType, const TypeInfo* targetType, ptrdiff_t& offset)
+	{
+		ptrdiff_t sourceOffset = 0;
+		ptrdiff_t targetOffset = 0;
+
+		if (!runtimeType->GetBaseOffset(sourceType, sourceOffset) || !runtimeType->GetBaseOffset(targetType, targetOffset))
+		{
+			return false;
+		}
+
+		offset = targetOffset - sourceOffset;
+		return true;
+	}
+
+	void CastCache::Clear()
+	{
+		const size_t capacity = GetRequiredCapacity();
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		const Table* table = m_table.load(std::memory_order_relaxed);
+		if (table->capacity < capacity)
+		{
+			Grow(capacity);
+			return;
+		}
+
+		// A slot being written keeps its writer : only published keys are removed, so a writer never pairs a key with another answer.
+		for (size_t index = 0; index < table->capacity; ++index)
+		{
+			std::atomic<uint64_t>& key = table->entries[index].key;
+
+			uint64_t current = key.load(std::memory_order_relaxed);
+			while ((0 != current) && (BusyKey != current) && !key.compare_exchange_weak(current, 0, std::memory_order_release, std::memory_order_relaxed))
+			{
+			}
+		}
+
+		m_size.store(0, std::memory_order_relaxed);
+	}
+
+	size_t CastCache::GetSize() const
+	{
+		return m_size.load(std::memory_order_relaxed);
+	}
+
+	size_t CastCache::GetCapacity() const
+	{
+		return m_table.load(std::memory_order_acquire)->capacity;
+	}
+
+	void CastCache::Grow(size_t capacity)
+	{
+		uint32_t bits = 0;
+		while ((size_t(1) << bits) < capacity)
+		{
+			++bits;
+		}
+
+		std::unique_ptr<Table> table = std::make_unique<Table>(Table{ size_t(1) << bits, 64 - bits, std::make_unique<Entry[]>(size_t(1) << bits) });
+		for (size_t index = 0; index < table->capacity; ++index)
+		{
+			table->entries[index].key.store(0, std::memory_order_relaxed);
+			table->entries[index].offset.store(0, std::memory_order_relaxed);
+		}
+
+		m_tables.push_back(std::move(table));
+		m_size.store(0, std::memory_order_relaxed);
+		m_table.store(m_tables.back().get(), std::memory_order_release);
+	}
+
+	size_t CastCache::GetRequiredCapacity()
+	{
+		TypeManager& typeManager = TypeManager::GetHandle();
+		TypeManager::ReadGuard guard;
+
+		const size_t required = typeManager.GetTypeMap().size() * EntriesPerType;
+
+		size_t capacity = MinCapacity;
+		while ((capacity < required) && (capacity < MaxCapacity))
+		{
+			capacity *= 2;
+		}
+
+		return capacity;
+	}
+
+	void CastCache::OnUnregist(const TypeInfo* typeInfo)
+	{
+		(void)typeInfo;
+
+		// The listener is called once per removed type : the table is cleared once per published generation.
+		CastCache& castCache = GetHandle();
+		const uint64_t generation = TypeManager::GetHandle().GetGeneration();
+
+		if (generation != castCache.m_clearedGeneration.exchange(generation, std::memory_order_relaxed))
+		{
+			castCache.Clear();
+		}
+	}
+}
\ No newline at end of file
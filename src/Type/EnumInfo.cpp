@@ -0,0 +1,272 @@
+#include "Type/EnumInfo.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+
+namespace Reflection
+{
+	namespace
+	{
+		std::string_view Trim(std::string_view text)
+		{
+			while (!text.empty() && (' ' == text.front()))
+			{
+				text.remove_prefix(1);
+			}
+
+			while (!text.empty() && (' ' == text.back()))
+			{
+				text.remove_suffix(1);
+			}
+
+			return text;
+		}
+
+		/**
+		 * @brief	Appends text to a truncating output, counting the full length like snprintf.
+		 */
+		void Append(std::string_view text, char* buffer, size_t capacity, size_t& length)
+		{
+			if (length + 1 < capacity)
+			{
+				const size_t count = std::min(text.size(), capacity - 1 - length);
+				std::memcpy(buffer + length, text.data(), count);
+			}
+
+			length += text.size();
+		}
+
+		bool ParseNumber(std::string_view token, uint64_t& value)
+		{
+			const char* first = token.data();
+			const char* last = token.data() + token.size();
+
+			int base = 10;
+			if ((2 < token.size()) && ('0' == token[0]) && (('x' == token[1]) || ('X' == token[1])))
+			{
+				first += 2;
+				base = 16;
+			}
+
+			std::from_chars_result result;
+			if ((10 == base) && (first != last) && ('-' == *first))
+			{
+				int64_t number = 0;
+				result = std::from_chars(first, last, number);
+				value = static_cast<uint64_t>(number);
+			}
+			else
+			{
+				result = std::from_chars(first, last, value, base);
+			}
+
+			return (std::errc() == result.ec) && (last == result.ptr);
+		}
+	}
+
+	std::string_view EnumInfo::GetName(uint64_t value) const
+	{
+		if (0 == m_valueCount)
+		{
+			return std::string_view();
+		}
+
+		if (m_isDense)
+		{
+			const uint64_t index = value - m_byValue[0].value;
+			return (index < m_valueCount) ? m_byValue[index].name : std::string_view();
+		}
+
+		size_t first = 0;
+		size_t last = m_valueCount;
+
+		while (first < last)
+		{
+			const size_t middle = first + (last - first) / 2;
+			const bool less = m_isSigned
+				? (static_cast<int64_t>(m_byValue[middle].value) < static_cast<int64_t>(value))
+				: (m_byValue[middle].value < value);
+
+			if (less)
+			{
+				first = middle + 1;
+			}
+			else
+			{
+				last = middle;
+			}
+		}
+
+		return ((first < m_valueCount) && (m_byValue[first].value == value)) ? m_byValue[first].name : std::string_view();
+	}
+
+	bool EnumInfo::GetValue(std::string_view name, uint64_t& value) const
+	{
+		size_t first = 0;
+		size_t last = m_nameCount;
+
+		while (first < last)
+		{
+			const size_t middle = first + (last - first) / 2;
+
+			if (m_byName[middle].name < name)
+			{
+				first = middle + 1;
+			}
+			else
+			{
+				last = middle;
+			}
+		}
+
+		if ((first < m_nameCount) && (m_byName[first].name == name))
+		{
+			value = m_byName[first].value;
+			return true;
+		}
+
+		return false;
+	}
+
+	size_t EnumInfo::FormatFlags(uint64_t value, char* buffer, size_t capacity) const
+	{
+		size_t length = 0;
+
+		const std::string_view exact = GetName(value);
+		if (!exact.empty())
+		{
+			Append(exact, buffer, capacity, length);
+		}
+		else
+		{
+			uint64_t remaining = value;
+
+			for (size_t index = 0; (index < m_valueCount) && (0 != remaining); ++index)
+			{
+				const uint64_t flag = m_byValue[index].value;
+
+				if ((0 != flag) && (flag == (remaining & flag)))
+				{
+					if (0 != length)
+					{
+						Append("|", buffer, capacity, length);
+					}
+
+					Append(m_byValue[index].name, buffer, capacity, length);
+					remaining &= ~flag;
+				}
+			}
+
+			if ((0 != remaining) || (0 == length))
+			{
+				char number[2 + 16];
+				number[0] = '0';
+				number[1] = 'x';
+
+				const std::to_chars_result result = std::to_chars(number + 2, number + sizeof(number), remaining, 16);
+
+				if (0 != length)
+				{
+					Append("|", buffer, capacity, length);
+				}
+
+				Append(std::string_view(number, static_cast<size_t>(result.ptr - number)), buffer, capacity, length);
+			}
+		}
+
+		if (0 < capacity)
+		{
+			buffer[std::min(length, capacity - 1)] = '\0';
+		}
+
+		return length;
+	}
+
+	bool EnumInfo::ParseFlags(std::string_view text, uint64_t& value) const
+	{
+		uint64_t result = 0;
+
+		while (true)
+		{
+			const size_t separator = text.find('|');
+			const std::string_view token = Trim(text.substr(0, separator));
+
+			if (!token.empty())
+			{
+				uint64_t flag = 0;
+				if (!GetValue(token, flag) && !ParseNumber(token, flag))
+				{
+					return false;
+				}
+
+				result |= flag;
+			}
+			else if (std::string_view::npos != separator)
+			{
+				return false;
+			}
+
+			if (std::string_view::npos == separator)
+			{
+				break;
+			}
+
+			text.remove_prefix(separator + 1);
+		}
+
+		value = result;
+		return true;
+	}
+
+	uint64_t EnumInfo::Read(const void* instance) const
+	{
+		switch (m_size)
+		{
+			case 1 :
+				return m_isSigned ? static_cast<uint64_t>(*static_cast<const int8_t*>(instance)) : *static_cast<const uint8_t*>(instance);
+			case 2 :
+				return m_isSigned ? static_cast<uint64_t>(*static_cast<const int16_t*>(instance)) : *static_cast<const uint16_t*>(instance);
+			case 4 :
+				return m_isSigned ? static_cast<uint64_t>(*static_cast<const int32_t*>(instance)) : *static_cast<const uint32_t*>(instance);
+			default :
+				return *static_cast<const uint64_t*>(instance);
+		}
+	}
+
+	void EnumInfo::Write(void* instance, uint64_t value) const
+	{
+		switch (m_size)
+		{
+			case 1 :	*static_cast<uint8_t*>(instance) = static_cast<uint8_t>(value); break;
+			case 2 :	*static_cast<uint16_t*>(instance) = static_cast<uint16_t>(value); break;
+			case 4 :	*static_cast<uint32_t*>(instance) = static_cast<uint32_t>(value); break;
+			default :	*static_cast<uint64_t*>(instance) = value; break;
+		}
+	}
+
+	const EnumEntry* EnumInfo::GetEntries() const
+	{
+		return m_byValue;
+	}
+
+	size_t EnumInfo::GetEntryCount() const
+	{
+		return m_valueCount;
+	}
+
+	bool EnumInfo::IsDense() const
+	{
+		return m_isDense;
+	}
+
+	bool EnumInfo::IsFlags() const
+	{
+		return m_isFlags;
+	}
+
+	bool EnumInfo::IsSigned() const
+	{
+		return m_isSigned;
+	}
+}
\ No newline at end of file
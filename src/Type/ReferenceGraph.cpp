@@ -0,0 +1,314 @@
+#include "Type/ReferenceGraph.h"
+
+#include "Type/TypeCast.h"
+#include "Property/ContainerPropertyInfo.h"
+
+#include "JobSystem.h"
+#include "PointerSet.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace Reflection
+{
+	namespace
+	{
+		struct Node
+		{
+			const TypeInfo* type;
+			void* object;
+		};
+
+		/**
+		 * @brief	Makes the node of the complete object an instance belongs to, so every base pointer to one object shares a node.
+		 */
+		Node MakeNode(const TypeInfo* type, void* instance)
+		{
+			ptrdiff_t offset = 0;
+			const TypeInfo* completeType = type->GetCompleteType(instance, offset);
+
+			return Node{ completeType, static_cast<char*>(instance) - offset };
+		}
+
+		bool HoldsReferences(const TypeInfo* type)
+		{
+			return (nullptr != type) && (type->IsPointer() || !type->GetReferences().empty());
+		}
+
+		/**
+		 * @brief	Calls discover(node) on every object the object points to, nullptr aside.
+		 */
+		template<typename Discover>
+		void ExpandReferences(const TypeInfo* type, const void* object, Discover& discover);
+
+		template<typename Discover>
+		void ExpandPointer(const TypeInfo* pointerType, const void* address, Discover& discover)
+		{
+			void* pointee = *static_cast<void* const*>(address);
+			if (nullptr == pointee)
+			{
+				return;
+			}
+
+			discover(MakeNode(pointerType->GetPureType(), pointee));
+		}
+
+		template<typename Discover>
+		void ExpandElement(const TypeInfo* type, const void* element, Discover& discover)
+		{
+			if (type->IsPointer())
+			{
+				ExpandPointer(type, element, discover);
+			}
+			else
+			{
+				ExpandReferences(type, element, discover);
+			}
+		}
+
+		template<typename Discover>
+		void ExpandContainer(const ContainerPropertyInfo* container, const void* address, Discover& discover)
+		{
+			// Arrays first, the most common containers of pointers, walked directly over their storage when it is contiguous.
+			if (const auto* arrayInfo = Cast<const ArrayPropertyInfo*>(container))
+			{
+				const TypeInfo* valueType = arrayInfo->GetValueType();
+
+				if (const char* data = static_cast<const char*>(container->GetData(address)))
+				{
+					const size_t size = container->GetSize(address);
+					const size_t stride = valueType->GetTypeSize();
+
+					for (size_t index = 0; index < size; ++index)
+					{
+						ExpandElement(valueType, data + index * stride, discover);
+					}
+				}
+				else
+				{
+					const auto end = container->end(address);
+					for (auto itr = container->begin(address); itr != end; ++itr)
+					{
+						ExpandElement(valueType, itr.get(), discover);
+					}
+				}
+			}
+			else if (const auto* mapInfo = Cast<const MapPropertyInfo*>(container))
+			{
+				const TypeInfo* keyType = mapInfo->GetKeyType();
+				const TypeInfo* mappedType = mapInfo->GetMappedType();
+
+				const bool isKeyFollowed = HoldsReferences(keyType);
+				const bool isMappedFollowed = HoldsReferences(mappedType);
+
+				const auto end = container->end(address);
+				for (auto itr = container->begin(address); itr != end; ++itr)
+				{
+					if (isKeyFollowed)
+					{
+						ExpandElement(keyType, mapInfo->GetRawKey(itr.get()), discover);
+					}
+
+					if (isMappedFollowed)
+					{
+						ExpandElement(mappedType, mapInfo->GetRawMapped(itr.get()), discover);
+					}
+				}
+			}
+			else if (const auto* setInfo = Cast<const SetPropertyInfo*>(container))
+			{
+				const auto end = container->end(address);
+				for (auto itr = container->begin(address); itr != end; ++itr)
+				{
+					ExpandElement(setInfo->GetValueType(), itr.get(), discover);
+				}
+			}
+		}
+
+		template<typename Discover>
+		void ExpandReferences(const TypeInfo* type, const void* object, Discover& discover)
+		{
+			const char* base = static_cast<const char*>(object);
+
+			for (const TypeInfo::Reference& reference : type->GetReferences())
+			{
+				if (nullptr == reference.container)
+				{
+					ExpandPointer(reference.type, base + reference.offset, discover);
+				}
+				else
+				{
+					ExpandContainer(reference.container, base + reference.offset, discover);
+				}
+			}
+		}
+
+		size_t VisitSequential(const Node& root, void* context, ReferenceVisitFunc visit)
+		{
+			PointerSet visited;
+			std::vector<Node> worklist;
+
+			visited.Insert(root.object);
+			worklist.push_back(root);
+
+			auto discover = [&](const Node& node)
+			{
+				if (visited.Insert(node.object))
+				{
+					worklist.push_back(node);
+				}
+			};
+
+			while (!worklist.empty())
+			{
+				const Node node = worklist.back();
+				worklist.pop_back();
+
+				visit(context, node.type, node.object);
+				ExpandReferences(node.type, node.object, discover);
+			}
+
+			return visited.GetSize();
+		}
+
+		/**
+		 * @class	ShardedPointerSet
+		 * @brief	PointerSet split in independently locked shards, so threads inserting at the same time rarely contend.
+		 */
+		class ShardedPointerSet
+		{
+			public :
+				static constexpr size_t ShardCount = 64;
+
+			public :
+				bool Insert(const void* pointer)
+				{
+					// The shard is picked from other hash bits than the slot inside the shard.
+					const uint64_t hash = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(pointer)) * 0xC2B2AE3D27D4EB4Full;
+					Shard& shard = m_shards[(hash >> 20) & (ShardCount - 1)];
+
+					std::lock_guard<std::mutex> lock(shard.mutex);
+					return shard.set.Insert(pointer);
+				}
+
+				size_t GetSize()
+				{
+					size_t size = 0;
+					for (Shard& shard : m_shards)
+					{
+						std::lock_guard<std::mutex> lock(shard.mutex);
+						size += shard.set.GetSize();
+					}
+
+					return size;
+				}
+
+			private :
+				struct alignas(64) Shard
+				{
+					std::mutex mutex;
+					PointerSet set;
+				};
+
+				Shard m_shards[ShardCount];
+		};
+
+		/**
+		 * @class	ParallelTraversal
+		 * @brief	State of a parallel VisitReferences call.
+		 * @details	The frontier holds the objects discovered by the previous level. Every job visits a chunk of it,
+		 * 			gathers the newly discovered objects locally and appends them to the next frontier at once.
+		 */
+		class ParallelTraversal
+		{
+			public :
+				ParallelTraversal(void* context, ReferenceVisitFunc visit)
+					: m_context(context)
+					, m_visit(visit)
+				{}
+
+			public :
+				size_t Run(const Node& root)
+				{
+					JobSystem& jobSystem = JobSystem::GetHandle();
+					const size_t threadCount = jobSystem.GetWorkerCount() + 1;
+
+					m_visited.Insert(root.object);
+					m_frontier.push_back(root);
+
+					while (!m_frontier.empty())
+					{
+						// Chunks large enough to amortize the merge, small enough to balance the level.
+						const size_t grain = std::max<size_t>(64, m_frontier.size() / (threadCount * 8));
+
+						jobSystem.ParallelFor(m_frontier.size(), grain, this, [](void* context, size_t first, size_t last)
+						{
+							static_cast<ParallelTraversal*>(context)->RunChunk(first, last);
+						});
+
+						m_frontier.swap(m_next);
+						m_next.clear();
+					}
+
+					return m_visited.GetSize();
+				}
+
+			private :
+				void RunChunk(size_t first, size_t last)
+				{
+					std::vector<Node> discovered;
+
+					auto discover = [&](const Node& node)
+					{
+						if (m_visited.Insert(node.object))
+						{
+							discovered.push_back(node);
+						}
+					};
+
+					for (size_t index = first; index < last; ++index)
+					{
+						const Node& node = m_frontier[index];
+
+						m_visit(m_context, node.type, node.object);
+						ExpandReferences(node.type, node.object, discover);
+					}
+
+					if (!discovered.empty())
+					{
+						std::lock_guard<std::mutex> lock(m_nextMutex);
+						m_next.insert(m_next.end(), discovered.begin(), discovered.end());
+					}
+				}
+
+			private :
+				void* m_context;
+				ReferenceVisitFunc m_visit;
+
+				ShardedPointerSet m_visited;
+				std::vector<Node> m_frontier;
+				std::vector<Node> m_next;
+				std::mutex m_nextMutex;
+		};
+	}
+
+	size_t VisitReferences(const TypeInfo* type, void* root, void* context, ReferenceVisitFunc visit, TraversalMode mode)
+	{
+		if ((nullptr == type) || (nullptr == root) || (nullptr == visit))
+		{
+			return 0;
+		}
+
+		const Node node = MakeNode(type, root);
+
+		if (TraversalMode::Parallel == mode)
+		{
+			ParallelTraversal traversal(context, visit);
+			return traversal.Run(node);
+		}
+
+		return VisitSequential(node, context, visit);
+	}
+}
\ No newline at end of file
@@ -21,17 +21,16 @@ namespace Reflection
 			return false;
 		}
 
-		const TypeInfo* superType = childType->GetSuperType();
-		while (superType != nullptr)
-		{
-			if (*parentType == *superType)
-			{
-				return true;
-			}
+		return childType->IsDerivedFrom(parentType);
+	}
 
-			superType = superType->GetSuperType();
+	bool GetCastOffset(const TypeInfo* runtimeType, const TypeInfo* sourceType, const TypeInfo* targetType, ptrdiff_t& offset)
+	{
+		if ((nullptr == runtimeType) || (nullptr == sourceType) || (nullptr == targetType))
+		{
+			return false;
 		}
 
-		return false;
+		return CastCache::GetHandle().Find(runtimeType, sourceType, targetType, offset);
 	}
 }
\ No newline at end of file
@@ -0,0 +1,401 @@
+#include "Type/TypeInfo.h"
+
+#include "Property/PropertyInfo.h"
+#include "Property/ContainerPropertyInfo.h"
+
+#include "Arena.h"
+
+#include <cstring>
+#include <map>
+#include <unordered_map>
+
+namespace Reflection
+{
+	namespace
+	{
+		/**
+		 * @class	CloneContext
+		 * @brief	State of a single TypeInfo::Clone call.
+		 * @details	Objects are cloned breadth first from a worklist, so deep graphs do not recurse.
+		 * 			The remap table maps every cloned source object to its clone, which keeps shared
+		 * 			references shared and terminates cycles. Pointers to reflected objects are resolved once
+		 * 			the pending objects are filled : a pointer inside an object already cloned, such as a member
+		 * 			of its own object, is remapped into that clone, and only the other targets are cloned.
+		 * 			Pointers to non-reflected values are fixed once every object has been cloned, by looking up
+		 * 			the cloned object containing them.
+		 */
+		class CloneContext
+		{
+			public :
+				explicit CloneContext(Arena& arena)
+					: m_arena(arena)
+					, m_remap()
+					, m_ranges()
+					, m_worklist()
+					, m_pointers()
+					, m_interiorPointers()
+					, m_rebuilding(false)
+				{}
+
+			public :
+				void* CloneObject(const TypeInfo* type, const void* source)
+				{
+					auto itr = m_remap.find(source);
+					if (itr != m_remap.end())
+					{
+						return itr->second;
+					}
+
+					const TypeInfo* runtimeType = type->GetRuntimeType(source);
+
+					if (!runtimeType->IsConstructible())
+					{
+						return nullptr;
+					}
+
+					void* clone = m_arena.Allocate(runtimeType->GetTypeSize(), runtimeType->GetTypeAlignment());
+					if (nullptr == clone)
+					{
+						return nullptr;
+					}
+
+					runtimeType->Construct(clone);
+					m_arena.AddFinalizer(clone, runtimeType->GetDestructFunc());
+
+					m_remap[source] = clone;
+					m_ranges[static_cast<const char*>(source)] = Range{ runtimeType->GetTypeSize(), static_cast<char*>(clone) };
+					m_worklist.push_back({ runtimeType, source, clone });
+
+					return clone;
+				}
+
+				void Run()
+				{
+					size_t index = 0;
+
+					while (true)
+					{
+						for (; index < m_worklist.size(); ++index)
+						{
+							const Work work = m_worklist[index];
+
+							Fill(work.type, work.source, work.clone);
+						}
+
+						if (m_pointers.empty())
+						{
+							break;
+						}
+
+						// Resolving may clone new objects, which queue work and pointers for the next round.
+						std::vector<Pointer> pointers;
+						pointers.swap(m_pointers);
+
+						for (const Pointer& pointer : pointers)
+						{
+							ResolvePointer(pointer.type, *pointer.slot);
+						}
+					}
+
+					FixInteriorPointers();
+				}
+
+			private :
+				struct Work
+				{
+					const TypeInfo* type;
+					const void* source;
+					void* clone;
+				};
+
+				struct Range
+				{
+					size_t size;
+					char* clone;
+				};
+
+				struct Pointer
+				{
+					const TypeInfo* type;
+					void** slot;
+				};
+
+			private :
+				void Fill(const TypeInfo* type, const void* source, void* clone)
+				{
+					if (type->GetPropertyList().empty())
+					{
+						type->CopyAssign(clone, source);
+						return;
+					}
+
+					const char* sourceBase = static_cast<const char*>(source);
+					char* cloneBase = static_cast<char*>(clone);
+
+					for (const TypeInfo::Segment& segment : type->GetSegments())
+					{
+						if (nullptr == segment.type)
+						{
+							std::memcpy(cloneBase + segment.offset, sourceBase + segment.offset, segment.size);
+						}
+						else
+						{
+							segment.type->CopyAssign(cloneBase + segment.offset, sourceBase + segment.offset);
+						}
+					}
+
+					FixReferences(type, clone);
+				}
+
+				void FixReferences(const TypeInfo* type, void* instance)
+				{
+					char* base = static_cast<char*>(instance);
+
+					for (const TypeInfo::Reference& reference : type->GetReferences())
+					{
+						if (nullptr == reference.container)
+						{
+							FixPointer(reference.type, base + reference.offset);
+						}
+						else
+						{
+							FixContainer(reference.container, base + reference.offset);
+						}
+					}
+				}
+
+				void FixElement(const TypeInfo* type, void* element)
+				{
+					if (type->IsPointer())
+					{
+						FixPointer(type, element);
+					}
+					else
+					{
+						FixReferences(type, element);
+					}
+				}
+
+				bool HoldsReferences(const TypeInfo* type) const
+				{
+					return type->IsPointer() || !type->GetReferences().empty();
+				}
+
+				/**
+				 * @brief	Fixes the pointers of a container which has been copy assigned from the source.
+				 * @details	Array elements and mapped values are fixed in place. Set values and map keys
+				 * 			cannot be modified in place without breaking the container, so the container is
+				 * 			rebuilt from fixed copies of its elements instead.
+				 */
+				void FixContainer(const ContainerPropertyInfo* container, void* address)
+				{
+					const TypeInfo* valueType = nullptr;
+					const TypeInfo* keyType = nullptr;
+
+					if (const auto* mapInfo = Cast<const MapPropertyInfo*>(container))
+					{
+						valueType = mapInfo->GetValueType();
+						keyType = mapInfo->GetKeyType();
+
+						if (!HoldsReferences(keyType))
+						{
+							for (auto itr = container->begin(address); itr != container->end(address); ++itr)
+							{
+								void* mapped = const_cast<void*>(mapInfo->GetRawMapped(itr.get()));
+								FixElement(mapInfo->GetMappedType(), mapped);
+							}
+
+							return;
+						}
+					}
+					else if (const auto* setInfo = Cast<const SetPropertyInfo*>(container))
+					{
+						valueType = setInfo->GetValueType();
+						keyType = setInfo->GetKeyType();
+					}
+					else if (const auto* arrayInfo = Cast<const ArrayPropertyInfo*>(container))
+					{
+						for (auto itr = container->begin(address); itr != container->end(address); ++itr)
+						{
+							FixElement(arrayInfo->GetValueType(), const_cast<void*>(itr.get()));
+						}
+
+						return;
+					}
+
+					if ((nullptr == valueType) || !container->CanInsert())
+					{
+						return;
+					}
+
+					RebuildContainer(container, valueType, address);
+				}
+
+				void RebuildContainer(const ContainerPropertyInfo* container, const TypeInfo* valueType, void* address)
+				{
+					const size_t size = container->GetSize(address);
+					const size_t valueSize = valueType->GetTypeSize();
+
+					// The scratch copies live in the arena too, released with the clones.
+					char* elements = static_cast<char*>(m_arena.Allocate(size * valueSize + 1, valueType->GetTypeAlignment()));
+					if (nullptr == elements)
+					{
+						return;
+					}
+
+					size_t count = 0;
+
+					for (auto itr = container->begin(address); itr != container->end(address); ++itr, ++count)
+					{
+						valueType->CopyConstruct(elements + count * valueSize, itr.get());
+					}
+
+					container->Clear(address);
+					container->Reserve(address, count);
+
+					// The copies are destroyed once inserted, so their pointers are resolved now instead of being deferred.
+					const bool rebuilding = m_rebuilding;
+					m_rebuilding = true;
+
+					for (size_t index = 0; index < count; ++index)
+					{
+						void* element = elements + index * valueSize;
+
+						FixElement(valueType, element);
+						container->Insert(address, element);
+						valueType->Destruct(element);
+					}
+
+					m_rebuilding = rebuilding;
+				}
+
+				void FixPointer(const TypeInfo* pointerType, void* slot)
+				{
+					void*& pointer = *static_cast<void**>(slot);
+					if (nullptr == pointer)
+					{
+						return;
+					}
+
+					const TypeInfo* pointeeType = pointerType->GetPureType();
+
+					if ((nullptr != pointeeType) && !pointeeType->GetPropertyList().empty())
+					{
+						if (m_rebuilding)
+						{
+							ResolvePointer(pointeeType, pointer);
+						}
+						else
+						{
+							m_pointers.push_back({ pointeeType, &pointer });
+						}
+
+						return;
+					}
+
+					if (void* clone = FindClone(pointer))
+					{
+						pointer = clone;
+						return;
+					}
+
+					if (!m_rebuilding)
+					{
+						m_interiorPointers.push_back(&pointer);
+					}
+				}
+
+				/**
+				 * @brief	Remaps a pointer to a reflected object into the clone containing it, or clones its target.
+				 */
+				void ResolvePointer(const TypeInfo* pointeeType, void*& pointer)
+				{
+					if (void* clone = FindClone(pointer))
+					{
+						pointer = clone;
+						return;
+					}
+
+					if (void* clone = CloneObject(pointeeType, pointer))
+					{
+						pointer = clone;
+						return;
+					}
+
+					if (!m_rebuilding)
+					{
+						m_interiorPointers.push_back(&pointer);
+					}
+				}
+
+				/**
+				 * @brief	Gets the address matching a source address in the clone of the object containing it.
+				 * @return	void* The address in the clone, or nullptr if no cloned object contains the address.
+				 */
+				void* FindClone(const void* pointer) const
+				{
+					auto remapItr = m_remap.find(pointer);
+					if (remapItr != m_remap.end())
+					{
+						return remapItr->second;
+					}
+
+					const char* address = static_cast<const char*>(pointer);
+
+					auto itr = m_ranges.upper_bound(address);
+					if (itr == m_ranges.begin())
+					{
+						return nullptr;
+					}
+
+					--itr;
+
+					if (address < itr->first + itr->second.size)
+					{
+						return itr->second.clone + (address - itr->first);
+					}
+
+					return nullptr;
+				}
+
+				void FixInteriorPointers()
+				{
+					for (void** slot : m_interiorPointers)
+					{
+						if (void* clone = FindClone(*slot))
+						{
+							*slot = clone;
+						}
+					}
+				}
+
+			private :
+				Arena& m_arena;
+
+				std::unordered_map<const void*, void*> m_remap;
+				std::map<const char*, Range> m_ranges;
+				std::vector<Work> m_worklist;
+				std::vector<Pointer> m_pointers;
+				std::vector<void**> m_interiorPointers;
+				bool m_rebuilding;
+		};
+	}
+
+	void* TypeInfo::Clone(const void* source, Arena& arena) const
+	{
+		if (nullptr == source)
+		{
+			return nullptr;
+		}
+
+		CloneContext context(arena);
+
+		void* clone = context.CloneObject(this, source);
+		if (nullptr != clone)
+		{
+			context.Run();
+		}
+
+		return clone;
+	}
+}
\ No newline at end of file
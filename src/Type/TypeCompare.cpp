@@ -0,0 +1,131 @@
+#include "Type/TypeInfo.h"
+
+#include "Property/PropertyInfo.h"
+#include "Property/ContainerPropertyInfo.h"
+
+#include <cstring>
+
+namespace Reflection
+{
+	bool TypeInfo::Equals(const void* lhs, const void* rhs) const
+	{
+		if (lhs == rhs)
+		{
+			return true;
+		}
+
+		if ((nullptr == lhs) || (nullptr == rhs))
+		{
+			return false;
+		}
+
+		if (m_propertyList.empty())
+		{
+			return EqualsValue(lhs, rhs);
+		}
+
+		const char* lhsBase = static_cast<const char*>(lhs);
+		const char* rhsBase = static_cast<const char*>(rhs);
+
+		for (const Segment& segment : GetSegments())
+		{
+			const char* lhsAddress = lhsBase + segment.offset;
+			const char* rhsAddress = rhsBase + segment.offset;
+
+			if (nullptr == segment.type)
+			{
+				if (0 != std::memcmp(lhsAddress, rhsAddress, segment.size))
+				{
+					return false;
+				}
+			}
+			else if (nullptr != segment.container)
+			{
+				if (!segment.container->Equals(lhsAddress, rhsAddress))
+				{
+					return false;
+				}
+			}
+			else if (!segment.type->Equals(lhsAddress, rhsAddress))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	size_t TypeInfo::Hash(const void* instance, size_t seed) const
+	{
+		if (nullptr == instance)
+		{
+			return seed;
+		}
+
+		if (m_propertyList.empty())
+		{
+			return HashValue(instance, seed);
+		}
+
+		const char* base = static_cast<const char*>(instance);
+
+		for (const Segment& segment : GetSegments())
+		{
+			const char* address = base + segment.offset;
+
+			if (nullptr == segment.type)
+			{
+				seed = Utils::HashBytes(address, segment.size, seed);
+			}
+			else if (nullptr != segment.container)
+			{
+				seed = segment.container->Hash(address, seed);
+			}
+			else
+			{
+				seed = segment.type->Hash(address, seed);
+			}
+		}
+
+		return seed;
+	}
+
+	bool TypeInfo::EqualsValue(const void* lhs, const void* rhs) const
+	{
+		if (m_isTriviallyCopyable)
+		{
+			return 0 == std::memcmp(lhs, rhs, m_typeSize);
+		}
+		else if (nullptr != m_equalFunc)
+		{
+			return m_equalFunc(lhs, rhs);
+		}
+		else
+		{
+			// Opaque : the value cannot be compared, so distinct instances are never equal and Diff reports them.
+			return false;
+		}
+	}
+
+	size_t TypeInfo::HashValue(const void* instance, size_t seed) const
+	{
+		if (m_isTriviallyCopyable)
+		{
+			return Utils::HashBytes(instance, m_typeSize, seed);
+		}
+		else if ((nullptr != m_equalFunc) && (nullptr != m_hashFunc))
+		{
+			return Utils::HashCombine(seed, m_hashFunc(instance));
+		}
+		else
+		{
+			// Opaque values are only equal to themselves, so hashing the type alone keeps Hash consistent with Equals.
+			return Utils::HashCombine(seed, m_typeHash);
+		}
+	}
+
+	bool TypeInfo::IsComparable() const
+	{
+		return !m_propertyList.empty() || m_isTriviallyCopyable || (nullptr != m_equalFunc);
+	}
+}
\ No newline at end of file
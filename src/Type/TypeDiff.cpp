@@ -0,0 +1,168 @@
+#include "Type/TypeInfo.h"
+
+#include "Property/PropertyInfo.h"
+#include "Property/ContainerPropertyInfo.h"
+#include "Property/PropertyDiff.h"
+
+#include <cstring>
+
+namespace Reflection
+{
+	bool TypeInfo::Diff(const void* lhs, const void* rhs, PropertyDiff& diff) const
+	{
+		diff.Clear();
+
+		if ((nullptr == lhs) || (nullptr == rhs) || (lhs == rhs))
+		{
+			return false;
+		}
+
+		const char* lhsBase = static_cast<const char*>(lhs);
+		const char* rhsBase = static_cast<const char*>(rhs);
+
+		PropertyMask& mask = diff.GetMask();
+
+		const FieldList& fields = GetFields();
+		const size_t fieldCount = fields.size();
+
+		for (size_t index = 0; index < fieldCount;)
+		{
+			const Field& field = fields[index];
+
+			if (0 != field.runLength)
+			{
+				if (0 != std::memcmp(lhsBase + field.offset, rhsBase + field.offset, field.runSize))
+				{
+					for (size_t runIndex = index; runIndex < index + field.runLength; ++runIndex)
+					{
+						const Field& runField = fields[runIndex];
+
+						if (0 != std::memcmp(lhsBase + runField.offset, rhsBase + runField.offset, runField.size))
+						{
+							mask.Set(runField.ordinal);
+							diff.AddValue(runField.ordinal, runField.type);
+						}
+					}
+				}
+
+				index += field.runLength;
+				continue;
+			}
+
+			if (nullptr != field.container)
+			{
+				ElementDelta& delta = diff.AddElementDelta(field.ordinal);
+
+				if (field.container->Diff(lhsBase + field.offset, rhsBase + field.offset, delta))
+				{
+					mask.Set(field.ordinal);
+					diff.AddValue(field.ordinal, field.type);
+				}
+				else
+				{
+					diff.PopElementDelta();
+				}
+			}
+			else if (!field.type->Equals(lhsBase + field.offset, rhsBase + field.offset))
+			{
+				mask.Set(field.ordinal);
+				diff.AddValue(field.ordinal, field.type);
+			}
+
+			++index;
+		}
+
+		// The new values are copied once every change is known, so the value buffer is sized once.
+		const PropertyValue* values = diff.GetValues();
+		ElementDelta* elements = diff.GetElements();
+		size_t elementIndex = 0;
+
+		for (size_t index = 0; index < diff.GetValueCount(); ++index)
+		{
+			const Field& field = fields[m_fieldIndices[values[index].ordinal]];
+			const bool stored = diff.StoreValue(index, rhsBase + field.offset);
+
+			if (nullptr == field.container)
+			{
+				continue;
+			}
+
+			ElementDelta& delta = elements[elementIndex++];
+
+			// Keyed elements are indexed in iteration order, which a copy does not have to keep : they are indexed in the copy.
+			if (stored && !delta.full && (nullptr == Cast<const ArrayPropertyInfo*>(field.container)))
+			{
+				delta.Reset(field.ordinal);
+				field.container->Diff(lhsBase + field.offset, diff.GetValue(index), delta);
+			}
+		}
+
+		return !diff.Empty();
+	}
+
+	PropertyDiff TypeInfo::Diff(const void* lhs, const void* rhs) const
+	{
+		PropertyDiff diff;
+		Diff(lhs, rhs, diff);
+
+		return diff;
+	}
+
+	void TypeInfo::ApplyDiff(void* instance, const PropertyDiff& diff) const
+	{
+		if ((nullptr == instance) || diff.Empty())
+		{
+			return;
+		}
+
+		char* base = static_cast<char*>(instance);
+
+		const FieldList& fields = GetFields();
+		const PropertyValue* values = diff.GetValues();
+		const ElementDelta* elements = diff.GetElements();
+		size_t elementIndex = 0;
+
+		for (size_t index = 0; index < diff.GetValueCount(); ++index)
+		{
+			const size_t ordinal = values[index].ordinal;
+			if (ordinal >= m_fieldIndices.size())
+			{
+				continue;
+			}
+
+			const size_t fieldIndex = m_fieldIndices[ordinal];
+			if (fieldIndex >= fields.size())
+			{
+				continue;
+			}
+
+			const Field& field = fields[fieldIndex];
+			const void* value = diff.GetValue(index);
+
+			if (nullptr != field.container)
+			{
+				if ((elementIndex < diff.GetElementCount()) && (ordinal == elements[elementIndex].ordinal))
+				{
+					const ElementDelta& delta = elements[elementIndex++];
+
+					if (nullptr != value)
+					{
+						field.container->ApplyDiff(base + field.offset, value, delta);
+					}
+				}
+			}
+			else if (nullptr == value)
+			{
+				continue;
+			}
+			else if (0 != field.runLength)
+			{
+				std::memcpy(base + field.offset, value, field.size);
+			}
+			else
+			{
+				field.type->CopyAssign(base + field.offset, value);
+			}
+		}
+	}
+}
@@ -5,8 +5,22 @@
 
 #include "Type/TypeManager.h"
 
+#include "Property/PropertyMask.h"
+#include "Property/PropertyObserver.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
 namespace Reflection
 {
+	namespace
+	{
+		// Constant initialized, so types registered during static initialization can already count on it.
+		std::atomic<uint32_t> s_typeIdCount(0);
+	}
+
 	bool TypeInfo::operator==(const TypeInfo& other) const
 	{
 		if (m_typeHash != other.m_typeHash)
@@ -24,33 +38,99 @@ namespace Reflection
 		return m_properties;
 	}
 
+	const TypeInfo::PropertyList& TypeInfo::GetPropertyList() const
+	{
+		return m_propertyList;
+	}
+
 	const TypeInfo::MethodMap& TypeInfo::GetMethods() const
 	{
 		return m_methods;
 	}
 
-	const PropertyInfo* TypeInfo::GetProperty(const std::string& name) const
+	const PropertyInfo* TypeInfo::GetProperty(std::string_view name) const
 	{
-		auto it = m_properties.find(name);
-		if (it != m_properties.end())
+		const PropertyInfo* property = m_properties.Find(name);
+		if (nullptr != property)
 		{
-			return it->second;
+			REFLECTION_COUNT(PropertyLookupHit);
+			return property;
 		}
 
+		REFLECTION_COUNT_MISS(PropertyLookupMiss, std::string(m_typeName) + " : " + std::string(name));
 		return nullptr;
 	}
 
-	const MethodInfo* TypeInfo::GetMethod(const std::string& name) const
+	const MethodInfo* TypeInfo::GetMethod(std::string_view name) const
 	{
-		auto it = m_methods.find(name);
-		if (it != m_methods.end())
+		const MethodInfo* method = m_methods.Find(name);
+		if (nullptr != method)
 		{
-			return it->second;
+			REFLECTION_COUNT(MethodLookupHit);
+			return method;
 		}
 
+		REFLECTION_COUNT_MISS(MethodLookupMiss, std::string(m_typeName) + " : " + std::string(name));
 		return nullptr;
 	}
 
+	TypeInfo::PropertyRange TypeInfo::GetPropertiesWith(PropertyFlag flag) const
+	{
+		return GetFlagList(flag, 0);
+	}
+
+	TypeInfo::PropertyRange TypeInfo::GetPropertiesWithout(PropertyFlag flag) const
+	{
+		if (PropertyFlag::None == flag)
+		{
+			return { m_propertyList.data(), m_propertyList.data() + m_propertyList.size() };
+		}
+
+		return GetFlagList(flag, 1);
+	}
+
+	TypeInfo::PropertyRange TypeInfo::GetFlagList(PropertyFlag flag, size_t side) const
+	{
+		const uint32_t bits = static_cast<uint32_t>(flag);
+
+		if (1 != Utils::PopCount(bits))
+		{
+			return { nullptr, nullptr };
+		}
+
+		std::call_once(m_flagListFlag, [this]() { BuildFlagLists(); });
+
+		const size_t segment = Utils::CountTrailingZeros(bits) * 2 + side;
+		const PropertyInfo* const* data = m_flagProperties.data();
+
+		return { data + m_flagOffsets[segment], data + m_flagOffsets[segment + 1] };
+	}
+
+	void TypeInfo::BuildFlagLists() const
+	{
+		m_flagProperties.reserve(PropertyFlagCount * m_propertyList.size());
+
+		for (size_t bit = 0; bit < PropertyFlagCount; ++bit)
+		{
+			const PropertyFlag flag = static_cast<PropertyFlag>(1u << bit);
+
+			for (size_t side = 0; side < 2; ++side)
+			{
+				m_flagOffsets[bit * 2 + side] = m_flagProperties.size();
+
+				for (const PropertyInfo* property : m_propertyList)
+				{
+					if (property->HasFlags(flag) == (0 == side))
+					{
+						m_flagProperties.push_back(property);
+					}
+				}
+			}
+		}
+
+		m_flagOffsets[PropertyFlagCount * 2] = m_flagProperties.size();
+	}
+
 	void TypeInfo::AddProperty(const PropertyInfo* property)
 	{
 		if (nullptr == property)
@@ -58,7 +138,27 @@ namespace Reflection
 			return;
 		}
 
-		m_properties[property->GetPropertyName()] = property;
+		const PropertyInfo* replaced = m_properties.Insert(property->GetPropertyName(), property);
+		if (nullptr != replaced)
+		{
+			for (const PropertyInfo*& propertyInfo : m_propertyList)
+			{
+				if (propertyInfo == replaced)
+				{
+					propertyInfo = property;
+				}
+			}
+		}
+		else
+		{
+			m_propertyList.push_back(property);
+		}
+
+		// Keyed on the owner : a property inherited from an untracked base keeps writing at no cost on the base instances.
+		if ((nullptr != m_dirtyMaskFunc) && (property->GetOwnerType() == this))
+		{
+			property->EnableHooks(PropertyInfo::HookDirty);
+		}
 	}
 
 	void TypeInfo::AddMethod(const MethodInfo* method)
@@ -68,10 +168,10 @@ namespace Reflection
 			return;
 		}
 
-		m_methods[method->GetMethodName()] = method;
+		m_methods.Insert(method->GetMethodName(), method);
 	}
 
-	const std::string& TypeInfo::GetTypeName() const
+	std::string_view TypeInfo::GetTypeName() const
 	{
 		return m_typeName;
 	}
@@ -81,6 +181,16 @@ namespace Reflection
 		return m_typeHash;
 	}
 
+	uint32_t TypeInfo::GetTypeIdCount()
+	{
+		return s_typeIdCount.load(std::memory_order_acquire);
+	}
+
+	uint32_t TypeInfo::AllocateTypeId()
+	{
+		return s_typeIdCount.fetch_add(1, std::memory_order_acq_rel);
+	}
+
 	const TypeInfo* TypeInfo::GetSuperType() const
 	{
 		return m_superType;
@@ -91,6 +201,374 @@ namespace Reflection
 		return m_pureType;
 	}
 
+	const TypeInfo::BaseList& TypeInfo::GetBaseTypes() const
+	{
+		return m_baseTypes;
+	}
+
+	bool TypeInfo::IsDerivedFrom(const TypeInfo* baseType) const
+	{
+		return nullptr != FindAncestor(baseType);
+	}
+
+	bool TypeInfo::GetBaseOffset(const TypeInfo* baseType, ptrdiff_t& offset) const
+	{
+		if ((nullptr != baseType) && (*this == *baseType))
+		{
+			offset = 0;
+			return true;
+		}
+
+		const Ancestor* ancestor = FindAncestor(baseType);
+		if ((nullptr == ancestor) || (AmbiguousOffset == ancestor->offset))
+		{
+			return false;
+		}
+
+		offset = ancestor->offset;
+		return true;
+	}
+
+	void TypeInfo::BuildAncestors()
+	{
+		// The bases are registered before this type, so their own tables are complete.
+		for (const BaseType& base : m_baseTypes)
+		{
+			m_ancestors.push_back({ base.type->GetTypeHash(), base.type, base.offset });
+
+			for (const Ancestor& ancestor : base.type->m_ancestors)
+			{
+				const ptrdiff_t offset = (AmbiguousOffset == ancestor.offset) ? AmbiguousOffset : base.offset + ancestor.offset;
+				m_ancestors.push_back({ ancestor.typeHash, ancestor.type, offset });
+			}
+		}
+
+		std::sort(m_ancestors.begin(), m_ancestors.end(), [](const Ancestor& lhs, const Ancestor& rhs)
+		{
+			return lhs.typeHash < rhs.typeHash;
+		});
+
+		// A base reached through two paths keeps one entry, without a usable offset.
+		size_t count = 0;
+		for (size_t index = 0; index < m_ancestors.size(); ++index)
+		{
+			if ((0 < count) && (m_ancestors[count - 1].typeHash == m_ancestors[index].typeHash))
+			{
+				m_ancestors[count - 1].offset = AmbiguousOffset;
+				continue;
+			}
+
+			m_ancestors[count++] = m_ancestors[index];
+		}
+
+		m_ancestors.resize(count);
+	}
+
+	const TypeInfo::Ancestor* TypeInfo::FindAncestor(const TypeInfo* baseType) const
+	{
+		if (nullptr == baseType)
+		{
+			return nullptr;
+		}
+
+		const size_t typeHash = baseType->GetTypeHash();
+		const auto found = std::lower_bound(m_ancestors.begin(), m_ancestors.end(), typeHash, [](const Ancestor& ancestor, size_t hash)
+		{
+			return ancestor.typeHash < hash;
+		});
+
+		return ((m_ancestors.end() != found) && (typeHash == found->typeHash)) ? &*found : nullptr;
+	}
+
+	size_t TypeInfo::GetTypeSize() const
+	{
+		return m_typeSize;
+	}
+
+	size_t TypeInfo::GetTypeAlignment() const
+	{
+		return m_typeAlignment;
+	}
+
+	bool TypeInfo::IsTriviallyCopyable() const
+	{
+		return m_isTriviallyCopyable;
+	}
+
+	bool TypeInfo::IsPointer() const
+	{
+		return m_isPointer;
+	}
+
+	bool TypeInfo::IsPolymorphic() const
+	{
+		return m_isPolymorphic;
+	}
+
+	TypeInfo::Primitive TypeInfo::GetPrimitive() const
+	{
+		return m_primitive;
+	}
+
+	const EnumInfo* TypeInfo::GetEnumInfo() const
+	{
+		return m_enumInfo;
+	}
+
+	const ContainerPropertyInfo* TypeInfo::GetContainer() const
+	{
+		return m_container;
+	}
+
+	void TypeInfo::SetContainer(const ContainerPropertyInfo* container)
+	{
+		m_container = container;
+	}
+
+	size_t TypeInfo::GetMetadataBytes() const
+	{
+		return sizeof(TypeInfo)
+			+ m_properties.GetMemoryBytes()
+			+ m_propertyList.capacity() * sizeof(const PropertyInfo*)
+			+ m_methods.GetMemoryBytes()
+			+ m_baseTypes.capacity() * sizeof(BaseType)
+			+ m_ancestors.capacity() * sizeof(Ancestor)
+			+ m_segments.capacity() * sizeof(Segment)
+			+ m_references.capacity() * sizeof(Reference)
+			+ m_fields.capacity() * sizeof(Field)
+			+ m_fieldIndices.capacity() * sizeof(size_t)
+			+ m_flagProperties.capacity() * sizeof(const PropertyInfo*);
+	}
+
+	bool TypeInfo::Construct(void* instance) const
+	{
+		if (nullptr == m_constructFunc)
+		{
+			return false;
+		}
+
+		m_constructFunc(instance);
+		return true;
+	}
+
+	void TypeInfo::Destruct(void* instance) const
+	{
+		if (nullptr != m_destructFunc)
+		{
+			m_destructFunc(instance);
+		}
+	}
+
+	bool TypeInfo::CopyConstruct(void* instance, const void* other) const
+	{
+		if (m_isTriviallyCopyable)
+		{
+			std::memcpy(instance, other, m_typeSize);
+			return true;
+		}
+		else if (nullptr != m_copyConstructFunc)
+		{
+			m_copyConstructFunc(instance, other);
+			return true;
+		}
+
+		return false;
+	}
+
+	bool TypeInfo::CopyAssign(void* instance, const void* other) const
+	{
+		if (m_isTriviallyCopyable)
+		{
+			std::memcpy(instance, other, m_typeSize);
+			return true;
+		}
+		else if (nullptr != m_copyAssignFunc)
+		{
+			m_copyAssignFunc(instance, other);
+			return true;
+		}
+
+		return false;
+	}
+
+	bool TypeInfo::Relocate(void* instance, void* other) const
+	{
+		if (m_isTriviallyCopyable)
+		{
+			std::memcpy(instance, other, m_typeSize);
+			return true;
+		}
+		else if (nullptr != m_relocateFunc)
+		{
+			m_relocateFunc(instance, other);
+			return true;
+		}
+
+		return false;
+	}
+
+	bool TypeInfo::IsConstructible() const
+	{
+		return nullptr != m_constructFunc;
+	}
+
+	bool TypeInfo::IsCopyable() const
+	{
+		return m_isTriviallyCopyable || (nullptr != m_copyConstructFunc);
+	}
+
+	bool TypeInfo::IsRelocatable() const
+	{
+		return m_isTriviallyCopyable || (nullptr != m_relocateFunc);
+	}
+
+	bool TypeInfo::IsTriviallyDestructible() const
+	{
+		return nullptr == m_destructFunc;
+	}
+
+	TypeInfo::DestructFunc TypeInfo::GetDestructFunc() const
+	{
+		return m_destructFunc;
+	}
+
+	const TypeInfo* TypeInfo::GetRuntimeType(const void* instance) const
+	{
+		if ((nullptr != m_runtimeTypeFunc) && (nullptr != instance))
+		{
+			const TypeInfo* runtimeType = m_runtimeTypeFunc(instance);
+
+			ptrdiff_t offset = 0;
+			if ((runtimeType == this) || (runtimeType->GetBaseOffset(this, offset) && (0 == offset)))
+			{
+				return runtimeType;
+			}
+		}
+
+		return this;
+	}
+
+	const TypeInfo* TypeInfo::GetCompleteType(const void* instance, ptrdiff_t& offset) const
+	{
+		offset = 0;
+
+		if ((nullptr != m_runtimeTypeFunc) && (nullptr != instance))
+		{
+			const TypeInfo* runtimeType = m_runtimeTypeFunc(instance);
+			if (runtimeType->GetBaseOffset(this, offset))
+			{
+				return runtimeType;
+			}
+
+			offset = 0;
+		}
+
+		return this;
+	}
+
+	bool TypeInfo::IsTracked() const
+	{
+		return nullptr != m_dirtyMaskFunc;
+	}
+
+	PropertyMask* TypeInfo::GetDirtyMask(void* instance) const
+	{
+		if ((nullptr == m_dirtyMaskFunc) || (nullptr == instance))
+		{
+			return nullptr;
+		}
+
+		return m_dirtyMaskFunc(instance);
+	}
+
+	bool TypeInfo::ConsumeDirty(void* instance, PropertyMask& dirty) const
+	{
+		dirty.Clear();
+
+		PropertyMask* mask = GetDirtyMask(instance);
+		if (nullptr == mask)
+		{
+			return false;
+		}
+
+		dirty |= *mask;
+		mask->Clear();
+
+		return dirty.Any();
+	}
+
+	size_t TypeInfo::Subscribe(std::function<void(const PropertyChange* changes, size_t count)> observer) const
+	{
+		return ObserverManager::GetHandle().Subscribe(this, std::move(observer));
+	}
+
+	void TypeInfo::Unsubscribe(size_t handle) const
+	{
+		ObserverManager::GetHandle().Unsubscribe(handle);
+	}
+
+	TypeInfo::~TypeInfo()
+	{
+		// The types of the program are left alone : they are only destroyed at exit.
+		TypeManager& typeManager = TypeManager::GetHandle();
+
+		if (TypeManager::MainModule != typeManager.GetModule(this))
+		{
+			typeManager.Unregist(this);
+		}
+
+		for (const PropertyInfo* property : m_rebasedProperties)
+		{
+			delete property;
+		}
+	}
+
+	void TypeInfo::InheritBases()
+	{
+		if (m_baseTypes.empty())
+		{
+			return;
+		}
+
+		if (0 != m_baseTypes.front().offset)
+		{
+			std::fprintf(stderr, "Reflection : %.*s : the first reflected base %.*s must be at offset 0, not %td.\n",
+				static_cast<int>(m_typeName.size()), m_typeName.data(),
+				static_cast<int>(m_baseTypes.front().type->GetTypeName().size()), m_baseTypes.front().type->GetTypeName().data(),
+				m_baseTypes.front().offset);
+			std::abort();
+		}
+
+		const TypeInfo* primary = m_baseTypes.front().type;
+
+		for (const PropertyInfo* propertyInfo : primary->GetPropertyList())
+		{
+			AddProperty(propertyInfo);
+		}
+
+		for (const auto& [name, methodInfo] : primary->GetMethods())
+		{
+			AddMethod(methodInfo);
+		}
+
+		for (size_t index = 1; index < m_baseTypes.size(); ++index)
+		{
+			const BaseType& base = m_baseTypes[index];
+
+			// A base reached twice (a non-virtual diamond) keeps the copy of the primary path.
+			for (const PropertyInfo* propertyInfo : base.type->GetPropertyList())
+			{
+				if (nullptr == m_properties.Find(propertyInfo->GetPropertyName()))
+				{
+					const PropertyInfo* rebased = propertyInfo->Rebase(this, static_cast<size_t>(base.offset));
+
+					m_rebasedProperties.push_back(rebased);
+					AddProperty(rebased);
+				}
+			}
+		}
+	}
+
 	void TypeInfo::Regist()
 	{
 		TypeManager::GetHandle().Regist(this);
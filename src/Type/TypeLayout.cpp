@@ -0,0 +1,471 @@
+#include "Type/TypeInfo.h"
+#include "Type/LayoutReport.h"
+
+#include "Property/PropertyInfo.h"
+#include "Property/ContainerPropertyInfo.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace Reflection
+{
+	namespace
+	{
+		void AppendBytes(TypeInfo::SegmentList& segments, const size_t offset, const size_t size)
+		{
+			if (0 == size)
+			{
+				return;
+			}
+
+			if (!segments.empty())
+			{
+				TypeInfo::Segment& last = segments.back();
+				if ((nullptr == last.type) && (last.offset + last.size == offset))
+				{
+					last.size += size;
+					return;
+				}
+			}
+
+			segments.push_back({ offset, size, nullptr, nullptr });
+		}
+
+		void AppendSegment(TypeInfo::SegmentList& segments, const TypeInfo::Segment& segment)
+		{
+			if (nullptr == segment.type)
+			{
+				AppendBytes(segments, segment.offset, segment.size);
+			}
+			else
+			{
+				segments.push_back(segment);
+			}
+		}
+
+		bool HoldsReferences(const TypeInfo* type)
+		{
+			return (nullptr != type) && (type->IsPointer() || !type->GetReferences().empty());
+		}
+
+		bool HoldsReferences(const ContainerPropertyInfo* container)
+		{
+			if (const auto* mapInfo = Cast<const MapPropertyInfo*>(container))
+			{
+				return HoldsReferences(mapInfo->GetKeyType()) || HoldsReferences(mapInfo->GetMappedType());
+			}
+			else if (const auto* setInfo = Cast<const SetPropertyInfo*>(container))
+			{
+				return HoldsReferences(setInfo->GetValueType());
+			}
+			else if (const auto* arrayInfo = Cast<const ArrayPropertyInfo*>(container))
+			{
+				return HoldsReferences(arrayInfo->GetValueType());
+			}
+
+			return false;
+		}
+
+		size_t AlignUp(const size_t value, const size_t alignment)
+		{
+			return (0 == alignment) ? value : (value + alignment - 1) / alignment * alignment;
+		}
+
+		bool IsSplit(const size_t offset, const size_t size)
+		{
+			if (0 == size)
+			{
+				return false;
+			}
+
+			const size_t lines = (size + LayoutCacheLineSize - 1) / LayoutCacheLineSize;
+			const size_t first = offset / LayoutCacheLineSize;
+			const size_t last = (offset + size - 1) / LayoutCacheLineSize;
+
+			return lines < last - first + 1;
+		}
+	}
+
+	bool TypeInfo::IsBitwiseComparable() const
+	{
+		if (m_propertyList.empty())
+		{
+			return m_isTriviallyCopyable;
+		}
+
+		const SegmentList& segments = GetSegments();
+
+		return (1 == segments.size())
+			&& (nullptr == segments[0].type)
+			&& (0 == segments[0].offset)
+			&& (m_typeSize == segments[0].size);
+	}
+
+	uint64_t TypeInfo::GetLayoutFingerprint() const
+	{
+		uint64_t fingerprint = m_layoutFingerprint.load(std::memory_order_acquire);
+
+		if (0 == fingerprint)
+		{
+			// Racing threads compute the same value, so the result is simply published.
+			std::vector<const TypeInfo*> visiting;
+			fingerprint = ComputeFingerprint(visiting);
+			m_layoutFingerprint.store(fingerprint, std::memory_order_release);
+		}
+
+		return fingerprint;
+	}
+
+	const TypeInfo::SegmentList& TypeInfo::GetSegments() const
+	{
+		std::call_once(m_layoutFlag, [this]() { BuildLayout(); });
+
+		return m_segments;
+	}
+
+	const TypeInfo::ReferenceList& TypeInfo::GetReferences() const
+	{
+		std::call_once(m_layoutFlag, [this]() { BuildLayout(); });
+
+		return m_references;
+	}
+
+	const TypeInfo::FieldList& TypeInfo::GetFields() const
+	{
+		std::call_once(m_layoutFlag, [this]() { BuildLayout(); });
+
+		return m_fields;
+	}
+
+	void TypeInfo::BuildLayout() const
+	{
+		PropertyList properties = m_propertyList;
+		std::stable_sort(properties.begin(), properties.end(), [](const PropertyInfo* lhs, const PropertyInfo* rhs)
+		{
+			return lhs->GetPropertyOffset() < rhs->GetPropertyOffset();
+		});
+
+		SegmentList segments;
+		segments.reserve(properties.size());
+
+		ReferenceList references;
+
+		for (const PropertyInfo* property : properties)
+		{
+			const size_t offset = property->GetPropertyOffset();
+			const TypeInfo* propertyType = property->GetPropertyType();
+
+			if (nullptr == propertyType)
+			{
+				continue;
+			}
+
+			const ContainerPropertyInfo* container = Cast<const ContainerPropertyInfo*>(property);
+
+			if (nullptr != container)
+			{
+				segments.push_back({ offset, propertyType->GetTypeSize(), propertyType, container });
+
+				if (HoldsReferences(container))
+				{
+					references.push_back({ offset, propertyType, container });
+				}
+			}
+			else if (!propertyType->GetPropertyList().empty())
+			{
+				for (const Segment& segment : propertyType->GetSegments())
+				{
+					AppendSegment(segments, { offset + segment.offset, segment.size, segment.type, segment.container });
+				}
+
+				for (const Reference& reference : propertyType->GetReferences())
+				{
+					references.push_back({ offset + reference.offset, reference.type, reference.container });
+				}
+			}
+			else if (propertyType->IsTriviallyCopyable())
+			{
+				AppendBytes(segments, offset, propertyType->GetTypeSize());
+
+				if (propertyType->IsPointer())
+				{
+					references.push_back({ offset, propertyType, nullptr });
+				}
+			}
+			else
+			{
+				segments.push_back({ offset, propertyType->GetTypeSize(), propertyType, nullptr });
+			}
+		}
+
+		m_segments = std::move(segments);
+		m_references = std::move(references);
+
+		BuildFields();
+	}
+
+	uint64_t TypeInfo::ComputeFingerprint(std::vector<const TypeInfo*>& visiting) const
+	{
+		size_t hash = Utils::HashCombine(m_typeSize, m_typeAlignment);
+
+		if (Primitive::None != m_primitive)
+		{
+			hash = Utils::HashCombine(hash, static_cast<size_t>(m_primitive));
+			return (0 == hash) ? 1 : static_cast<uint64_t>(hash);
+		}
+
+		// Recursive types (e.g. a node holding an array of nodes) fold the depth of the cycle instead of recursing.
+		const auto cycle = std::find(visiting.begin(), visiting.end(), this);
+		if (cycle != visiting.end())
+		{
+			return Utils::HashCombine(hash, static_cast<size_t>(cycle - visiting.begin()));
+		}
+
+		visiting.push_back(this);
+
+		if (m_propertyList.empty())
+		{
+			hash = Utils::HashBytes(m_typeName.data(), m_typeName.size(), hash);
+		}
+
+		// A relative pointer is followed in the image like an array element, so its target's layout is part of its own.
+		if (nullptr != m_pointeeType)
+		{
+			hash = Utils::HashCombine(hash, m_pointeeType->ComputeFingerprint(visiting));
+		}
+
+		for (const PropertyInfo* property : m_propertyList)
+		{
+			const std::string_view name = property->GetPropertyName();
+
+			hash = Utils::HashBytes(name.data(), name.size(), hash);
+			hash = Utils::HashCombine(hash, property->GetPropertyOffset());
+			hash = Utils::HashCombine(hash, property->GetPropertyType()->ComputeFingerprint(visiting));
+
+			if (const auto* mapInfo = Cast<const MapPropertyInfo*>(property))
+			{
+				hash = Utils::HashCombine(hash, mapInfo->GetKeyType()->ComputeFingerprint(visiting));
+				hash = Utils::HashCombine(hash, mapInfo->GetMappedType()->ComputeFingerprint(visiting));
+			}
+			else if (const auto* setInfo = Cast<const SetPropertyInfo*>(property))
+			{
+				hash = Utils::HashCombine(hash, setInfo->GetValueType()->ComputeFingerprint(visiting));
+			}
+			else if (const auto* arrayInfo = Cast<const ArrayPropertyInfo*>(property))
+			{
+				hash = Utils::HashCombine(hash, arrayInfo->GetValueType()->ComputeFingerprint(visiting));
+			}
+		}
+
+		visiting.pop_back();
+
+		return (0 == hash) ? 1 : static_cast<uint64_t>(hash);
+	}
+
+	void TypeInfo::BuildFields() const
+	{
+		FieldList fields;
+		fields.reserve(m_propertyList.size());
+
+		for (size_t ordinal = 0; ordinal < m_propertyList.size(); ++ordinal)
+		{
+			const PropertyInfo* property = m_propertyList[ordinal];
+			const TypeInfo* propertyType = property->GetPropertyType();
+
+			if (nullptr == propertyType)
+			{
+				continue;
+			}
+
+			const ContainerPropertyInfo* container = Cast<const ContainerPropertyInfo*>(property);
+
+			fields.push_back({ ordinal, property->GetPropertyOffset(), propertyType->GetTypeSize(), propertyType, container, 0, 0 });
+		}
+
+		std::stable_sort(fields.begin(), fields.end(), [](const Field& lhs, const Field& rhs)
+		{
+			return lhs.offset < rhs.offset;
+		});
+
+		for (size_t index = fields.size(); index-- > 0;)
+		{
+			Field& field = fields[index];
+
+			// Only fields whose every byte is compared join a run, so the padding of a nested value is never compared.
+			if ((nullptr != field.container) || !field.type->IsBitwiseComparable())
+			{
+				continue;
+			}
+
+			field.runLength = 1;
+			field.runSize = field.size;
+
+			if (index + 1 < fields.size())
+			{
+				const Field& next = fields[index + 1];
+
+				if ((0 != next.runLength) && (field.offset + field.size == next.offset))
+				{
+					field.runLength += next.runLength;
+					field.runSize += next.runSize;
+				}
+			}
+		}
+
+		std::vector<size_t> fieldIndices(m_propertyList.size(), fields.size());
+		for (size_t index = 0; index < fields.size(); ++index)
+		{
+			fieldIndices[fields[index].ordinal] = index;
+		}
+
+		m_fields = std::move(fields);
+		m_fieldIndices = std::move(fieldIndices);
+	}
+
+	LayoutReport TypeInfo::AnalyzeLayout() const
+	{
+		LayoutReport report{ this, m_typeSize, m_typeAlignment, 0, 0, 0, 0, 0.0, {}, {}, m_typeSize };
+
+		if (0 == m_typeSize)
+		{
+			return report;
+		}
+
+		std::vector<bool> covered(m_typeSize, false);
+		const auto cover = [&covered](const size_t offset, const size_t size)
+		{
+			for (size_t byte = offset; byte < std::min(offset + size, covered.size()); ++byte)
+			{
+				covered[byte] = true;
+			}
+		};
+
+		// The vtable pointer and the secondary bases are not padding, their own properties are reported with their type.
+		size_t baseEnd = 0;
+
+		if (m_isPolymorphic)
+		{
+			cover(0, sizeof(void*));
+			baseEnd = sizeof(void*);
+		}
+
+		for (const BaseType& base : m_baseTypes)
+		{
+			if ((base.type != m_superType) && (0 <= base.offset))
+			{
+				cover(static_cast<size_t>(base.offset), base.type->GetTypeSize());
+				baseEnd = std::max(baseEnd, static_cast<size_t>(base.offset) + base.type->GetTypeSize());
+			}
+		}
+
+		for (const PropertyInfo* property : m_propertyList)
+		{
+			const TypeInfo* propertyType = property->GetPropertyType();
+
+			if (nullptr == propertyType)
+			{
+				continue;
+			}
+
+			const size_t offset = property->GetPropertyOffset();
+			const size_t size = propertyType->GetTypeSize();
+
+			report.fields.push_back({ property, offset, size, propertyType->GetTypeAlignment(), 0, IsSplit(offset, size) });
+			cover(offset, size);
+		}
+
+		std::stable_sort(report.fields.begin(), report.fields.end(), [](const LayoutField& lhs, const LayoutField& rhs)
+		{
+			return lhs.offset < rhs.offset;
+		});
+
+		size_t previousEnd = 0;
+		for (LayoutField& field : report.fields)
+		{
+			for (size_t byte = previousEnd; byte < field.offset; ++byte)
+			{
+				field.paddingBefore += covered[byte] ? 0 : 1;
+			}
+
+			previousEnd = std::max(previousEnd, field.offset + field.size);
+			report.splitCount += field.isSplit ? 1 : 0;
+		}
+
+		report.paddingBytes = static_cast<size_t>(std::count(covered.begin(), covered.end(), false));
+		for (size_t byte = m_typeSize; (0 < byte) && !covered[byte - 1]; --byte)
+		{
+			++report.tailPadding;
+		}
+
+		report.cacheLines = (m_typeSize + LayoutCacheLineSize - 1) / LayoutCacheLineSize;
+
+		// Contiguous instances start at every multiple of the size, so the split pattern repeats after this many of them.
+		if (!report.fields.empty())
+		{
+			const size_t period = LayoutCacheLineSize / std::gcd(m_typeSize, LayoutCacheLineSize);
+
+			size_t splits = 0;
+			for (size_t instance = 0; instance < period; ++instance)
+			{
+				for (const LayoutField& field : report.fields)
+				{
+					splits += IsSplit(instance * m_typeSize + field.offset, field.size) ? 1 : 0;
+				}
+			}
+
+			report.arraySplitRate = static_cast<double>(splits) / static_cast<double>(period * report.fields.size());
+		}
+
+		// Only the declared properties can be reordered, after everything the type inherits.
+		std::vector<const LayoutField*> declared;
+		size_t inheritedEnd = baseEnd;
+
+		for (const LayoutField& field : report.fields)
+		{
+			if (this == field.property->GetOwnerType())
+			{
+				declared.push_back(&field);
+			}
+			else
+			{
+				inheritedEnd = std::max(inheritedEnd, field.offset + field.size);
+			}
+		}
+
+		for (const LayoutField* field : declared)
+		{
+			report.suggestedOrder.push_back(field->property);
+		}
+
+		if (declared.empty())
+		{
+			return report;
+		}
+
+		std::vector<const LayoutField*> order = declared;
+		std::stable_sort(order.begin(), order.end(), [](const LayoutField* lhs, const LayoutField* rhs)
+		{
+			return (lhs->alignment != rhs->alignment) ? (lhs->alignment > rhs->alignment) : (lhs->size > rhs->size);
+		});
+
+		size_t end = std::min(inheritedEnd, declared.front()->offset);
+		for (const LayoutField* field : order)
+		{
+			end = AlignUp(end, field->alignment) + field->size;
+		}
+
+		const size_t suggestedSize = AlignUp(std::max(end, inheritedEnd), m_typeAlignment);
+
+		if (suggestedSize < m_typeSize)
+		{
+			report.suggestedSize = suggestedSize;
+
+			for (size_t index = 0; index < order.size(); ++index)
+			{
+				report.suggestedOrder[index] = order[index]->property;
+			}
+		}
+
+		return report;
+	}
+}
\ No newline at end of file
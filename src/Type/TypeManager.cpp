@@ -1,16 +1,89 @@
 #include "Type/TypeManager.h"
 
 #include "Type/TypeInfo.h"
+#include "Type/TypeCast.h"
+
+#include "Property/PropertyInfo.h"
+#include "Property/ContainerPropertyInfo.h"
+#include "Method/MethodInfo.h"
+
+#include <algorithm>
+#include <thread>
 
 namespace Reflection
 {
+	namespace
+	{
+		/**
+		 * @brief	The registry state of a thread : its reader record, the depth of its ReadGuards and its ModuleScope.
+		 */
+		struct ThreadState
+		{
+			std::atomic<uint64_t>* epoch = nullptr;
+			std::atomic<bool>* isUsed = nullptr;
+			uint32_t depth = 0;
+			TypeManager::ModuleId module = TypeManager::MainModule;
+
+			~ThreadState()
+			{
+				// The record outlives the thread and is handed to the next thread reading the registry.
+				if (nullptr != isUsed)
+				{
+					epoch->store(0, std::memory_order_release);
+					isUsed->store(false, std::memory_order_release);
+				}
+			}
+		};
+
+		thread_local ThreadState s_threadState;
+	}
+
+	TypeManager::ModuleScope::ModuleScope(ModuleId module)
+		: m_previous(s_threadState.module)
+	{
+		s_threadState.module = module;
+	}
+
+	TypeManager::ModuleScope::~ModuleScope()
+	{
+		s_threadState.module = m_previous;
+	}
+
+	TypeManager::ReadGuard::ReadGuard()
+	{
+		TypeManager::GetHandle().EnterRead();
+	}
+
+	TypeManager::ReadGuard::~ReadGuard()
+	{
+		TypeManager::GetHandle().ExitRead();
+	}
+
 	TypeManager::TypeManager()
-		: m_typeMap()
+		: m_registrations()
+		, m_modules(1, Module{ "Main", {} })
+		, m_listeners()
+		, m_snapshot(new Snapshot{ {}, {}, 0 })
+		, m_isDirty(false)
+		, m_retired()
+		, m_generation(0)
+		, m_mutex()
+		, m_epoch(1)
+		, m_readers(nullptr)
+		, m_synchronizeMutex()
 	{}
 
 	TypeManager::~TypeManager()
 	{
-		m_typeMap.clear();
+		// The reader records are kept : threads still running may release theirs after the manager is destroyed.
+		delete m_snapshot.load(std::memory_order_relaxed);
+
+		for (const Retired& retired : m_retired)
+		{
+			delete retired.snapshot;
+		}
+
+		m_registrations.clear();
 	}
 
 	TypeManager& TypeManager::GetHandle()
@@ -27,12 +100,383 @@ namespace Reflection
 		}
 
 		std::lock_guard<std::mutex> lock(m_mutex);
-		
-		m_typeMap.insert({typeInfo->GetTypeHash(), typeInfo});
+
+		const ModuleId module = (s_threadState.module < m_modules.size()) ? s_threadState.module : MainModule;
+
+		if (m_registrations.insert({ typeInfo->GetTypeHash(), Registration{ typeInfo, module } }).second)
+		{
+			if (MainModule != module)
+			{
+				m_modules[module].types.push_back(typeInfo);
+			}
+
+			// Published by the next lookup, so a burst of registrations builds a single snapshot.
+			m_isDirty.store(true, std::memory_order_release);
+		}
+	}
+
+	void TypeManager::Unregist(const TypeInfo* typeInfo)
+	{
+		if (nullptr == typeInfo)
+		{
+			return;
+		}
+
+		std::vector<const TypeInfo*> removed;
+
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			auto itr = m_registrations.find(typeInfo->GetTypeHash());
+			if ((itr == m_registrations.end()) || (itr->second.type != typeInfo))
+			{
+				return;
+			}
+
+			std::vector<const TypeInfo*>& types = m_modules[itr->second.module].types;
+			types.erase(std::remove(types.begin(), types.end(), typeInfo), types.end());
+
+			m_registrations.erase(itr);
+			removed.push_back(typeInfo);
+
+			Publish();
+		}
+
+		Synchronize(removed);
+	}
+
+	TypeManager::ModuleId TypeManager::CreateModule(const std::string& name)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		m_modules.push_back(Module{ name, {} });
+		return static_cast<ModuleId>(m_modules.size() - 1);
+	}
+
+	size_t TypeManager::UnregistModule(ModuleId module)
+	{
+		std::vector<const TypeInfo*> removed;
+
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			// The types of the program are never reclaimed.
+			if ((MainModule == module) || (m_modules.size() <= module))
+			{
+				return 0;
+			}
+
+			for (const TypeInfo* typeInfo : m_modules[module].types)
+			{
+				auto itr = m_registrations.find(typeInfo->GetTypeHash());
+				if ((itr != m_registrations.end()) && (itr->second.type == typeInfo))
+				{
+					m_registrations.erase(itr);
+					removed.push_back(typeInfo);
+				}
+			}
+
+			m_modules[module].types.clear();
+
+			if (removed.empty())
+			{
+				return 0;
+			}
+
+			Publish();
+		}
+
+		Synchronize(removed);
+
+		return removed.size();
+	}
+
+	TypeManager::ModuleId TypeManager::GetModule(const TypeInfo* typeInfo) const
+	{
+		if (nullptr == typeInfo)
+		{
+			return MainModule;
+		}
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		auto itr = m_registrations.find(typeInfo->GetTypeHash());
+		return ((itr != m_registrations.end()) && (itr->second.type == typeInfo)) ? itr->second.module : MainModule;
+	}
+
+	void TypeManager::AddUnregistListener(UnregistFunc listener)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		if ((nullptr != listener) && (m_listeners.end() == std::find(m_listeners.begin(), m_listeners.end(), listener)))
+		{
+			m_listeners.push_back(listener);
+		}
 	}
 
-	const TypeManager::TypeMap& TypeManager::GetTypeMap() const
+	TypeManager::TypeMapView::TypeMapView(const TypeManager& typeManager)
+		: m_guard()
+		, m_types(typeManager.GetSnapshot()->types)
+	{}
+
+	TypeManager::TypeMapView TypeManager::GetTypeMap() const
 	{
-		return m_typeMap;
+		return TypeMapView(*this);
+	}
+
+	const TypeInfo* TypeManager::FindType(std::string_view name) const
+	{
+		ReadGuard guard;
+
+		return GetSnapshot()->names.Find(name);
+	}
+
+	const TypeInfo* TypeManager::FindType(size_t typeHash) const
+	{
+		ReadGuard guard;
+
+		const TypeMap& types = GetSnapshot()->types;
+
+		auto itr = types.find(typeHash);
+		return (itr != types.end()) ? itr->second : nullptr;
+	}
+
+	uint64_t TypeManager::GetGeneration() const
+	{
+		ReadGuard guard;
+
+		return GetSnapshot()->generation;
+	}
+
+	TypeStats TypeManager::GetStats() const
+	{
+		return TypeStats::Capture();
+	}
+
+	void TypeManager::ResetStats()
+	{
+		TypeStats::Reset();
+	}
+
+	MemoryStats TypeManager::GetMemoryStats() const
+	{
+		MemoryStats stats = {};
+
+		ReadGuard guard;
+
+		const Snapshot* snapshot = GetSnapshot();
+		std::vector<const ContainerPropertyInfo::Operations*> operations;
+
+		for (const auto& [hash, type] : snapshot->types)
+		{
+			++stats.typeCount;
+			stats.typeBytes += type->GetMetadataBytes();
+
+			for (const PropertyInfo* property : type->GetPropertyList())
+			{
+				if (property->GetOwnerType() != type)
+				{
+					continue;
+				}
+
+				++stats.propertyCount;
+				stats.propertyBytes += property->GetMetadataBytes();
+
+				const ContainerPropertyInfo* container = Cast<const ContainerPropertyInfo*>(property);
+				if ((nullptr != container) && (operations.end() == std::find(operations.begin(), operations.end(), container->GetOperations())))
+				{
+					operations.push_back(container->GetOperations());
+					stats.propertyBytes += sizeof(ContainerPropertyInfo::Operations);
+				}
+			}
+
+			for (const auto& [name, method] : type->GetMethods())
+			{
+				if (method->GetOwnerType() == type)
+				{
+					++stats.methodCount;
+					stats.methodBytes += method->GetMetadataBytes();
+				}
+			}
+		}
+
+		const NamePool& namePool = NamePool::GetHandle();
+		stats.nameCount = namePool.GetNameCount();
+		stats.nameBytes = namePool.GetReservedBytes();
+		stats.requestedNameBytes = namePool.GetRequestedBytes();
+
+		// The buckets and one node (key, value and next pointer) per type of the hash table.
+		stats.registryBytes = sizeof(Snapshot)
+			+ snapshot->types.bucket_count() * sizeof(void*)
+			+ snapshot->types.size() * (sizeof(TypeMap::value_type) + sizeof(void*))
+			+ snapshot->names.GetMemoryBytes();
+
+		stats.totalBytes = stats.typeBytes + stats.propertyBytes + stats.methodBytes + stats.nameBytes + stats.registryBytes;
+
+		return stats;
+	}
+
+	const TypeManager::Snapshot* TypeManager::GetSnapshot() const
+	{
+		if (m_isDirty.load(std::memory_order_acquire))
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			if (m_isDirty.load(std::memory_order_relaxed))
+			{
+				Publish();
+			}
+		}
+
+		return m_snapshot.load(std::memory_order_seq_cst);
+	}
+
+	void TypeManager::Publish() const
+	{
+		Snapshot* snapshot = new Snapshot{ {}, {}, ++m_generation };
+		snapshot->types.reserve(m_registrations.size());
+
+		std::vector<NameMap::Entry> names;
+		names.reserve(m_registrations.size());
+
+		for (const auto& [hash, registration] : m_registrations)
+		{
+			snapshot->types.emplace(hash, registration.type);
+			names.push_back({ registration.type->GetTypeName(), registration.type });
+		}
+
+		snapshot->names.Assign(std::move(names));
+
+		// Retired snapshots may still be read by the readers which entered before the epoch is advanced.
+		const Snapshot* previous = m_snapshot.exchange(snapshot, std::memory_order_seq_cst);
+		m_retired.push_back(Retired{ previous, m_epoch.fetch_add(1, std::memory_order_seq_cst) + 1 });
+		m_isDirty.store(false, std::memory_order_relaxed);
+
+		Reclaim();
+	}
+
+	void TypeManager::Reclaim() const
+	{
+		// The oldest epoch a reader is in : the snapshots retired after it may still be read.
+		uint64_t oldest = UINT64_MAX;
+
+		for (ReaderRecord* record = m_readers.load(std::memory_order_seq_cst); nullptr != record; record = record->next)
+		{
+			const uint64_t entered = record->epoch.load(std::memory_order_seq_cst);
+			if (0 != entered)
+			{
+				oldest = std::min(oldest, entered);
+			}
+		}
+
+		auto itr = std::remove_if(m_retired.begin(), m_retired.end(), [oldest](const Retired& retired)
+		{
+			if (retired.epoch <= oldest)
+			{
+				delete retired.snapshot;
+				return true;
+			}
+
+			return false;
+		});
+
+		m_retired.erase(itr, m_retired.end());
+	}
+
+	void TypeManager::Synchronize(std::vector<const TypeInfo*>& removed)
+	{
+		std::lock_guard<std::mutex> synchronizeLock(m_synchronizeMutex);
+
+		std::vector<Retired> retired;
+		std::vector<UnregistFunc> listeners;
+
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			retired.swap(m_retired);
+			listeners = m_listeners;
+		}
+
+		// Readers entering from now on load the published snapshot; wait for the ones that entered before.
+		const uint64_t epoch = m_epoch.fetch_add(1, std::memory_order_seq_cst) + 1;
+
+		for (ReaderRecord* record = m_readers.load(std::memory_order_acquire); nullptr != record; record = record->next)
+		{
+			// A guard held by the calling thread cannot be waited for.
+			if (&record->epoch == s_threadState.epoch)
+			{
+				continue;
+			}
+
+			for (uint64_t entered = record->epoch.load(std::memory_order_seq_cst); (0 != entered) && (entered < epoch); entered = record->epoch.load(std::memory_order_seq_cst))
+			{
+				std::this_thread::yield();
+			}
+		}
+
+		for (const Retired& snapshot : retired)
+		{
+			delete snapshot.snapshot;
+		}
+
+		for (const TypeInfo* typeInfo : removed)
+		{
+			for (const UnregistFunc listener : listeners)
+			{
+				listener(typeInfo);
+			}
+		}
+	}
+
+	void TypeManager::EnterRead()
+	{
+		ThreadState& state = s_threadState;
+
+		if (0 != state.depth++)
+		{
+			return;
+		}
+
+		if (nullptr == state.epoch)
+		{
+			ReaderRecord* record = nullptr;
+
+			for (ReaderRecord* itr = m_readers.load(std::memory_order_acquire); nullptr != itr; itr = itr->next)
+			{
+				bool isUsed = false;
+				if (itr->isUsed.compare_exchange_strong(isUsed, true, std::memory_order_acquire))
+				{
+					record = itr;
+					break;
+				}
+			}
+
+			if (nullptr == record)
+			{
+				record = new ReaderRecord();
+				record->epoch.store(0, std::memory_order_relaxed);
+				record->isUsed.store(true, std::memory_order_relaxed);
+				record->next = m_readers.load(std::memory_order_relaxed);
+
+				while (!m_readers.compare_exchange_weak(record->next, record, std::memory_order_release, std::memory_order_relaxed))
+				{
+				}
+			}
+
+			state.epoch = &record->epoch;
+			state.isUsed = &record->isUsed;
+		}
+
+		state.epoch->store(m_epoch.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+	}
+
+	void TypeManager::ExitRead()
+	{
+		ThreadState& state = s_threadState;
+
+		if (0 == --state.depth)
+		{
+			state.epoch->store(0, std::memory_order_release);
+		}
 	}
 }
\ No newline at end of file
@@ -0,0 +1,181 @@
+#include "Type/TypeStats.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
+namespace Reflection
+{
+	namespace
+	{
+		struct ThreadCounters;
+
+		struct StatsRegistry
+		{
+			std::mutex mutex;
+			std::vector<ThreadCounters*> threads;
+
+			// The counts of the exited threads, and the totals at the last Reset.
+			TypeStats::CounterArray retired = {};
+			TypeStats::CounterArray baseline = {};
+
+			std::unordered_map<std::string, uint64_t> missedNames;
+		};
+
+		StatsRegistry& GetRegistry()
+		{
+			static StatsRegistry registry;
+			return registry;
+		}
+
+		/**
+		 * @brief	The counters of one thread. Only the owning thread writes them, so a relaxed load and store
+		 * 			is enough, and other threads can still read them for a snapshot.
+		 */
+		struct ThreadCounters
+		{
+			std::array<std::atomic<uint64_t>, TypeStats::CounterCount> counters;
+
+			ThreadCounters()
+			{
+				for (std::atomic<uint64_t>& counter : counters)
+				{
+					counter.store(0, std::memory_order_relaxed);
+				}
+
+				StatsRegistry& registry = GetRegistry();
+				std::lock_guard<std::mutex> lock(registry.mutex);
+
+				registry.threads.push_back(this);
+			}
+
+			~ThreadCounters()
+			{
+				StatsRegistry& registry = GetRegistry();
+				std::lock_guard<std::mutex> lock(registry.mutex);
+
+				for (size_t index = 0; index < TypeStats::CounterCount; ++index)
+				{
+					registry.retired[index] += counters[index].load(std::memory_order_relaxed);
+				}
+
+				registry.threads.erase(std::remove(registry.threads.begin(), registry.threads.end(), this), registry.threads.end());
+			}
+		};
+
+		thread_local ThreadCounters s_threadCounters;
+
+		TypeStats::CounterArray Sum(const StatsRegistry& registry)
+		{
+			TypeStats::CounterArray counters = registry.retired;
+
+			for (const ThreadCounters* thread : registry.threads)
+			{
+				for (size_t index = 0; index < TypeStats::CounterCount; ++index)
+				{
+					counters[index] += thread->counters[index].load(std::memory_order_relaxed);
+				}
+			}
+
+			return counters;
+		}
+	}
+
+	TypeStats::TypeStats()
+		: m_counters()
+		, m_missedNames()
+	{
+		m_counters.fill(0);
+	}
+
+	TypeStats::TypeStats(const CounterArray& counters, MissedNameList missedNames)
+		: m_counters(counters)
+		, m_missedNames(std::move(missedNames))
+	{}
+
+	void TypeStats::Increment(Counter counter)
+	{
+		std::atomic<uint64_t>& value = s_threadCounters.counters[static_cast<size_t>(counter)];
+		value.store(value.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+	}
+
+	void TypeStats::RecordMiss(Counter counter, const std::string& name)
+	{
+		Increment(counter);
+
+		StatsRegistry& registry = GetRegistry();
+		std::lock_guard<std::mutex> lock(registry.mutex);
+
+		auto itr = registry.missedNames.find(name);
+		if (itr != registry.missedNames.end())
+		{
+			++itr->second;
+		}
+		else if (registry.missedNames.size() < MaxMissedNames)
+		{
+			registry.missedNames.emplace(name, 1);
+		}
+	}
+
+	const char* TypeStats::GetCounterName(Counter counter)
+	{
+		switch (counter)
+		{
+			case Counter::PropertyLookupHit :	return "PropertyLookupHit";
+			case Counter::PropertyLookupMiss :	return "PropertyLookupMiss";
+			case Counter::MethodLookupHit :		return "MethodLookupHit";
+			case Counter::MethodLookupMiss :	return "MethodLookupMiss";
+			case Counter::CastSuccess :			return "CastSuccess";
+			case Counter::CastFailure :			return "CastFailure";
+			case Counter::GetTypeMismatch :		return "GetTypeMismatch";
+			case Counter::SetTypeMismatch :		return "SetTypeMismatch";
+			case Counter::InvokeFailure :		return "InvokeFailure";
+			default :							return "Unknown";
+		}
+	}
+
+	TypeStats TypeStats::Capture()
+	{
+		StatsRegistry& registry = GetRegistry();
+		std::lock_guard<std::mutex> lock(registry.mutex);
+
+		CounterArray counters = Sum(registry);
+		for (size_t index = 0; index < CounterCount; ++index)
+		{
+			counters[index] -= registry.baseline[index];
+		}
+
+		MissedNameList missedNames(registry.missedNames.begin(), registry.missedNames.end());
+		std::sort(missedNames.begin(), missedNames.end(), [](const auto& lhs, const auto& rhs)
+		{
+			return (lhs.second != rhs.second) ? (lhs.second > rhs.second) : (lhs.first < rhs.first);
+		});
+
+		return TypeStats(counters, std::move(missedNames));
+	}
+
+	void TypeStats::Reset()
+	{
+		StatsRegistry& registry = GetRegistry();
+		std::lock_guard<std::mutex> lock(registry.mutex);
+
+		registry.baseline = Sum(registry);
+		registry.missedNames.clear();
+	}
+
+	uint64_t TypeStats::Get(Counter counter) const
+	{
+		return m_counters[static_cast<size_t>(counter)];
+	}
+
+	const TypeStats::CounterArray& TypeStats::GetCounters() const
+	{
+		return m_counters;
+	}
+
+	const TypeStats::MissedNameList& TypeStats::GetMissedNames() const
+	{
+		return m_missedNames;
+	}
+}
\ No newline at end of file
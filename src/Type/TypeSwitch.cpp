@@ -0,0 +1,234 @@
+#include "Type/TypeSwitch.h"
+
+#include "Type/TypeCast.h"
+
+#include <algorithm>
+
+namespace Reflection
+{
+	namespace
+	{
+		bool IsSameOrDerived(const TypeInfo* type, const TypeInfo* baseType)
+		{
+			return IsSame(type, baseType) || type->IsDerivedFrom(baseType);
+		}
+
+		// An answer word is [lhs offset : 24 bits][rhs offset : 24 bits][handler index + 1 : 16 bits], 0 for a free slot.
+		constexpr int64_t PairOffsetLimit = int64_t(1) << 23;
+		constexpr uint64_t BusyKey = ~uint64_t(0);
+
+		bool EncodePair(size_t index, ptrdiff_t lhsOffset, ptrdiff_t rhsOffset, uint64_t& answer)
+		{
+			if ((lhsOffset <= -PairOffsetLimit) || (PairOffsetLimit <= lhsOffset) || (rhsOffset <= -PairOffsetLimit) || (PairOffsetLimit <= rhsOffset))
+			{
+				return false;
+			}
+
+			answer = (static_cast<uint64_t>(lhsOffset & 0xFFFFFF) << 40) | (static_cast<uint64_t>(rhsOffset & 0xFFFFFF) << 16) | static_cast<uint64_t>(index + 1);
+			return true;
+		}
+
+		size_t DecodePair(uint64_t answer, ptrdiff_t& lhsOffset, ptrdiff_t& rhsOffset)
+		{
+			lhsOffset = static_cast<ptrdiff_t>(static_cast<int64_t>(answer) >> 40);
+			rhsOffset = static_cast<ptrdiff_t>(static_cast<int64_t>(answer << 24) >> 40);
+
+			return static_cast<size_t>(answer & 0xFFFF) - 1;
+		}
+	}
+
+	size_t ResolveDispatch(const TypeInfo* runtimeType, const TypeInfo* sourceType, const TypeInfo* const* targets, size_t count, ptrdiff_t& offset)
+	{
+		std::vector<size_t> matches;
+		for (size_t index = 0; index < count; ++index)
+		{
+			ptrdiff_t adjustment = 0;
+			if (GetCastOffset(runtimeType, sourceType, targets[index], adjustment))
+			{
+				matches.push_back(index);
+			}
+		}
+
+		// The first match that no other match derives from.
+		for (const size_t index : matches)
+		{
+			const bool isShadowed = std::any_of(matches.begin(), matches.end(), [&](size_t other)
+			{
+				return targets[other]->IsDerivedFrom(targets[index]);
+			});
+
+			if (!isShadowed)
+			{
+				GetCastOffset(runtimeType, sourceType, targets[index], offset);
+				return index;
+			}
+		}
+
+		return count;
+	}
+
+	size_t ResolvePairDispatch(const TypeInfo* lhsType, const TypeInfo* lhsSource, const TypeInfo* rhsType, const TypeInfo* rhsSource,
+							const TypeInfo* const* lhsTargets, const TypeInfo* const* rhsTargets, size_t count,
+							ptrdiff_t& lhsOffset, ptrdiff_t& rhsOffset)
+	{
+		std::vector<size_t> matches;
+		for (size_t index = 0; index < count; ++index)
+		{
+			ptrdiff_t lhsAdjustment = 0;
+			ptrdiff_t rhsAdjustment = 0;
+
+			if (GetCastOffset(lhsType, lhsSource, lhsTargets[index], lhsAdjustment) && GetCastOffset(rhsType, rhsSource, rhsTargets[index], rhsAdjustment))
+			{
+				matches.push_back(index);
+			}
+		}
+
+		// The first match such that no other match is at least as derived on both sides and more derived on one.
+		for (const size_t index : matches)
+		{
+			const bool isShadowed = std::any_of(matches.begin(), matches.end(), [&](size_t other)
+			{
+				return IsSameOrDerived(lhsTargets[other], lhsTargets[index])
+					&& IsSameOrDerived(rhsTargets[other], rhsTargets[index])
+					&& (lhsTargets[other]->IsDerivedFrom(lhsTargets[index]) || rhsTargets[other]->IsDerivedFrom(rhsTargets[index]));
+			});
+
+			if (!isShadowed)
+			{
+				GetCastOffset(lhsType, lhsSource, lhsTargets[index], lhsOffset);
+				GetCastOffset(rhsType, rhsSource, rhsTargets[index], rhsOffset);
+				return index;
+			}
+		}
+
+		return count;
+	}
+
+	DispatchTable::DispatchTable(const TypeInfo* sourceType, const TypeInfo* const* targets, size_t count)
+		: m_sourceType(sourceType)
+		, m_targets(targets)
+		, m_count(count)
+		, m_block(nullptr)
+		, m_blocks()
+		, m_growMutex()
+	{
+		m_blocks.push_back(std::make_unique<Block>(Block{ 0, nullptr }));
+		m_block.store(m_blocks.back().get(), std::memory_order_release);
+	}
+
+	DispatchTable::~DispatchTable() = default;
+
+	size_t DispatchTable::FindSlow(const TypeInfo* runtimeType, ptrdiff_t& offset)
+	{
+		ptrdiff_t found = 0;
+		const size_t index = ResolveDispatch(runtimeType, m_sourceType, m_targets, m_count, found);
+
+		offset = found;
+
+		// The handler index + 1 fits the low 16 bits, and is never 0 so the entry reads as resolved.
+		if (0xFFFF <= m_count)
+		{
+			return index;
+		}
+
+		const uint64_t entry = (static_cast<uint64_t>(static_cast<int64_t>(found)) << 16) | static_cast<uint64_t>(index + 1);
+		const uint32_t typeId = runtimeType->GetTypeId();
+
+		const Block* block = m_block.load(std::memory_order_acquire);
+		if (block->capacity <= typeId)
+		{
+			std::lock_guard<std::mutex> lock(m_growMutex);
+
+			block = m_block.load(std::memory_order_acquire);
+			if (block->capacity <= typeId)
+			{
+				// Sized for every type registered so far, so a table usually grows once after the static initialization.
+				size_t capacity = std::max<size_t>(64, block->capacity * 2);
+				while (capacity <= std::max<size_t>(typeId, TypeInfo::GetTypeIdCount()))
+				{
+					capacity *= 2;
+				}
+
+				std::unique_ptr<Block> grown = std::make_unique<Block>(Block{ capacity, std::make_unique<std::atomic<uint64_t>[]>(capacity) });
+				for (size_t slot = 0; slot < capacity; ++slot)
+				{
+					const uint64_t value = (slot < block->capacity) ? block->entries[slot].load(std::memory_order_relaxed) : 0;
+					grown->entries[slot].store(value, std::memory_order_relaxed);
+				}
+
+				block = grown.get();
+				m_blocks.push_back(std::move(grown));
+				m_block.store(block, std::memory_order_release);
+			}
+		}
+
+		block->entries[typeId].store(entry, std::memory_order_relaxed);
+
+		return index;
+	}
+
+	PairDispatchTable::PairDispatchTable(const TypeInfo* lhsSource, const TypeInfo* rhsSource, const TypeInfo* const* lhsTargets, const TypeInfo* const* rhsTargets, size_t count)
+		: m_lhsSource(lhsSource)
+		, m_rhsSource(rhsSource)
+		, m_lhsTargets(lhsTargets)
+		, m_rhsTargets(rhsTargets)
+		, m_count(count)
+		, m_entries(new Entry[Capacity])
+	{
+		for (size_t index = 0; index < Capacity; ++index)
+		{
+			m_entries[index].key.store(0, std::memory_order_relaxed);
+			m_entries[index].answer.store(0, std::memory_order_relaxed);
+		}
+	}
+
+	PairDispatchTable::~PairDispatchTable() = default;
+
+	size_t PairDispatchTable::Find(const TypeInfo* lhsType, const TypeInfo* rhsType, ptrdiff_t& lhsOffset, ptrdiff_t& rhsOffset)
+	{
+		if (0xFFFF <= m_count)
+		{
+			return Resolve(lhsType, rhsType, lhsOffset, rhsOffset);
+		}
+
+		const uint64_t key = ((static_cast<uint64_t>(lhsType->GetTypeId()) + 1) << 32) | rhsType->GetTypeId();
+		const size_t slot = static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> 54) & (Capacity - 1);
+
+		for (size_t probe = 0; probe < MaxProbe; ++probe)
+		{
+			Entry& entry = m_entries[(slot + probe) & (Capacity - 1)];
+			uint64_t current = entry.key.load(std::memory_order_acquire);
+
+			if (key == current)
+			{
+				return DecodePair(entry.answer.load(std::memory_order_relaxed), lhsOffset, rhsOffset);
+			}
+
+			if (0 != current)
+			{
+				continue;
+			}
+
+			const size_t index = Resolve(lhsType, rhsType, lhsOffset, rhsOffset);
+
+			uint64_t answer = 0;
+			if (EncodePair(index, lhsOffset, rhsOffset, answer) && entry.key.compare_exchange_strong(current, BusyKey, std::memory_order_acquire))
+			{
+				entry.answer.store(answer, std::memory_order_relaxed);
+				entry.key.store(key, std::memory_order_release);
+			}
+
+			return index;
+		}
+
+		return Resolve(lhsType, rhsType, lhsOffset, rhsOffset);
+	}
+
+	size_t PairDispatchTable::Resolve(const TypeInfo* lhsType, const TypeInfo* rhsType, ptrdiff_t& lhsOffset, ptrdiff_t& rhsOffset) const
+	{
+		lhsOffset = 0;
+		rhsOffset = 0;
+
+		return ResolvePairDispatch(lhsType, m_lhsSource, rhsType, m_rhsSource, m_lhsTargets, m_rhsTargets, m_count, lhsOffset, rhsOffset);
+	}
+}
\ No newline at end of file
@@ -1,12 +1,96 @@
 #include "Utils.h"
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
 
 namespace Reflection
 {
 	namespace Utils
 	{
+		namespace
+		{
+			constexpr uint64_t PRIME_1 = 0x9E3779B185EBCA87ull;
+			constexpr uint64_t PRIME_2 = 0xC2B2AE3D27D4EB4Full;
+			constexpr uint64_t PRIME_3 = 0x165667B19E3779F9ull;
+
+			inline uint64_t Load64(const uint8_t* data)
+			{
+				uint64_t value;
+				std::memcpy(&value, data, sizeof(value));
+				return value;
+			}
+
+			inline uint64_t RotateLeft(const uint64_t value, const int shift)
+			{
+				return (value << shift) | (value >> (64 - shift));
+			}
+
+			inline uint64_t Round(uint64_t lane, const uint64_t input)
+			{
+				lane += input * PRIME_2;
+				lane = RotateLeft(lane, 31);
+				return lane * PRIME_1;
+			}
+
+			inline uint64_t Avalanche(uint64_t value)
+			{
+				value ^= value >> 33;
+				value *= PRIME_2;
+				value ^= value >> 29;
+				value *= PRIME_3;
+				value ^= value >> 32;
+				return value;
+			}
+		}
+
+		size_t HashBytes(const void* data, size_t size, size_t seed)
+		{
+			const uint8_t* bytes = static_cast<const uint8_t*>(data);
+
+			uint64_t lane1 = static_cast<uint64_t>(seed) + PRIME_1;
+			uint64_t lane2 = static_cast<uint64_t>(seed) ^ PRIME_2;
+
+			const uint64_t length = static_cast<uint64_t>(size);
+
+			while (size >= 16)
+			{
+				lane1 = Round(lane1, Load64(bytes));
+				lane2 = Round(lane2, Load64(bytes + 8));
+
+				bytes += 16;
+				size -= 16;
+			}
+
+			if (size >= 8)
+			{
+				lane1 = Round(lane1, Load64(bytes));
+
+				bytes += 8;
+				size -= 8;
+			}
+
+			if (size > 0)
+			{
+				uint64_t tail = 0;
+				std::memcpy(&tail, bytes, size);
+
+				lane2 = Round(lane2, tail);
+			}
+
+			const uint64_t result = RotateLeft(lane1, 7) + RotateLeft(lane2, 18) + length * PRIME_3;
+
+			return static_cast<size_t>(Avalanche(result));
+		}
+
+		size_t HashCombine(size_t seed, size_t value)
+		{
+			const uint64_t result = (static_cast<uint64_t>(seed) ^ PRIME_3) * PRIME_1 + static_cast<uint64_t>(value);
+
+			return static_cast<size_t>(Avalanche(result));
+		}
+
 #if defined(_WIN32)
-		const std::string GetName(const std::string& rawClassName)
+		const std::string GetName(std::string_view rawClassName)
 		{
 			std::string className;
 			
@@ -50,7 +134,7 @@ namespace Reflection
 			return className;
 		}
 #else
-		const std::string GetClassName(const std::string& rawClassName)
+		const std::string GetName(std::string_view rawClassName)
 		{
 			std::string className;
 			